@@ -29,6 +29,7 @@
 #define ulong mp_limb_t
 #include "flint.h"
 #include "d_vec.h"
+#include "thread_pool.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -135,6 +136,13 @@ FLINT_DLL void d_mat_transpose(d_mat_t B, const d_mat_t A);
 
 FLINT_DLL void d_mat_mul_classical(d_mat_t C, const d_mat_t A, const d_mat_t B);
 
+FLINT_DLL void _d_mat_gemm(double * C, slong ldc, const double * A, slong lda,
+                     const double * B, slong ldb, slong m, slong n, slong k);
+
+FLINT_DLL void _d_mat_gemm_pool(double * C, slong ldc, const double * A,
+        slong lda, const double * B, slong ldb, slong m, slong n, slong k,
+                                thread_pool_handle * threads, slong num_threads);
+
 /* Permutations */
 
 D_MAT_INLINE
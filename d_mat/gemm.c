@@ -0,0 +1,265 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "d_mat.h"
+#include "thread_support.h"
+
+/*
+    Packed, cache blocked matrix multiplication in the style of Goto and
+    van de Geijn. A KC x NC block of B is packed into column panels of
+    width NR which stay in L3/L2, an MC x KC block of A is packed into row
+    panels of height MR which stay in L2/L1, and the microkernel
+    accumulates an MR x NR block of C in registers.
+
+    The microkernel is plain C written so that the compiler vectorises it.
+    On x86_64 with gcc we let the compiler emit AVX2/FMA and AVX-512
+    clones and pick one at load time. All arithmetic is exact when the
+    inputs are integers and every partial sum is bounded by 2^53, which is
+    how nmod_mat_mul_blas uses this function without BLAS.
+*/
+
+#define GEMM_MR 6
+#define GEMM_NR 8
+#define GEMM_KC 256
+#define GEMM_MC 96
+#define GEMM_NC 2048
+
+/*
+    c[MR x NR] = sum_p a[p*MR + i]*b[p*NR + j]. The rows are spelled out
+    so that the accumulators can live in vector registers.
+*/
+FLINT_TARGET_CLONES
+static void _gemm_kernel(double * c, const double * a, const double * b,
+                                                                      slong kc)
+{
+    double t0[GEMM_NR], t1[GEMM_NR], t2[GEMM_NR];
+    double t3[GEMM_NR], t4[GEMM_NR], t5[GEMM_NR];
+    slong j, p;
+
+    for (j = 0; j < GEMM_NR; j++)
+    {
+        t0[j] = t1[j] = t2[j] = 0;
+        t3[j] = t4[j] = t5[j] = 0;
+    }
+
+    for (p = 0; p < kc; p++)
+    {
+        for (j = 0; j < GEMM_NR; j++)
+        {
+            t0[j] += a[0]*b[j];
+            t1[j] += a[1]*b[j];
+            t2[j] += a[2]*b[j];
+            t3[j] += a[3]*b[j];
+            t4[j] += a[4]*b[j];
+            t5[j] += a[5]*b[j];
+        }
+
+        a += GEMM_MR;
+        b += GEMM_NR;
+    }
+
+    for (j = 0; j < GEMM_NR; j++)
+    {
+        c[0*GEMM_NR + j] = t0[j];
+        c[1*GEMM_NR + j] = t1[j];
+        c[2*GEMM_NR + j] = t2[j];
+        c[3*GEMM_NR + j] = t3[j];
+        c[4*GEMM_NR + j] = t4[j];
+        c[5*GEMM_NR + j] = t5[j];
+    }
+}
+
+static void _pack_a(double * Ap, const double * A, slong lda,
+                                                           slong mc, slong kc)
+{
+    slong i, ii, p;
+
+    for (i = 0; i < mc; i += GEMM_MR)
+    {
+        slong mr = FLINT_MIN(GEMM_MR, mc - i);
+
+        for (p = 0; p < kc; p++)
+        {
+            for (ii = 0; ii < mr; ii++)
+                Ap[ii] = A[(i + ii)*lda + p];
+            for ( ; ii < GEMM_MR; ii++)
+                Ap[ii] = 0;
+            Ap += GEMM_MR;
+        }
+    }
+}
+
+static void _pack_b(double * Bp, const double * B, slong ldb,
+                                                           slong kc, slong nc)
+{
+    slong j, jj, p;
+
+    for (j = 0; j < nc; j += GEMM_NR)
+    {
+        slong nr = FLINT_MIN(GEMM_NR, nc - j);
+
+        for (p = 0; p < kc; p++)
+        {
+            for (jj = 0; jj < nr; jj++)
+                Bp[jj] = B[p*ldb + j + jj];
+            for ( ; jj < GEMM_NR; jj++)
+                Bp[jj] = 0;
+            Bp += GEMM_NR;
+        }
+    }
+}
+
+/* C[0..m) = A[0..m)*B using the given pack space */
+static void _d_mat_gemm_rows(double * C, slong ldc,
+                             const double * A, slong lda,
+                             const double * B, slong ldb,
+                             slong m, slong n, slong k,
+                             double * Ap, double * Bp)
+{
+    double c[GEMM_MR*GEMM_NR];
+    slong ic, jc, pc, i, j, ii, jj;
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+            C[i*ldc + j] = 0;
+
+    for (jc = 0; jc < n; jc += GEMM_NC)
+    {
+        slong nc = FLINT_MIN(GEMM_NC, n - jc);
+
+        for (pc = 0; pc < k; pc += GEMM_KC)
+        {
+            slong kc = FLINT_MIN(GEMM_KC, k - pc);
+
+            _pack_b(Bp, B + pc*ldb + jc, ldb, kc, nc);
+
+            for (ic = 0; ic < m; ic += GEMM_MC)
+            {
+                slong mc = FLINT_MIN(GEMM_MC, m - ic);
+
+                _pack_a(Ap, A + ic*lda + pc, lda, mc, kc);
+
+                for (j = 0; j < nc; j += GEMM_NR)
+                {
+                    slong nr = FLINT_MIN(GEMM_NR, nc - j);
+
+                    for (i = 0; i < mc; i += GEMM_MR)
+                    {
+                        slong mr = FLINT_MIN(GEMM_MR, mc - i);
+                        double * Cij = C + (ic + i)*ldc + jc + j;
+
+                        _gemm_kernel(c, Ap + i*kc, Bp + j*kc, kc);
+
+                        for (ii = 0; ii < mr; ii++)
+                            for (jj = 0; jj < nr; jj++)
+                                Cij[ii*ldc + jj] += c[ii*GEMM_NR + jj];
+                    }
+                }
+            }
+        }
+    }
+}
+
+typedef struct
+{
+    double * C;
+    slong ldc;
+    const double * A;
+    slong lda;
+    const double * B;
+    slong ldb;
+    slong m;
+    slong n;
+    slong k;
+} _gemm_worker_arg_struct;
+
+static void _gemm_worker(void * varg)
+{
+    _gemm_worker_arg_struct * arg = (_gemm_worker_arg_struct *) varg;
+    slong kc = FLINT_MIN(GEMM_KC, arg->k);
+    slong nc = FLINT_MIN(GEMM_NC, arg->n);
+    double * Ap, * Bp;
+
+    if (arg->m <= 0)
+        return;
+
+    Ap = flint_malloc(GEMM_MC*kc*sizeof(double));
+    Bp = flint_malloc((nc + GEMM_NR)*kc*sizeof(double));
+
+    _d_mat_gemm_rows(arg->C, arg->ldc, arg->A, arg->lda, arg->B, arg->ldb,
+                                           arg->m, arg->n, arg->k, Ap, Bp);
+
+    flint_free(Ap);
+    flint_free(Bp);
+}
+
+void _d_mat_gemm_pool(double * C, slong ldc, const double * A, slong lda,
+                       const double * B, slong ldb, slong m, slong n, slong k,
+                                  thread_pool_handle * threads, slong num_threads)
+{
+    _gemm_worker_arg_struct * args;
+    slong i, start, stop;
+
+    if (m <= 0 || n <= 0)
+        return;
+
+    if (k <= 0)
+    {
+        for (i = 0; i < m; i++)
+            _d_vec_zero(C + i*ldc, n);
+        return;
+    }
+
+    /* give each thread at least one block of rows of A */
+    num_threads = FLINT_MIN(num_threads, (m - 1)/GEMM_MC);
+
+    args = flint_malloc((num_threads + 1)*sizeof(_gemm_worker_arg_struct));
+
+    for (i = 0; i <= num_threads; i++)
+    {
+        start = ((m/GEMM_MR)*i/(num_threads + 1))*GEMM_MR;
+        stop = (i == num_threads) ? m :
+                         ((m/GEMM_MR)*(i + 1)/(num_threads + 1))*GEMM_MR;
+
+        args[i].C = C + start*ldc;
+        args[i].ldc = ldc;
+        args[i].A = A + start*lda;
+        args[i].lda = lda;
+        args[i].B = B;
+        args[i].ldb = ldb;
+        args[i].m = stop - start;
+        args[i].n = n;
+        args[i].k = k;
+    }
+
+    for (i = 0; i < num_threads; i++)
+        thread_pool_wake(global_thread_pool, threads[i], 0,
+                                                      _gemm_worker, &args[i]);
+
+    _gemm_worker(&args[num_threads]);
+
+    for (i = 0; i < num_threads; i++)
+        thread_pool_wait(global_thread_pool, threads[i]);
+
+    flint_free(args);
+}
+
+void _d_mat_gemm(double * C, slong ldc, const double * A, slong lda,
+                     const double * B, slong ldb, slong m, slong n, slong k)
+{
+    thread_pool_handle * threads;
+    slong num_threads;
+
+    num_threads = flint_request_threads(&threads,
+                                  FLINT_MIN(flint_get_num_threads(), m/GEMM_MC));
+
+    _d_mat_gemm_pool(C, ldc, A, lda, B, ldb, m, n, k, threads, num_threads);
+
+    flint_give_back_threads(threads, num_threads);
+}
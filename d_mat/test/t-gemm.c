@@ -0,0 +1,124 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "d_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("gemm....");
+    fflush(stdout);
+
+    /* integer entries, so that the result is exact */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        double * A, * B, * C;
+        d_mat_t X, Y, Z;
+        slong m, n, k, lda, ldb, ldc, r, s;
+        ulong bound;
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 400);
+            n = n_randint(state, 400);
+            k = n_randint(state, 600);
+        }
+        else
+        {
+            m = n_randint(state, 40);
+            n = n_randint(state, 40);
+            k = n_randint(state, 40);
+        }
+
+        lda = k + n_randint(state, 3);
+        ldb = n + n_randint(state, 3);
+        ldc = n + n_randint(state, 3);
+
+        bound = n_sqrt(UWORD(1) << 52)/(k + 1) + 1;
+
+        A = flint_malloc((m*lda + 1)*sizeof(double));
+        B = flint_malloc((k*ldb + 1)*sizeof(double));
+        C = flint_malloc((m*ldc + 1)*sizeof(double));
+
+        d_mat_init(X, m, k);
+        d_mat_init(Y, k, n);
+        d_mat_init(Z, m, n);
+
+        for (r = 0; r < m; r++)
+            for (s = 0; s < k; s++)
+                A[r*lda + s] = d_mat_entry(X, r, s) =
+                      (double) n_randint(state, 2*bound) - (double) bound;
+
+        for (r = 0; r < k; r++)
+            for (s = 0; s < n; s++)
+                B[r*ldb + s] = d_mat_entry(Y, r, s) =
+                      (double) n_randint(state, 2*bound) - (double) bound;
+
+        for (r = 0; r < m*ldc + 1; r++)
+            C[r] = -1;
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        _d_mat_gemm(C, ldc, A, lda, B, ldb, m, n, k);
+
+        d_mat_mul_classical(Z, X, Y);
+
+        for (r = 0; r < m; r++)
+        {
+            for (s = 0; s < n; s++)
+            {
+                if (C[r*ldc + s] != d_mat_entry(Z, r, s))
+                {
+                    flint_printf("FAIL: results not equal\n");
+                    flint_printf("m = %wd, n = %wd, k = %wd\n", m, n, k);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+
+            for ( ; r < m - 1 && s < ldc; s++)
+            {
+                if (C[r*ldc + s] != -1)
+                {
+                    flint_printf("FAIL: wrote outside of C\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        if (C[m*ldc] != -1)
+        {
+            flint_printf("FAIL: wrote outside of C\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        flint_free(A);
+        flint_free(B);
+        flint_free(C);
+
+        d_mat_clear(X);
+        d_mat_clear(Y);
+        d_mat_clear(Z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
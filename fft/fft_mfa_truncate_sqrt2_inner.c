@@ -13,6 +13,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
+#include "thread_support.h"
 
 typedef struct
 {
@@ -17,8 +17,8 @@
 
 static int fft_tuning_table[5][2] = FFT_TAB;
 
-void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1, 
-                        mp_srcptr i2, mp_size_t n2)
+int _flint_mpn_mul_fft_params(flint_bitcnt_t * depth_out,
+                       flint_bitcnt_t * w_out, mp_size_t n1, mp_size_t n2)
 {
    mp_size_t off, depth = 6;
    mp_size_t w = 1;
@@ -72,7 +72,10 @@ void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
          w += wadj;
       }
 
-      mul_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+      *depth_out = depth;
+      *w_out = w;
+
+      return 0;
    } else
    {
       if (j1 + j2 - 1 <= 3*n)
@@ -80,7 +83,21 @@ void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
          depth--;
          w *= 3;
       }
-      mul_mfa_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+
+      *depth_out = depth;
+      *w_out = w;
+
+      return 1;
    }
 }
 
+void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1, 
+                        mp_srcptr i2, mp_size_t n2)
+{
+   flint_bitcnt_t depth, w;
+
+   if (_flint_mpn_mul_fft_params(&depth, &w, n1, n2))
+      mul_mfa_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+   else
+      mul_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+}
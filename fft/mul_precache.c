@@ -0,0 +1,99 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+#include "mpn_extras.h"
+
+void flint_mpn_mul_precache_init(flint_mpn_mul_precache_t pre,
+                                  mp_srcptr i2, mp_size_t n2, mp_size_t n1)
+{
+   mp_size_t n, limbs, size, i, j1, trunc;
+   flint_bitcnt_t bits;
+   mp_limb_t ** t1, ** t2, ** s1;
+   mp_limb_t * ptr;
+
+   _flint_mpn_mul_fft_params(&pre->depth, &pre->w, n1, n2);
+
+   n = (WORD(1) << pre->depth);
+   limbs = (n*pre->w)/FLINT_BITS;
+   size = limbs + 1;
+   bits = (n*pre->w - (pre->depth + 1))/2;
+
+   pre->n1 = n1;
+   pre->n2 = n2;
+
+   /*
+      the transform swaps coefficient pointers with the temporaries, so
+      these have to live as long as the coefficients themselves
+   */
+   pre->jj = flint_malloc((4*(n + n*size) + 3*size + 3)*sizeof(mp_limb_t));
+   for (i = 0, ptr = (mp_limb_t *) pre->jj + 4*n; i < 4*n; i++, ptr += size)
+      pre->jj[i] = ptr;
+
+   t1 = (mp_limb_t **) ptr;
+   t2 = t1 + 1;
+   s1 = t2 + 1;
+   ptr += 3;
+   t1[0] = ptr;
+   t2[0] = t1[0] + size;
+   s1[0] = t2[0] + size;
+
+   pre->j2 = fft_split_bits(pre->jj, i2, n2, bits, limbs);
+   for (i = pre->j2; i < 4*n; i++)
+      flint_mpn_zero(pre->jj[i], size);
+
+   j1 = (n1*FLINT_BITS - 1)/bits + 1;
+   trunc = j1 + pre->j2 - 1;
+   if (trunc <= 2*n) trunc = 2*n + 1;
+
+   fft_precache(pre->jj, pre->depth, limbs, trunc, t1, t2, s1);
+}
+
+void flint_mpn_mul_precache_clear(flint_mpn_mul_precache_t pre)
+{
+   flint_free(pre->jj);
+}
+
+void flint_mpn_mul_precache(mp_ptr r, mp_srcptr i1, mp_size_t n1,
+                                         const flint_mpn_mul_precache_t pre)
+{
+   mp_size_t n = (WORD(1) << pre->depth);
+   mp_size_t limbs = (n*pre->w)/FLINT_BITS;
+   mp_size_t size = limbs + 1;
+   flint_bitcnt_t bits = (n*pre->w - (pre->depth + 1))/2;
+   mp_size_t i, j1, trunc;
+   mp_limb_t ** ii, * ptr, * t1, * t2, * s1, * tt;
+
+   FLINT_ASSERT(n1 <= pre->n1);
+
+   ii = flint_malloc((4*(n + n*size) + 5*size)*sizeof(mp_limb_t));
+   for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size)
+      ii[i] = ptr;
+   t1 = ptr;
+   t2 = t1 + size;
+   s1 = t2 + size;
+   tt = s1 + size;
+
+   j1 = fft_split_bits(ii, i1, n1, bits, limbs);
+   for (i = j1; i < 4*n; i++)
+      flint_mpn_zero(ii[i], size);
+
+   trunc = j1 + pre->j2 - 1;
+   if (trunc <= 2*n) trunc = 2*n + 1;
+
+   fft_convolution_precache(ii, pre->jj, pre->depth, limbs, trunc,
+                                                      &t1, &t2, &s1, &tt);
+
+   flint_mpn_zero(r, n1 + pre->n2);
+   fft_combine_bits(r, ii, j1 + pre->j2 - 1, bits, limbs, n1 + pre->n2);
+
+   flint_free(ii);
+}
@@ -0,0 +1,85 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_precache....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    for (iter = 0; iter < 20 * flint_test_multiplier(); iter++)
+    {
+        flint_mpn_mul_precache_t pre;
+        mp_size_t n1, n2, m1, j;
+        mp_limb_t * i1, * i2, * r1, * r2;
+        slong k;
+
+        n2 = 100 + n_randint(state, 4000);
+        m1 = 100 + n_randint(state, 4000);
+
+        i1 = flint_malloc(3*(m1 + n2)*sizeof(mp_limb_t));
+        i2 = i1 + m1;
+        r1 = i2 + n2;
+        r2 = r1 + m1 + n2;
+
+        flint_mpn_urandomb(i2, state->gmp_state, n2*FLINT_BITS);
+
+        flint_mpn_mul_precache_init(pre, i2, n2, m1);
+
+        /* the same precache is used for several operands of size <= m1 */
+        for (k = 0; k < 3; k++)
+        {
+            n1 = (k == 0) ? m1 : 1 + n_randint(state, m1);
+
+            if (n_randint(state, 2))
+                flint_mpn_urandomb(i1, state->gmp_state, n1*FLINT_BITS);
+            else
+                mpn_random2(i1, n1);
+
+            if (n1 >= n2)
+                mpn_mul(r2, i1, n1, i2, n2);
+            else
+                mpn_mul(r2, i2, n2, i1, n1);
+
+            flint_mpn_mul_precache(r1, i1, n1, pre);
+
+            for (j = 0; j < n1 + n2; j++)
+            {
+                if (r1[j] != r2[j])
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("n1 = %wd, n2 = %wd, m1 = %wd\n", n1, n2, m1);
+                    flint_printf("error in limb %wd, %wx != %wx\n", j, r1[j], r2[j]);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        flint_mpn_mul_precache_clear(pre);
+        flint_free(i1);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -282,6 +282,19 @@ void flint_rand_free(flint_rand_s * state)
 #define FLINT_WARN_UNUSED
 #endif
 
+/*
+    Compile a function for AVX-512 and AVX2 as well as the baseline, the
+    version to run being chosen when the program is loaded. This needs
+    ifunc support, which glibc has but musl, uClibc and Bionic do not.
+*/
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 6 && \
+    defined(__x86_64__) && defined(__GLIBC__) && !defined(__UCLIBC__)
+#define FLINT_TARGET_CLONES \
+    __attribute__((target_clones("arch=skylake-avx512", "avx2", "default")))
+#else
+#define FLINT_TARGET_CLONES
+#endif
+
 #define FLINT_MAX(x, y) ((x) > (y) ? (x) : (y))
 #define FLINT_MIN(x, y) ((x) > (y) ? (y) : (x))
 #define FLINT_ABS(x) ((slong)(x) < 0 ? (-(x)) : (x))
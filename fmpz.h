@@ -56,6 +56,28 @@ typedef struct
 
 typedef fmpz_preinvn_struct fmpz_preinvn_t[1];
 
+typedef struct
+{
+   mp_ptr m;        /* limbs of the odd modulus */
+   mp_size_t n;
+   mp_limb_t minv;  /* -m^(-1) mod 2^FLINT_BITS */
+} fmpz_mont_struct;
+
+typedef fmpz_mont_struct fmpz_mont_t[1];
+
+typedef struct
+{
+   fmpz b;
+   fmpz m;
+   flint_bitcnt_t ebits;
+   slong w;
+   slong len;
+   mp_ptr table;    /* b^(2^(w*j)) in Montgomery form, n limbs each */
+   fmpz_mont_t mont;
+} fmpz_powm_fixed_struct;
+
+typedef fmpz_powm_fixed_struct fmpz_powm_fixed_t[1];
+
 typedef struct
 {
    int count;
@@ -590,6 +612,31 @@ FLINT_DLL void fmpz_powm_ui(fmpz_t f, const fmpz_t g, ulong exp, const fmpz_t m)
 
 FLINT_DLL void fmpz_powm(fmpz_t f, const fmpz_t g, const fmpz_t e, const fmpz_t m);
 
+FLINT_DLL void _fmpz_mont_init(fmpz_mont_t M, const fmpz_t m);
+
+FLINT_DLL void _fmpz_mont_clear(fmpz_mont_t M);
+
+FLINT_DLL void _fmpz_mont_set_fmpz(mp_ptr r, const fmpz_t x,
+                                     const fmpz_t m, const fmpz_mont_t M);
+
+FLINT_DLL void _fmpz_mont_get_fmpz(fmpz_t x, mp_srcptr a,
+                                                      const fmpz_mont_t M);
+
+FLINT_DLL slong _fmpz_powm_window_bits(flint_bitcnt_t bits);
+
+FLINT_DLL ulong _fmpz_powm_digit(const fmpz_t e, flint_bitcnt_t pos, slong w);
+
+FLINT_DLL void fmpz_powm_fixed_init(fmpz_powm_fixed_t P, const fmpz_t b,
+                                      const fmpz_t m, flint_bitcnt_t ebits);
+
+FLINT_DLL void fmpz_powm_fixed_clear(fmpz_powm_fixed_t P);
+
+FLINT_DLL void fmpz_powm_fixed(fmpz_t f, const fmpz_t e,
+                                               const fmpz_powm_fixed_t P);
+
+FLINT_DLL void fmpz_powm_multi(fmpz_t f, const fmpz * b, const fmpz * e,
+                                               slong len, const fmpz_t m);
+
 FLINT_DLL void fmpz_setbit(fmpz_t f, ulong i);
 
 FLINT_DLL int fmpz_tstbit(const fmpz_t f, ulong i);
@@ -744,6 +791,14 @@ FLINT_DLL void fmpz_preinvn_init(fmpz_preinvn_t inv, const fmpz_t f);
 
 FLINT_DLL void fmpz_preinvn_clear(fmpz_preinvn_t inv);
 
+/* fmpz_fdiv_qr_preinvn only uses the inverse for divisors of these sizes
+   in limbs, otherwise it calls mpn_tdiv_qr */
+FMPZ_INLINE
+int _fmpz_preinvn_is_used(mp_size_t n)
+{
+    return n != 2 && (n < 16 || n >= 120);
+}
+
 FLINT_DLL double fmpz_get_d_2exp(slong * exp, const fmpz_t f);
 
 FLINT_DLL void fmpz_set_d_2exp(fmpz_t f, double m, slong exp);
@@ -71,7 +71,7 @@ void _mpz_tdiv_qr_preinvn(mpz_ptr q, mpz_ptr r,
        flint_mpn_divrem_preinvn so we can remove this first 
        case here
     */
-    if (usize2 == 2 || (usize2 > 15 && usize2 < 120)) 
+    if (!_fmpz_preinvn_is_used(usize2))
         mpn_tdiv_qr(qp, rp, 0, ap, usize1, dp, usize2);
     else {
         if (nm) {
@@ -0,0 +1,104 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz.h"
+
+void _fmpz_mont_init(fmpz_mont_t M, const fmpz_t m)
+{
+    mp_limb_t x;
+    int i;
+
+    M->n = fmpz_size(m);
+    M->m = flint_malloc(M->n*sizeof(mp_limb_t));
+    fmpz_get_ui_array(M->m, M->n, m);
+
+    /* m*m = 1 mod 8, and each Newton step doubles the number of bits */
+    x = M->m[0];
+    for (i = 0; i < 5; i++)
+        x *= UWORD(2) - M->m[0] * x;
+
+    M->minv = -x;
+}
+
+void _fmpz_mont_clear(fmpz_mont_t M)
+{
+    flint_free(M->m);
+}
+
+void _fmpz_mont_set_fmpz(mp_ptr r, const fmpz_t x, const fmpz_t m,
+                                                      const fmpz_mont_t M)
+{
+    fmpz_t t;
+
+    fmpz_init(t);
+    fmpz_mul_2exp(t, x, M->n*FLINT_BITS);
+    fmpz_mod(t, t, m);
+    fmpz_get_ui_array(r, M->n, t);
+    fmpz_clear(t);
+}
+
+void _fmpz_mont_get_fmpz(fmpz_t x, mp_srcptr a, const fmpz_mont_t M)
+{
+    mp_ptr t;
+    TMP_INIT;
+
+    TMP_START;
+    t = TMP_ALLOC(3*M->n*sizeof(mp_limb_t));
+
+    flint_mpn_copyi(t, a, M->n);
+    flint_mpn_zero(t + M->n, M->n);
+    flint_mpn_redc(t + 2*M->n, t, M->m, M->n, M->minv);
+    fmpz_set_ui_array(x, t + 2*M->n, M->n);
+
+    TMP_END;
+}
+
+/*
+    Window width for exponents of the given number of bits, minimising
+    bits/w multiplications plus a table of 2^w entries.
+*/
+slong _fmpz_powm_window_bits(flint_bitcnt_t bits)
+{
+    slong w = 1;
+
+    while (w < 16 && (double) bits/(w + 1) + (WORD(1) << (w + 1))
+                   < (double) bits/w + (WORD(1) << w))
+        w++;
+
+    return w;
+}
+
+/* bits pos, ..., pos + w - 1 of e >= 0, where w < FLINT_BITS */
+ulong _fmpz_powm_digit(const fmpz_t e, flint_bitcnt_t pos, slong w)
+{
+    ulong x, mask = (UWORD(1) << w) - 1;
+
+    if (!COEFF_IS_MPZ(*e))
+    {
+        x = (pos >= FLINT_BITS) ? 0 : ((ulong) *e) >> pos;
+    }
+    else
+    {
+        __mpz_struct * z = COEFF_TO_PTR(*e);
+        mp_size_t limb = pos / FLINT_BITS;
+        ulong off = pos % FLINT_BITS;
+
+        if (limb >= z->_mp_size)
+            return 0;
+
+        x = z->_mp_d[limb] >> off;
+        if (off + w > FLINT_BITS && limb + 1 < z->_mp_size)
+            x |= z->_mp_d[limb + 1] << (FLINT_BITS - off);
+    }
+
+    return x & mask;
+}
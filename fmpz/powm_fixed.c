@@ -0,0 +1,143 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz.h"
+
+void fmpz_powm_fixed_init(fmpz_powm_fixed_t P, const fmpz_t b,
+                                       const fmpz_t m, flint_bitcnt_t ebits)
+{
+    mp_size_t n;
+    mp_ptr t;
+    slong j, k;
+
+    if (fmpz_sgn(m) <= 0)
+    {
+        flint_throw(FLINT_ERROR, "Exception in fmpz_powm_fixed_init: "
+                                                  "Modulus is less than 1.\n");
+    }
+
+    fmpz_init(&P->b);
+    fmpz_init_set(&P->m, m);
+    fmpz_mod(&P->b, b, m);
+    P->ebits = ebits;
+    P->w = 1;
+    P->len = 0;
+    P->table = NULL;
+
+    /* even moduli and trivial cases are passed on to fmpz_powm */
+    if (fmpz_is_even(m) || fmpz_is_one(m) || ebits == 0)
+        return;
+
+    _fmpz_mont_init(P->mont, m);
+    n = P->mont->n;
+
+    P->w = _fmpz_powm_window_bits(ebits);
+    P->len = (ebits + P->w - 1) / P->w;
+    P->table = flint_malloc(P->len*n*sizeof(mp_limb_t));
+    t = flint_malloc(2*n*sizeof(mp_limb_t));
+
+    _fmpz_mont_set_fmpz(P->table, &P->b, m, P->mont);
+
+    for (j = 1; j < P->len; j++)
+    {
+        mp_ptr r = P->table + j*n;
+
+        flint_mpn_copyi(r, r - n, n);
+        for (k = 0; k < P->w; k++)
+            flint_mpn_mulmod_redc(r, r, r, P->mont->m, n, P->mont->minv, t);
+    }
+
+    flint_free(t);
+}
+
+void fmpz_powm_fixed_clear(fmpz_powm_fixed_t P)
+{
+    if (P->table != NULL)
+    {
+        flint_free(P->table);
+        _fmpz_mont_clear(P->mont);
+    }
+
+    fmpz_clear(&P->b);
+    fmpz_clear(&P->m);
+}
+
+/*
+    Yao's method: writing e = sum_j d_j 2^(w*j) with digits 0 <= d_j < 2^w,
+    b^e = prod_{d > 0} C_d^d with C_d = prod_{d_j = d} b^(2^(w*j)), which is
+    accumulated for d = 2^w - 1, ..., 1 using no squarings at all.
+*/
+void fmpz_powm_fixed(fmpz_t f, const fmpz_t e, const fmpz_powm_fixed_t P)
+{
+    const fmpz_mont_struct * M = P->mont;
+    mp_size_t n = M->n;
+    mp_ptr A, C, t;
+    ulong * d, v;
+    slong j, len;
+    int A_one, C_one;
+    TMP_INIT;
+
+    if (P->table == NULL || fmpz_sgn(e) < 0 || fmpz_bits(e) > P->ebits)
+    {
+        fmpz_powm(f, &P->b, e, &P->m);
+        return;
+    }
+
+    if (fmpz_is_zero(e))
+    {
+        fmpz_one(f);
+        return;
+    }
+
+    len = (fmpz_bits(e) + P->w - 1) / P->w;
+
+    TMP_START;
+    d = TMP_ALLOC(len*sizeof(ulong));
+    A = TMP_ALLOC(4*n*sizeof(mp_limb_t));
+    C = A + n;
+    t = C + n;
+
+    for (j = 0; j < len; j++)
+        d[j] = _fmpz_powm_digit(e, j*P->w, P->w);
+
+    A_one = C_one = 1;
+
+    for (v = (UWORD(1) << P->w) - 1; v > 0; v--)
+    {
+        for (j = 0; j < len; j++)
+        {
+            if (d[j] != v)
+                continue;
+
+            if (C_one)
+                flint_mpn_copyi(C, P->table + j*n, n);
+            else
+                flint_mpn_mulmod_redc(C, C, P->table + j*n, M->m, n, M->minv, t);
+
+            C_one = 0;
+        }
+
+        if (!C_one)
+        {
+            if (A_one)
+                flint_mpn_copyi(A, C, n);
+            else
+                flint_mpn_mulmod_redc(A, A, C, M->m, n, M->minv, t);
+
+            A_one = 0;
+        }
+    }
+
+    _fmpz_mont_get_fmpz(f, A, M);
+
+    TMP_END;
+}
@@ -0,0 +1,154 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/*
+    Straus' method: one table of 2^w - 1 powers per base, with the
+    squarings shared by all bases. The window is capped to bound the size
+    of the tables.
+*/
+#define POWM_MULTI_MAX_WINDOW 8
+
+void fmpz_powm_multi(fmpz_t f, const fmpz * b, const fmpz * e,
+                                                slong len, const fmpz_t m)
+{
+    fmpz * bases, * exps;
+    fmpz_mont_t M;
+    mp_size_t n;
+    mp_ptr T, A, t;
+    flint_bitcnt_t bits = 0;
+    slong i, j, k, w, tlen, pos;
+    ulong d;
+    int A_one;
+
+    if (fmpz_sgn(m) <= 0)
+    {
+        flint_throw(FLINT_ERROR, "Exception in fmpz_powm_multi: "
+                                                  "Modulus is less than 1.\n");
+    }
+
+    if (fmpz_is_one(m))
+    {
+        fmpz_zero(f);
+        return;
+    }
+
+    if (fmpz_is_even(m))
+    {
+        fmpz_t r, s;
+
+        fmpz_init_set_ui(r, 1);
+        fmpz_init(s);
+
+        for (i = 0; i < len; i++)
+        {
+            fmpz_powm(s, b + i, e + i, m);
+            fmpz_mul(r, r, s);
+            fmpz_mod(r, r, m);
+        }
+
+        fmpz_swap(f, r);
+        fmpz_clear(r);
+        fmpz_clear(s);
+        return;
+    }
+
+    bases = _fmpz_vec_init(len);
+    exps = _fmpz_vec_init(len);
+
+    for (i = k = 0; i < len; i++)
+    {
+        if (fmpz_is_zero(e + i))
+            continue;
+
+        if (fmpz_sgn(e + i) > 0)
+        {
+            fmpz_mod(bases + k, b + i, m);
+        }
+        else if (!fmpz_invmod(bases + k, b + i, m))
+        {
+            _fmpz_vec_clear(bases, len);
+            _fmpz_vec_clear(exps, len);
+            flint_throw(FLINT_ERROR, "Exception in fmpz_powm_multi: "
+                                                 "Base is not invertible.\n");
+        }
+
+        fmpz_abs(exps + k, e + i);
+        bits = FLINT_MAX(bits, fmpz_bits(exps + k));
+        k++;
+    }
+
+    if (k == 0)
+    {
+        fmpz_one(f);
+        _fmpz_vec_clear(bases, len);
+        _fmpz_vec_clear(exps, len);
+        return;
+    }
+
+    _fmpz_mont_init(M, m);
+    n = M->n;
+
+    w = FLINT_MIN(_fmpz_powm_window_bits(bits), POWM_MULTI_MAX_WINDOW);
+    tlen = (WORD(1) << w) - 1;
+
+    T = flint_malloc((k*tlen + 3)*n*sizeof(mp_limb_t));
+    A = T + k*tlen*n;
+    t = A + n;
+
+    /* T[i*tlen + j] = bases[i]^(j + 1) in Montgomery form */
+    for (i = 0; i < k; i++)
+    {
+        mp_ptr Ti = T + i*tlen*n;
+
+        _fmpz_mont_set_fmpz(Ti, bases + i, m, M);
+        for (j = 1; j < tlen; j++)
+            flint_mpn_mulmod_redc(Ti + j*n, Ti + (j - 1)*n, Ti,
+                                                      M->m, n, M->minv, t);
+    }
+
+    A_one = 1;
+
+    for (pos = (bits + w - 1) / w - 1; pos >= 0; pos--)
+    {
+        if (!A_one)
+        {
+            for (j = 0; j < w; j++)
+                flint_mpn_mulmod_redc(A, A, A, M->m, n, M->minv, t);
+        }
+
+        for (i = 0; i < k; i++)
+        {
+            d = _fmpz_powm_digit(exps + i, pos*w, w);
+
+            if (d == 0)
+                continue;
+
+            if (A_one)
+                flint_mpn_copyi(A, T + (i*tlen + d - 1)*n, n);
+            else
+                flint_mpn_mulmod_redc(A, A, T + (i*tlen + d - 1)*n,
+                                                      M->m, n, M->minv, t);
+
+            A_one = 0;
+        }
+    }
+
+    _fmpz_mont_get_fmpz(f, A, M);
+
+    flint_free(T);
+    _fmpz_mont_clear(M);
+    _fmpz_vec_clear(bases, len);
+    _fmpz_vec_clear(exps, len);
+}
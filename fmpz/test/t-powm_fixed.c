@@ -0,0 +1,106 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("powm_fixed....");
+    fflush(stdout);
+
+    /* Compare with fmpz_powm */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c, m, x;
+        fmpz_powm_fixed_t P;
+        flint_bitcnt_t ebits;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+        fmpz_init(m);
+        fmpz_init(x);
+
+        fmpz_randtest(a, state, 300);
+        fmpz_randtest_not_zero(m, state, 300);
+        fmpz_abs(m, m);
+        if (n_randint(state, 4) != 0 && fmpz_is_even(m))
+            fmpz_add_ui(m, m, 1);
+
+        ebits = n_randint(state, 400);
+        fmpz_powm_fixed_init(P, a, m, ebits);
+
+        for (j = 0; j < 10; j++)
+        {
+            fmpz_randtest_unsigned(x, state, ebits + 10);
+            if (n_randint(state, 10) == 0 && fmpz_is_one(m) == 0)
+            {
+                fmpz_t g;
+                fmpz_init(g);
+                fmpz_gcd(g, a, m);
+                if (fmpz_is_one(g))
+                    fmpz_neg(x, x);
+                fmpz_clear(g);
+            }
+
+            fmpz_powm(b, a, x, m);
+            fmpz_powm_fixed(c, x, P);
+
+            result = fmpz_equal(b, c);
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("a = "), fmpz_print(a), flint_printf("\n");
+                flint_printf("m = "), fmpz_print(m), flint_printf("\n");
+                flint_printf("x = "), fmpz_print(x), flint_printf("\n");
+                flint_printf("b = "), fmpz_print(b), flint_printf("\n");
+                flint_printf("c = "), fmpz_print(c), flint_printf("\n");
+                fflush(stdout);
+                flint_abort();
+            }
+
+            /* aliasing of result and exponent */
+            fmpz_powm_fixed(x, x, P);
+
+            result = fmpz_equal(b, x);
+            if (!result)
+            {
+                flint_printf("FAIL (alias):\n");
+                flint_printf("a = "), fmpz_print(a), flint_printf("\n");
+                flint_printf("m = "), fmpz_print(m), flint_printf("\n");
+                flint_printf("b = "), fmpz_print(b), flint_printf("\n");
+                flint_printf("x = "), fmpz_print(x), flint_printf("\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fmpz_powm_fixed_clear(P);
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+        fmpz_clear(m);
+        fmpz_clear(x);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("powm_multi....");
+    fflush(stdout);
+
+    /* Compare with a product of fmpz_powm */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz * b, * e;
+        fmpz_t m, r, s, t;
+        slong j, len;
+
+        len = n_randint(state, 6);
+        b = _fmpz_vec_init(len);
+        e = _fmpz_vec_init(len);
+
+        fmpz_init(m);
+        fmpz_init(r);
+        fmpz_init(s);
+        fmpz_init(t);
+
+        fmpz_randtest_not_zero(m, state, 300);
+        fmpz_abs(m, m);
+        if (n_randint(state, 4) != 0 && fmpz_is_even(m))
+            fmpz_add_ui(m, m, 1);
+
+        fmpz_one(r);
+        fmpz_mod(r, r, m);
+
+        for (j = 0; j < len; j++)
+        {
+            fmpz_randtest(b + j, state, 300);
+            fmpz_randtest_unsigned(e + j, state, n_randint(state, 500));
+
+            if (n_randint(state, 4) == 0)
+            {
+                fmpz_gcd(t, b + j, m);
+                if (fmpz_is_one(t))
+                    fmpz_neg(e + j, e + j);
+            }
+
+            fmpz_powm(t, b + j, e + j, m);
+            fmpz_mul(r, r, t);
+            fmpz_mod(r, r, m);
+        }
+
+        fmpz_powm_multi(s, b, e, len, m);
+
+        result = fmpz_equal(r, s);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("len = %wd\n", len);
+            flint_printf("m = "), fmpz_print(m), flint_printf("\n");
+            flint_printf("r = "), fmpz_print(r), flint_printf("\n");
+            flint_printf("s = "), fmpz_print(s), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* aliasing of result and a base */
+        if (len > 0)
+        {
+            fmpz_powm_multi(b + 0, b, e, len, m);
+
+            result = fmpz_equal(r, b + 0);
+            if (!result)
+            {
+                flint_printf("FAIL (alias):\n");
+                flint_printf("m = "), fmpz_print(m), flint_printf("\n");
+                flint_printf("r = "), fmpz_print(r), flint_printf("\n");
+                flint_printf("b = "), fmpz_print(b + 0), flint_printf("\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        _fmpz_vec_clear(b, len);
+        _fmpz_vec_clear(e, len);
+
+        fmpz_clear(m);
+        fmpz_clear(r);
+        fmpz_clear(s);
+        fmpz_clear(t);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
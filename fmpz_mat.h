@@ -259,6 +259,13 @@ FLINT_DLL void _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
 FLINT_DLL void fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
                                                            const fmpz_mat_t B);
 
+FLINT_DLL void _fmpz_mat_mul_multi_mod_bounded(fmpz_mat_t C,
+                         const fmpz_mat_t A, const fmpz_mat_t B, int sign,
+                                      flint_bitcnt_t Cbits, ulong max_bytes);
+
+FLINT_DLL void fmpz_mat_mul_multi_mod_bounded(fmpz_mat_t C,
+                     const fmpz_mat_t A, const fmpz_mat_t B, ulong max_bytes);
+
 FLINT_DLL int _fmpz_mat_mul_blas(fmpz_mat_t C,
                                     const fmpz_mat_t A, flint_bitcnt_t Abits,
                                     const fmpz_mat_t B, flint_bitcnt_t Bbits,
@@ -30,14 +30,43 @@ next_good_prime(const fmpz_t d, mp_limb_t p)
 }
 
 
+/* below this size the determinants modulo the primes are not threaded */
+#define DET_MODULAR_THREAD_CUTOFF 16
+
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    const fmpz * d;
+    nmod_mat_struct * Amod;
+    mp_ptr primes;
+    mp_ptr xmod;
+}
+_det_worker_arg;
+
+/* xmod[i] = det(A) / d mod primes[i], each item with its own Amod */
+static void
+_det_worker(slong i, _det_worker_arg * arg)
+{
+    nmod_mat_struct * Amod = arg->Amod + i;
+    mp_limb_t p = arg->primes[i], x;
+
+    _nmod_mat_set_mod(Amod, p);
+    fmpz_mat_get_nmod_mat(Amod, arg->A);
+
+    x = _nmod_mat_det(Amod);
+    arg->xmod[i] = n_mulmod2_preinv(x,
+        n_invmod(fmpz_fdiv_ui(arg->d, p), p), Amod->mod.n, Amod->mod.ninv);
+}
+
 void
 fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     const fmpz_t d, int proved)
 {
     fmpz_t bound, prod, stable_prod, x, xnew;
-    mp_limb_t p, xmod;
-    nmod_mat_t Amod;
-    slong n = A->r;
+    mp_limb_t p;
+    _det_worker_arg arg;
+    slong i, num, n = A->r;
+    int done;
 
     if (n == 0)
     {
@@ -62,7 +91,24 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     fmpz_mul_ui(bound, bound, UWORD(2));  /* accomodate sign */
     fmpz_cdiv_q(bound, bound, d);
 
-    nmod_mat_init(Amod, n, n, 2);
+    /*
+        The determinants are computed a round of num primes at a time, one
+        prime per thread, each writing its own slot of xmod. They are then
+        added to the CRT in order of the primes, so that the result and the
+        early termination do not depend on the number of threads; at most
+        num - 1 determinants of the last round go unused.
+    */
+    num = (n < DET_MODULAR_THREAD_CUTOFF) ? 1 : flint_get_num_threads();
+
+    arg.A = A;
+    arg.d = d;
+    arg.Amod = FLINT_ARRAY_ALLOC(num, nmod_mat_struct);
+    arg.primes = FLINT_ARRAY_ALLOC(num, mp_limb_t);
+    arg.xmod = FLINT_ARRAY_ALLOC(num, mp_limb_t);
+
+    for (i = 0; i < num; i++)
+        nmod_mat_init(arg.Amod + i, n, n, 2);
+
     fmpz_zero(x);
     fmpz_one(prod);
 
@@ -73,38 +119,50 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
 #endif
 
     /* Compute x = det(A) / d */
-    while (fmpz_cmp(prod, bound) <= 0)
+    done = (fmpz_cmp(prod, bound) > 0);
+    while (!done)
     {
-        p = next_good_prime(d, p);
-        _nmod_mat_set_mod(Amod, p);
-        fmpz_mat_get_nmod_mat(Amod, A);
-
-        /* Compute x = det(A) / d mod p */
-        xmod = _nmod_mat_det(Amod);
-        xmod = n_mulmod2_preinv(xmod,
-            n_invmod(fmpz_fdiv_ui(d, p), p), Amod->mod.n, Amod->mod.ninv);
-
-        fmpz_CRT_ui(xnew, x, prod, xmod, p, 1);
-
-        if (fmpz_equal(xnew, x))
+        for (i = 0; i < num; i++)
         {
-            fmpz_mul_ui(stable_prod, stable_prod, p);
-            if (!proved && fmpz_bits(stable_prod) > 100)
-                break;
+            p = next_good_prime(d, p);
+            arg.primes[i] = p;
         }
-        else
+
+        flint_parallel_do((do_func_t) _det_worker, &arg, num, num,
+                                                      FLINT_PARALLEL_UNIFORM);
+
+        for (i = 0; i < num && !done; i++)
         {
-            fmpz_set_ui(stable_prod, p);
+            fmpz_CRT_ui(xnew, x, prod, arg.xmod[i], arg.primes[i], 1);
+
+            if (fmpz_equal(xnew, x))
+            {
+                fmpz_mul_ui(stable_prod, stable_prod, arg.primes[i]);
+                if (!proved && fmpz_bits(stable_prod) > 100)
+                    done = 1;
+            }
+            else
+            {
+                fmpz_set_ui(stable_prod, arg.primes[i]);
+            }
+
+            fmpz_mul_ui(prod, prod, arg.primes[i]);
+            fmpz_set(x, xnew);
+
+            if (fmpz_cmp(prod, bound) > 0)
+                done = 1;
         }
-
-        fmpz_mul_ui(prod, prod, p);
-        fmpz_set(x, xnew);
     }
 
     /* det(A) = x * d */
     fmpz_mul(det, x, d);
 
-    nmod_mat_clear(Amod);
+    for (i = 0; i < num; i++)
+        nmod_mat_clear(arg.Amod + i);
+
+    flint_free(arg.Amod);
+    flint_free(arg.primes);
+    flint_free(arg.xmod);
     fmpz_clear(bound);
     fmpz_clear(prod);
     fmpz_clear(stable_prod);
@@ -33,6 +33,10 @@ typedef struct {
     slong num_primes;
     mp_ptr primes;
     int sign;
+    const fmpz * Mprev;     /* modulus of the primes already in C, or NULL */
+    const fmpz * Mgroup;    /* product of the primes of this group */
+    const fmpz * Minv;      /* Mprev^(-1) mod Mgroup */
+    const fmpz * M;         /* Mprev Mgroup if the result is signed, or NULL */
 } _worker_arg;
 
 
@@ -100,6 +104,28 @@ static void _mod_worker(void * varg)
     }
 }
 
+/*
+    Given 0 <= x < Mprev and 0 <= r < Mgroup, sets x to the integer
+    congruent to x mod Mprev and r mod Mgroup, either in [0, M) or in
+    the symmetric range if arg->M is set.
+*/
+static void _crt_combine(fmpz_t x, const fmpz_t r, const _worker_arg * arg,
+                                                                   fmpz_t t)
+{
+    fmpz_mod(t, x, arg->Mgroup);
+    fmpz_sub(t, r, t);
+    fmpz_mul(t, t, arg->Minv);
+    fmpz_mod(t, t, arg->Mgroup);
+    fmpz_addmul(x, t, arg->Mprev);
+
+    if (arg->M != NULL)
+    {
+        fmpz_mul_2exp(t, x, 1);
+        if (fmpz_cmp(t, arg->M) > 0)
+            fmpz_sub(x, x, arg->M);
+    }
+}
+
 static void _crt_worker(void * varg)
 {
     _worker_arg * arg = (_worker_arg *) varg;
@@ -112,10 +138,16 @@ static void _crt_worker(void * varg)
     mp_limb_t * primes = arg->primes;
     slong num_primes = arg->num_primes;
     const fmpz_comb_struct * comb = arg->comb;
+    const fmpz * Mprev = arg->Mprev;
     int sign = arg->sign;
+    fmpz * c;
+    fmpz_t res, tmp;
 
     FLINT_ASSERT(sign == 0 || sign == 1);
 
+    fmpz_init(res);
+    fmpz_init(tmp);
+
     if (comb != NULL)
     {
         mp_limb_t * residues;
@@ -127,10 +159,15 @@ static void _crt_worker(void * varg)
         for (i = Cstartrow; i < Cstoprow; i++)
         for (j = 0; j < n; j++)
         {
+            c = (Mprev == NULL) ? &Crows[i][j] : res;
+
             for (l = 0; l < num_primes; l++)
                 residues[l] = mod_C[l]->rows[i][j];
 
-            fmpz_multi_CRT_ui(&Crows[i][j], residues, comb, comb_temp, sign);
+            fmpz_multi_CRT_ui(c, residues, comb, comb_temp, sign);
+
+            if (Mprev != NULL)
+                _crt_combine(&Crows[i][j], res, arg, tmp);
         }
 
         flint_free(residues);
@@ -145,12 +182,17 @@ static void _crt_worker(void * varg)
             for (i = Cstartrow; i < Cstoprow; i++)
             for (j = 0; j < n; j++)
             {
+                c = (Mprev == NULL) ? &Crows[i][j] : res;
+
                 r = nmod_mat_entry(mod_C[0], i, j);
                 t = p - r;
                 if (t < r)
-                    fmpz_neg_ui(&Crows[i][j], t);
+                    fmpz_neg_ui(c, t);
                 else
-                    fmpz_set_ui(&Crows[i][j], r);
+                    fmpz_set_ui(c, r);
+
+                if (Mprev != NULL)
+                    _crt_combine(&Crows[i][j], res, arg, tmp);
             }
         }
         else
@@ -158,8 +200,13 @@ static void _crt_worker(void * varg)
             for (i = Cstartrow; i < Cstoprow; i++)
             for (j = 0; j < n; j++)
             {
+                c = (Mprev == NULL) ? &Crows[i][j] : res;
+
                 r = nmod_mat_entry(mod_C[0], i, j);
-                fmpz_set_ui(&Crows[i][j], r);
+                fmpz_set_ui(c, r);
+
+                if (Mprev != NULL)
+                    _crt_combine(&Crows[i][j], res, arg, tmp);
             }
         }
     }
@@ -175,6 +222,8 @@ static void _crt_worker(void * varg)
         for (i = Cstartrow; i < Cstoprow; i++)
         for (j = 0; j < n; j++)
         {
+            c = (Mprev == NULL) ? &Crows[i][j] : res;
+
             r0 = nmod_mul(i0, nmod_mat_entry(mod_C[0], i, j), mod_C[0]->mod);
             r1 = nmod_mul(i1, nmod_mat_entry(mod_C[1], i, j), mod_C[1]->mod);
 
@@ -200,14 +249,17 @@ static void _crt_worker(void * varg)
             {
                 sub_ddmmss(u[1], u[0], M[1], M[0], t[1], t[0]);
                 if (u[1] < t[1] || (u[1] == t[1] && u[0] < t[0]))
-                    fmpz_neg_uiui(&Crows[i][j], u[1], u[0]);
+                    fmpz_neg_uiui(c, u[1], u[0]);
                 else
-                    fmpz_set_uiui(&Crows[i][j], t[1], t[0]);
+                    fmpz_set_uiui(c, t[1], t[0]);
             }
             else
             {
-                fmpz_set_uiui(&Crows[i][j], t[1], t[0]);
+                fmpz_set_uiui(c, t[1], t[0]);
             }
+
+            if (Mprev != NULL)
+                _crt_combine(&Crows[i][j], res, arg, tmp);
         }
     }
     else
@@ -250,6 +302,8 @@ static void _crt_worker(void * varg)
         for (i = Cstartrow; i < Cstoprow; i++)
         for (j = 0; j < n; j++)
         {
+            c = (Mprev == NULL) ? &Crows[i][j] : res;
+
             ri = nmod_mat_entry(mod_C[0], i, j);
             FLINT_ASSERT(Nsize > 1);
             T[Nsize - 1] = mpn_mul_1(T, Ns, Nsize - 1, ri);
@@ -264,13 +318,16 @@ static void _crt_worker(void * varg)
 
             if (sign && (mpn_sub_n(U, M, T, Msize), mpn_cmp(U, T, Msize) < 0))
             {
-                fmpz_set_ui_array(&Crows[i][j], U, Msize);
-                fmpz_neg(&Crows[i][j], &Crows[i][j]);
+                fmpz_set_ui_array(c, U, Msize);
+                fmpz_neg(c, c);
             }
             else
             {
-                fmpz_set_ui_array(&Crows[i][j], T, Msize);
+                fmpz_set_ui_array(c, T, Msize);
             }
+
+            if (Mprev != NULL)
+                _crt_combine(&Crows[i][j], res, arg, tmp);
         }
 
         flint_free(M);
@@ -278,15 +335,19 @@ static void _crt_worker(void * varg)
         flint_free(T);
         flint_free(U);
     }
+
+    fmpz_clear(res);
+    fmpz_clear(tmp);
 }
 
 
-void _fmpz_mat_mul_multi_mod(
+void _fmpz_mat_mul_multi_mod_bounded(
     fmpz_mat_t C,
     const fmpz_mat_t A,
     const fmpz_mat_t B,
     int sign,
-    flint_bitcnt_t bits)
+    flint_bitcnt_t bits,
+    ulong max_bytes)
 {
     slong i, start, stop;
     slong m, k, n;
@@ -298,6 +359,9 @@ void _fmpz_mat_mul_multi_mod(
     thread_pool_handle * handles;
     slong limit;
     ulong first_prime; /* not prime */
+    slong num_primes, group, g0;
+    mp_ptr primes;
+    fmpz_t Mprev, Mgroup, Minv, M;
 
     mainarg.m = m = A->r;
     mainarg.k = k = A->c;
@@ -320,160 +384,232 @@ void _fmpz_mat_mul_multi_mod(
 
     if (bits < primes_bits || bits <= FLINT_BITS - 1)
     {
-        mainarg.num_primes = 1;
+        num_primes = 1;
         first_prime = UWORD(1) << bits;
     }
     else
     {
         /* Round up in the division */
-        mainarg.num_primes = 1 + (bits - (FLINT_BITS - 1) + primes_bits - 1)/primes_bits;
+        num_primes = 1 + (bits - (FLINT_BITS - 1) + primes_bits - 1)/primes_bits;
         first_prime = UWORD(1) << (FLINT_BITS - 1);
     }
 
     /* Initialize */
-    mainarg.sign = sign;
-    mainarg.primes = FLINT_ARRAY_ALLOC(mainarg.num_primes, mp_limb_t);
-    mainarg.primes[0] = first_prime;
-    if (mainarg.num_primes > 1)
+    primes = FLINT_ARRAY_ALLOC(num_primes, mp_limb_t);
+    primes[0] = first_prime;
+    if (num_primes > 1)
     {
-        mainarg.primes[1] = n_nextprime(UWORD(1) << primes_bits, 0);
-        for (i = 2; i < mainarg.num_primes; i++)
-            mainarg.primes[i] = n_nextprime(mainarg.primes[i-1], 0);
+        primes[1] = n_nextprime(UWORD(1) << primes_bits, 0);
+        for (i = 2; i < num_primes; i++)
+            primes[i] = n_nextprime(primes[i-1], 0);
     }
 
-    mainarg.mod_A = FLINT_ARRAY_ALLOC(mainarg.num_primes, nmod_mat_t);
-    mainarg.mod_B = FLINT_ARRAY_ALLOC(mainarg.num_primes, nmod_mat_t);
-    mainarg.mod_C = FLINT_ARRAY_ALLOC(mainarg.num_primes, nmod_mat_t);
-    for (i = 0; i < mainarg.num_primes; i++)
+    /*
+        Number of primes handled at a time. Each prime of a group costs the
+        residues of A, B and C, plus about as much again for the residues
+        of C as an integer, which are merged into C when a group is done.
+    */
+    group = num_primes;
+    if (max_bytes != 0)
     {
-        nmod_mat_init(mainarg.mod_A[i], A->r, A->c, mainarg.primes[i]);
-        nmod_mat_init(mainarg.mod_B[i], B->r, B->c, mainarg.primes[i]);
-        nmod_mat_init(mainarg.mod_C[i], C->r, C->c, mainarg.primes[i]);
-    }
+        ulong per_prime = (m*k + k*n + 2*m*n)*sizeof(mp_limb_t);
 
-    /* TUNING */
-    if (mainarg.num_primes > 200)
-    {
-        /* use comb */
-        fmpz_comb_init(comb, mainarg.primes, mainarg.num_primes);
-        mainarg.comb = comb;
-    }
-    else
-    {
-        /* don't use comb */
-        mainarg.comb = NULL;
+        group = FLINT_MAX(max_bytes/per_prime, 1);
+        group = FLINT_MIN(group, num_primes);
     }
 
-    /* limit on the number of threads */
-    limit = ((m + k + n)/128)*(1 + bits/1024);
-    limit = FLINT_MIN(limit, (m + k)/4);
+    mainarg.mod_A = FLINT_ARRAY_ALLOC(group, nmod_mat_t);
+    mainarg.mod_B = FLINT_ARRAY_ALLOC(group, nmod_mat_t);
+    mainarg.mod_C = FLINT_ARRAY_ALLOC(group, nmod_mat_t);
 
-    /* mod */
-    if (limit < 2)
-    {
-mod_single:
-        mainarg.Astartrow = 0;
-        mainarg.Astoprow = m;
-        mainarg.Bstartrow = 0;
-        mainarg.Bstoprow = k;
-        _mod_worker(&mainarg);
-    }
-    else
+    fmpz_init(Mprev);
+    fmpz_init(Mgroup);
+    fmpz_init(Minv);
+    fmpz_init(M);
+
+    for (g0 = 0; g0 < num_primes; g0 += group)
     {
-        num_workers = flint_request_threads(&handles, limit);
-        if (num_workers < 1)
+        mainarg.primes = primes + g0;
+        mainarg.num_primes = FLINT_MIN(group, num_primes - g0);
+
+        /* only the last group makes the result signed */
+        mainarg.sign = (group == num_primes) ? sign : 0;
+        mainarg.Mprev = NULL;
+        mainarg.M = NULL;
+
+        for (i = 0; i < mainarg.num_primes; i++)
         {
-            flint_give_back_threads(handles, num_workers);
-            goto mod_single;
+            nmod_mat_init(mainarg.mod_A[i], A->r, A->c, mainarg.primes[i]);
+            nmod_mat_init(mainarg.mod_B[i], B->r, B->c, mainarg.primes[i]);
+            nmod_mat_init(mainarg.mod_C[i], C->r, C->c, mainarg.primes[i]);
         }
 
-        args = FLINT_ARRAY_ALLOC(num_workers, _worker_arg);
-        for (start = 0, i = 0; i < num_workers; start = stop, i++)
+        /* TUNING */
+        if (mainarg.num_primes > 200)
         {
-            args[i] = mainarg;
-            stop = _thread_pool_find_work_2(m, k, k, n, i + 1, num_workers + 1);
-            _thread_pool_distribute_work_2(start, stop,
+            /* use comb */
+            fmpz_comb_init(comb, mainarg.primes, mainarg.num_primes);
+            mainarg.comb = comb;
+        }
+        else
+        {
+            /* don't use comb */
+            mainarg.comb = NULL;
+        }
+
+        /* limit on the number of threads */
+        limit = ((m + k + n)/128)*(1 + bits/1024);
+        limit = FLINT_MIN(limit, (m + k)/4);
+
+        /* mod */
+        if (limit < 2)
+        {
+mod_single:
+            mainarg.Astartrow = 0;
+            mainarg.Astoprow = m;
+            mainarg.Bstartrow = 0;
+            mainarg.Bstoprow = k;
+            _mod_worker(&mainarg);
+        }
+        else
+        {
+            num_workers = flint_request_threads(&handles, limit);
+            if (num_workers < 1)
+            {
+                flint_give_back_threads(handles, num_workers);
+                goto mod_single;
+            }
+
+            args = FLINT_ARRAY_ALLOC(num_workers, _worker_arg);
+            for (start = 0, i = 0; i < num_workers; start = stop, i++)
+            {
+                args[i] = mainarg;
+                stop = _thread_pool_find_work_2(m, k, k, n, i + 1, num_workers + 1);
+                _thread_pool_distribute_work_2(start, stop,
                                      &args[i].Astartrow, &args[i].Astoprow, m,
                                      &args[i].Bstartrow, &args[i].Bstoprow, k);
-        }
+            }
 
-        _thread_pool_distribute_work_2(start, m + k,
+            _thread_pool_distribute_work_2(start, m + k,
                                      &mainarg.Astartrow, &mainarg.Astoprow, m,
                                      &mainarg.Bstartrow, &mainarg.Bstoprow, k);
 
-        for (i = 0; i < num_workers; i++)
-            thread_pool_wake(global_thread_pool, handles[i], 0, _mod_worker, &args[i]);
-        _mod_worker(&mainarg);
-        for (i = 0; i < num_workers; i++)
-            thread_pool_wait(global_thread_pool, handles[i]);
+            for (i = 0; i < num_workers; i++)
+                thread_pool_wake(global_thread_pool, handles[i], 0, _mod_worker, &args[i]);
+            _mod_worker(&mainarg);
+            for (i = 0; i < num_workers; i++)
+                thread_pool_wait(global_thread_pool, handles[i]);
 
-        flint_give_back_threads(handles, num_workers);
-        flint_free(args);
-    }
+            flint_give_back_threads(handles, num_workers);
+            flint_free(args);
+        }
+
+        /* mul */
+        for (i = 0; i < mainarg.num_primes; i++)
+        {
+            nmod_mat_mul(mainarg.mod_C[i], mainarg.mod_A[i], mainarg.mod_B[i]);
+            nmod_mat_clear(mainarg.mod_A[i]);
+            nmod_mat_clear(mainarg.mod_B[i]);
+        }
 
-    /* mul */
-    for (i = 0; i < mainarg.num_primes; i++)
-        nmod_mat_mul(mainarg.mod_C[i], mainarg.mod_A[i], mainarg.mod_B[i]);
+        /* C = C mod Mprev combined with C mod Mgroup */
+        if (g0 > 0)
+        {
+            fmpz_one(Mgroup);
+            for (i = 0; i < mainarg.num_primes; i++)
+                fmpz_mul_ui(Mgroup, Mgroup, mainarg.primes[i]);
 
+            fmpz_invmod(Minv, Mprev, Mgroup);
 
-    /* limit on the number of threads */
-    limit = ((m + n)/64)*(1 + bits/1024);
-    limit = FLINT_MIN(limit, m/2);
+            mainarg.Mprev = Mprev;
+            mainarg.Mgroup = Mgroup;
+            mainarg.Minv = Minv;
 
-    /* crt */
-    if (limit < 2)
-    {
+            if (sign && g0 + mainarg.num_primes == num_primes)
+            {
+                fmpz_mul(M, Mprev, Mgroup);
+                mainarg.M = M;
+            }
+        }
+
+        /* limit on the number of threads */
+        limit = ((m + n)/64)*(1 + bits/1024);
+        limit = FLINT_MIN(limit, m/2);
+
+        /* crt */
+        if (limit < 2)
+        {
 crt_single:
-        mainarg.Cstartrow = 0;
-        mainarg.Cstoprow = m;
-        _crt_worker(&mainarg);
-    }
-    else
-    {
-        num_workers = flint_request_threads(&handles, limit);
-        if (num_workers < 1)
+            mainarg.Cstartrow = 0;
+            mainarg.Cstoprow = m;
+            _crt_worker(&mainarg);
+        }
+        else
         {
+            num_workers = flint_request_threads(&handles, limit);
+            if (num_workers < 1)
+            {
+                flint_give_back_threads(handles, num_workers);
+                goto crt_single;
+            }
+
+            args = FLINT_ARRAY_ALLOC(num_workers, _worker_arg);
+            for (start = 0, i = 0; i < num_workers; start = stop, i++)
+            {
+                args[i] = mainarg;
+                stop = (i + 1)*m/(num_workers + 1);
+                args[i].Cstartrow = start;
+                args[i].Cstoprow = stop;
+            }
+
+            mainarg.Cstartrow = start;
+            mainarg.Cstoprow = m;
+
+            for (i = 0; i < num_workers; i++)
+                thread_pool_wake(global_thread_pool, handles[i], 0, _crt_worker, &args[i]);
+            _crt_worker(&mainarg);
+            for (i = 0; i < num_workers; i++)
+                thread_pool_wait(global_thread_pool, handles[i]);
+
             flint_give_back_threads(handles, num_workers);
-            goto crt_single;
+            flint_free(args);
         }
 
-        args = FLINT_ARRAY_ALLOC(num_workers, _worker_arg);
-        for (start = 0, i = 0; i < num_workers; start = stop, i++)
+        if (group < num_primes)
         {
-            args[i] = mainarg;
-            stop = (i + 1)*m/(num_workers + 1);
-            args[i].Cstartrow = start;
-            args[i].Cstoprow = stop;
+            if (g0 == 0)
+                fmpz_one(Mprev);
+            for (i = 0; i < mainarg.num_primes; i++)
+                fmpz_mul_ui(Mprev, Mprev, mainarg.primes[i]);
         }
 
-        mainarg.Cstartrow = start;
-        mainarg.Cstoprow = m;
-
-        for (i = 0; i < num_workers; i++)
-            thread_pool_wake(global_thread_pool, handles[i], 0, _crt_worker, &args[i]);
-        _crt_worker(&mainarg);
-        for (i = 0; i < num_workers; i++)
-            thread_pool_wait(global_thread_pool, handles[i]);
+        /* Cleanup */
+        if (mainarg.comb != NULL)
+            fmpz_comb_clear(comb);
 
-        flint_give_back_threads(handles, num_workers);
-        flint_free(args);
+        for (i = 0; i < mainarg.num_primes; i++)
+            nmod_mat_clear(mainarg.mod_C[i]);
     }
 
-    /* Cleanup */
-    if (mainarg.comb != NULL)
-        fmpz_comb_clear(comb);
-
-    for (i = 0; i < mainarg.num_primes; i++)
-    {
-        nmod_mat_clear(mainarg.mod_A[i]);
-        nmod_mat_clear(mainarg.mod_B[i]);
-        nmod_mat_clear(mainarg.mod_C[i]);
-    }
+    fmpz_clear(Mprev);
+    fmpz_clear(Mgroup);
+    fmpz_clear(Minv);
+    fmpz_clear(M);
 
     flint_free(mainarg.mod_A);
     flint_free(mainarg.mod_B);
     flint_free(mainarg.mod_C);
-    flint_free(mainarg.primes);
+    flint_free(primes);
+}
+
+void _fmpz_mat_mul_multi_mod(
+    fmpz_mat_t C,
+    const fmpz_mat_t A,
+    const fmpz_mat_t B,
+    int sign,
+    flint_bitcnt_t bits)
+{
+    _fmpz_mat_mul_multi_mod_bounded(C, A, B, sign, bits, 0);
 }
 
 void
@@ -503,3 +639,30 @@ fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
     _fmpz_mat_mul_multi_mod(C, A, B, sign, Cbits);
 }
 
+void
+fmpz_mat_mul_multi_mod_bounded(fmpz_mat_t C, const fmpz_mat_t A,
+                                         const fmpz_mat_t B, ulong max_bytes)
+{
+    slong Abits, Bbits;
+    int sign = 0;
+    flint_bitcnt_t Cbits;
+
+    Abits = fmpz_mat_max_bits(A);
+    Bbits = fmpz_mat_max_bits(B);
+
+    if (Abits < 0)
+    {
+        sign = 1;
+        Abits = -Abits;
+    }
+
+    if (Bbits < 0)
+    {
+        sign = 1;
+        Bbits = -Bbits;
+    }
+
+    Cbits = Abits + Bbits + FLINT_BIT_COUNT(A->c);
+
+    _fmpz_mat_mul_multi_mod_bounded(C, A, B, sign, Cbits, max_bytes);
+}
@@ -88,6 +88,49 @@ main(void)
         fmpz_clear(det2);
     }
 
+    /* Large enough to compute the determinants mod p in parallel */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        int proved = n_randlimb(state) % 2;
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        m = 16 + n_randint(state, 20);
+
+        fmpz_mat_init(A, m, m);
+        fmpz_init(det1);
+        fmpz_init(det2);
+
+        if (n_randint(state, 4) == 0)
+        {
+            fmpz_mat_randrank(A, state, 1 + n_randint(state, m - 1),
+                                        1 + n_randint(state, 10));
+            fmpz_mat_randops(A, state, n_randint(state, 2*m*m + 1));
+        }
+        else
+        {
+            fmpz_mat_randtest(A, state, 1 + n_randint(state, 100));
+        }
+
+        fmpz_mat_det_bareiss(det1, A);
+        fmpz_mat_det_modular(det2, A, proved);
+
+        if (!fmpz_equal(det1, det2))
+        {
+            flint_printf("FAIL (threaded):\n");
+            flint_printf("different determinants!\n");
+            fmpz_mat_print_pretty(A), flint_printf("\n");
+            flint_printf("det1: "), fmpz_print(det1), flint_printf("\n");
+            flint_printf("det2: "), fmpz_print(det2), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_clear(det1);
+        fmpz_clear(det2);
+        fmpz_mat_clear(A);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
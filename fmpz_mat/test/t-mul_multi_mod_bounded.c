@@ -0,0 +1,99 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mat.h"
+
+int main(void)
+{
+    fmpz_mat_t A, B, C, D;
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_multi_mod_bounded....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        slong m, n, k, bits;
+        ulong per_prime, max_bytes;
+        int sign;
+
+        if (n_randint(state, 4) == 0)
+        {
+            m = n_randint(state, 4);
+            n = n_randint(state, 4);
+            k = n_randint(state, 4);
+            bits = n_randint(state, 20000) + 1;
+        }
+        else
+        {
+            m = n_randint(state, 30);
+            n = n_randint(state, 30);
+            k = n_randint(state, 30);
+            bits = n_randint(state, 1000) + 1;
+        }
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, n, k);
+        fmpz_mat_init(C, m, k);
+        fmpz_mat_init(D, m, k);
+
+        sign = n_randint(state, 2);
+
+        if (sign)
+        {
+            fmpz_mat_randtest(A, state, bits);
+            fmpz_mat_randtest(B, state, n_randint(state, bits) + 1);
+        }
+        else
+        {
+            fmpz_mat_randtest_unsigned(A, state, bits);
+            fmpz_mat_randtest_unsigned(B, state, n_randint(state, bits) + 1);
+        }
+
+        /* from a single prime per group to all primes at once */
+        per_prime = (m*n + n*k + 2*m*k)*sizeof(mp_limb_t);
+        if (n_randint(state, 3) == 0)
+            max_bytes = 0;
+        else if (n_randint(state, 2))
+            max_bytes = per_prime*(n_randint(state, 10) + 1);
+        else
+            max_bytes = per_prime*(n_randint(state, 400) + 1);
+
+        /* Make sure noise in the output is ok */
+        fmpz_mat_randtest(D, state, n_randint(state, 200) + 1);
+
+        fmpz_mat_mul_classical_inline(C, A, B);
+
+        if (n_randint(state, 2))
+            fmpz_mat_mul_multi_mod_bounded(D, A, B, max_bytes);
+        else
+            _fmpz_mat_mul_multi_mod_bounded(D, A, B, sign,
+                            FLINT_ABS(fmpz_mat_max_bits(C)), max_bytes);
+
+        if (!fmpz_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal\n");
+            flint_printf("m = %wd, n = %wd, k = %wd, max_bytes = %wu\n",
+                                                        m, n, k, max_bytes);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(D);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -28,6 +28,7 @@
 
 #include "flint.h"
 #include "fmpz.h"
+#include "mpn_extras.h"
 #include "fmpz_poly.h"
 #include "fmpz_mod.h"
 #include "fmpz_mat.h"
@@ -38,6 +39,7 @@
 #endif
 
 #define FMPZ_MOD_POLY_HGCD_CUTOFF  128      /* HGCD: Basecase -> Recursion      */
+#define FMPZ_MOD_POLY_HGCD_THREAD_CUTOFF 250 /* HGCD: threaded products      */
 #define FMPZ_MOD_POLY_GCD_CUTOFF  256       /* GCD:  Euclidean -> HGCD          */
 
 #define FMPZ_MOD_POLY_INV_NEWTON_CUTOFF  64 /* Inv series newton: Basecase -> Newton */
@@ -584,6 +586,45 @@ FLINT_DLL void fmpz_mod_poly_powmod_x_fmpz_preinv(fmpz_mod_poly_t res,
          const fmpz_t e, const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv,
                                                      const fmpz_mod_ctx_t ctx);
 
+#define FMPZ_MOD_POLY_POWMOD_PRECOMP_CUTOFF 4000 /* limbs of packed f from
+                                                    which transforms are cached */
+
+typedef struct
+{
+    fmpz * f;
+    slong lenf;
+    fmpz * finv;
+    slong lenfinv;
+    fmpz_t p;
+    flint_bitcnt_t bits;   /* Kronecker substitution bits, 0 if no cache */
+    flint_mpn_mul_precache_t fpre;
+    flint_mpn_mul_precache_t finvpre;
+    slong transforms_saved;
+} fmpz_mod_poly_powmod_precomp_struct;
+
+typedef fmpz_mod_poly_powmod_precomp_struct fmpz_mod_poly_powmod_precomp_t[1];
+
+FLINT_DLL void _fmpz_mod_poly_powmod_precomp_init(
+                  fmpz_mod_poly_powmod_precomp_t P, const fmpz * f, slong lenf,
+                       const fmpz * finv, slong lenfinv, const fmpz_t p);
+
+FLINT_DLL void fmpz_mod_poly_powmod_precomp_init(
+                 fmpz_mod_poly_powmod_precomp_t P, const fmpz_mod_poly_t f,
+                        const fmpz_mod_poly_t finv, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_powmod_precomp_clear(
+                                        fmpz_mod_poly_powmod_precomp_t P);
+
+FLINT_DLL void fmpz_mod_poly_powmod_precomp_clear(
+                 fmpz_mod_poly_powmod_precomp_t P, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_powmod_x_fmpz_precomp(fmpz * res,
+                         const fmpz_t e, fmpz_mod_poly_powmod_precomp_t P);
+
+FLINT_DLL void fmpz_mod_poly_powmod_x_fmpz_precomp(fmpz_mod_poly_t res,
+                          const fmpz_t e, fmpz_mod_poly_powmod_precomp_t P,
+                                                     const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void fmpz_mod_poly_powmod_linear_fmpz_preinv(fmpz_mod_poly_t res,
                       const fmpz_t a, const fmpz_t e, const fmpz_mod_poly_t f,
                          const fmpz_mod_poly_t finv, const fmpz_mod_ctx_t ctx);
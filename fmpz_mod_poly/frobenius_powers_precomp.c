@@ -20,7 +20,7 @@ fmpz_mod_poly_frobenius_powers_precomp(fmpz_mod_poly_frobenius_powers_t pow,
                  const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv, ulong m,
                                                       const fmpz_mod_ctx_t ctx)
 {
-    slong i;
+    slong i, k;
 
     pow->pow = (fmpz_mod_poly_struct *) flint_malloc((m + 1)*sizeof(fmpz_mod_poly_struct));
 
@@ -40,7 +40,25 @@ fmpz_mod_poly_frobenius_powers_precomp(fmpz_mod_poly_frobenius_powers_t pow,
        fmpz_mod_poly_powmod_x_fmpz_preinv(pow->pow + 1,
                                       fmpz_mod_ctx_modulus(ctx), f, finv, ctx);
 
-    for (i = 2; i <= m; i++)
-       fmpz_mod_poly_compose_mod(pow->pow + i, pow->pow + i - 1,
+    if (f->length <= 2)
+    {
+       for (i = 2; i <= m; i++)
+          fmpz_mod_poly_compose_mod(pow->pow + i, pow->pow + i - 1,
                                                          pow->pow + 1, f, ctx);
+
+       return;
+    }
+
+    /*
+       Given x^(p^1), ..., x^(p^i), the next k <= i powers are
+       x^(p^j) composed with x^(p^i) for j = 1, ..., k. These compositions
+       share their argument, so they are done as one batch.
+    */
+    for (i = 1; i < m; i += k)
+    {
+       k = FLINT_MIN(i, m - i);
+
+       fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_threaded(
+                  pow->pow + i + 1, pow->pow + 1, k, k, pow->pow + i, f, finv, ctx);
+    }
 }
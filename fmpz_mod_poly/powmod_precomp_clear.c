@@ -0,0 +1,35 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod_poly.h"
+
+void
+_fmpz_mod_poly_powmod_precomp_clear(fmpz_mod_poly_powmod_precomp_t P)
+{
+    if (P->bits != 0)
+    {
+        flint_mpn_mul_precache_clear(P->finvpre);
+        flint_mpn_mul_precache_clear(P->fpre);
+    }
+
+    _fmpz_vec_clear(P->f, P->lenf);
+    _fmpz_vec_clear(P->finv, P->lenfinv);
+    fmpz_clear(P->p);
+}
+
+void
+fmpz_mod_poly_powmod_precomp_clear(fmpz_mod_poly_powmod_precomp_t P,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    _fmpz_mod_poly_powmod_precomp_clear(P);
+}
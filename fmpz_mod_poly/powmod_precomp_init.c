@@ -0,0 +1,84 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_mod_poly.h"
+
+void
+_fmpz_mod_poly_powmod_precomp_init(fmpz_mod_poly_powmod_precomp_t P,
+                      const fmpz * f, slong lenf, const fmpz * finv,
+                                            slong lenfinv, const fmpz_t p)
+{
+    /* quotients have at most lenf - 2 terms when reducing a square */
+    slong lenQ = lenf - 2;
+    flint_bitcnt_t bits;
+    slong limbs, limbsf, lenI;
+    mp_ptr t;
+
+    P->f = _fmpz_vec_init(lenf);
+    _fmpz_vec_set(P->f, f, lenf);
+    P->lenf = lenf;
+
+    P->finv = _fmpz_vec_init(lenfinv);
+    _fmpz_vec_set(P->finv, finv, lenfinv);
+    P->lenfinv = lenfinv;
+
+    fmpz_init_set(P->p, p);
+
+    P->bits = 0;
+    P->transforms_saved = 0;
+
+    if (lenQ < 2)
+        return;
+
+    bits = 2*fmpz_bits(p) + FLINT_BIT_COUNT(lenf);
+    limbs = (lenQ*bits - 1)/FLINT_BITS + 1;
+
+    if (limbs < FMPZ_MOD_POLY_POWMOD_PRECOMP_CUTOFF)
+        return;
+
+    limbsf = ((lenf - 1)*bits - 1)/FLINT_BITS + 1;
+    t = flint_malloc(limbsf*sizeof(mp_limb_t));
+
+    /* only the low lenQ terms of finv are ever used */
+    lenI = FLINT_MIN(lenfinv, lenQ);
+    flint_mpn_zero(t, limbsf);
+    _fmpz_poly_bit_pack(t, finv, lenI, bits, 0);
+    flint_mpn_mul_precache_init(P->finvpre, t,
+                                  (lenI*bits - 1)/FLINT_BITS + 1, limbs);
+
+    /* and only the low lenf - 1 terms of f matter for the remainder */
+    flint_mpn_zero(t, limbsf);
+    _fmpz_poly_bit_pack(t, f, lenf - 1, bits, 0);
+    flint_mpn_mul_precache_init(P->fpre, t, limbsf, limbs);
+
+    P->bits = bits;
+
+    flint_free(t);
+}
+
+void
+fmpz_mod_poly_powmod_precomp_init(fmpz_mod_poly_powmod_precomp_t P,
+                        const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    if (f->length == 0)
+    {
+        flint_printf("Exception (fmpz_mod_poly_powmod_precomp_init)."
+                     "Divide by zero\n");
+        flint_abort();
+    }
+
+    _fmpz_mod_poly_powmod_precomp_init(P, f->coeffs, f->length,
+                 finv->coeffs, finv->length, fmpz_mod_ctx_modulus(ctx));
+}
@@ -0,0 +1,166 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_mod_poly.h"
+#include "long_extras.h"
+
+/*
+   Sets (R, lenf - 1) to (A, lenA) reduced modulo f, with one forward
+   transform for each of the quotient and the remainder when the
+   transforms of f and finv are cached. Short quotients are left to the
+   Newton division.
+*/
+static void
+_fmpz_mod_poly_powmod_precomp_rem(fmpz * R, fmpz * Q, const fmpz * A,
+                 slong lenA, fmpz_mod_poly_powmod_precomp_t P, mp_ptr t1,
+                                                                mp_ptr t2)
+{
+    slong lenf = P->lenf;
+    slong lenQ = lenA - lenf + 1;
+    flint_bitcnt_t bits = P->bits;
+    slong limbs;
+
+    if (bits == 0 || 2*lenQ < lenf)
+    {
+        _fmpz_mod_poly_divrem_newton_n_preinv(Q, R, A, lenA, P->f, lenf,
+                                              P->finv, P->lenfinv, P->p);
+        return;
+    }
+
+    limbs = (lenQ*bits - 1)/FLINT_BITS + 1;
+
+    /* Q = rev(rev(A) * finv mod x^lenQ) */
+    _fmpz_poly_reverse(Q, A + lenf - 1, lenQ, lenQ);
+    flint_mpn_zero(t1, limbs);
+    _fmpz_poly_bit_pack(t1, Q, lenQ, bits, 0);
+    flint_mpn_mul_precache(t2, t1, limbs, P->finvpre);
+    _fmpz_poly_bit_unpack_unsigned(Q, lenQ, t2, bits);
+    _fmpz_vec_scalar_mod_fmpz(Q, Q, lenQ, P->p);
+    _fmpz_poly_reverse(Q, Q, lenQ, lenQ);
+
+    /* R = A - Q*f mod x^(lenf - 1) */
+    flint_mpn_zero(t1, limbs);
+    _fmpz_poly_bit_pack(t1, Q, lenQ, bits, 0);
+    flint_mpn_mul_precache(t2, t1, limbs, P->fpre);
+    _fmpz_poly_bit_unpack_unsigned(R, lenf - 1, t2, bits);
+    _fmpz_vec_scalar_mod_fmpz(R, R, lenf - 1, P->p);
+    _fmpz_mod_poly_sub(R, A, lenf - 1, R, lenf - 1, P->p);
+
+    P->transforms_saved += 2;
+}
+
+void
+_fmpz_mod_poly_powmod_x_fmpz_precomp(fmpz * res, const fmpz_t e,
+                                           fmpz_mod_poly_powmod_precomp_t P)
+{
+    slong lenf = P->lenf;
+    fmpz * T, * Q;
+    mp_ptr t1 = NULL, t2 = NULL;
+    slong lenT, lenQ;
+    slong i, window, l, c;
+
+    lenT = 2 * lenf - 3;
+    lenQ = lenT - lenf + 1;
+
+    T = _fmpz_vec_init(lenT + lenQ);
+    Q = T + lenT;
+
+    if (P->bits != 0)
+    {
+        slong limbs = (lenQ*P->bits - 1)/FLINT_BITS + 1;
+
+        t1 = flint_malloc((limbs + P->fpre->n2 + limbs
+                             + P->finvpre->n2)*sizeof(mp_limb_t));
+        t2 = t1 + limbs;
+    }
+
+    fmpz_one(res);
+    _fmpz_vec_zero(res + 1, lenf - 2);
+    l = z_sizeinbase(lenf - 1, 2) - 2;
+    window = (WORD(1) << l);
+    c = l;
+    i = fmpz_sizeinbase(e, 2) - 2;
+    if (i <= l)
+    {
+      window = (WORD(1) << i);
+      c = i;
+      l = i;
+    }
+
+    if (c == 0)
+    {
+        _fmpz_mod_poly_shift_left(T, res, lenf - 1, window);
+        _fmpz_mod_poly_powmod_precomp_rem(res, Q, T, lenf - 1 + window,
+                                                               P, t1, t2);
+        c = l + 1;
+        window = WORD(0);
+    }
+
+    for (; i >= 0; i--)
+    {
+        _fmpz_mod_poly_sqr(T, res, lenf - 1, P->p);
+        _fmpz_mod_poly_powmod_precomp_rem(res, Q, T, 2 * lenf - 3, P, t1, t2);
+
+        c--;
+        if (fmpz_tstbit(e, i))
+        {
+            if (window == WORD(0) && i <= l - 1)
+                c = i;
+            if ( c >= 0)
+              window = window | (WORD(1) << c);
+        }
+        else if (window == WORD(0))
+            c = l + 1;
+        if (c == 0)
+        {
+            /* multiplying by x^window is only a shift */
+            _fmpz_mod_poly_shift_left(T, res, lenf - 1, window);
+            _fmpz_mod_poly_powmod_precomp_rem(res, Q, T, lenf - 1 + window,
+                                                               P, t1, t2);
+            c = l + 1;
+            window = WORD(0);
+        }
+    }
+
+    _fmpz_vec_clear(T, lenT + lenQ);
+    flint_free(t1);
+}
+
+void
+fmpz_mod_poly_powmod_x_fmpz_precomp(fmpz_mod_poly_t res, const fmpz_t e,
+                 fmpz_mod_poly_powmod_precomp_t P, const fmpz_mod_ctx_t ctx)
+{
+    slong lenf = P->lenf;
+    slong trunc = lenf - 1;
+
+    if (lenf <= 2 || fmpz_cmp_ui(e, 2) <= 0)
+    {
+        fmpz_mod_poly_t f, finv;
+
+        /* shallow copies, the modulus is not modified */
+        f->coeffs = P->f;
+        f->length = f->alloc = lenf;
+        finv->coeffs = P->finv;
+        finv->length = finv->alloc = P->lenfinv;
+
+        fmpz_mod_poly_powmod_x_fmpz_preinv(res, e, f, finv, ctx);
+
+        return;
+    }
+
+    fmpz_mod_poly_fit_length(res, trunc, ctx);
+    _fmpz_mod_poly_powmod_x_fmpz_precomp(res->coeffs, e, P);
+    _fmpz_mod_poly_set_length(res, trunc);
+    _fmpz_mod_poly_normalise(res);
+}
@@ -38,6 +38,18 @@ _fmpz_mod_poly_powmod_x_fmpz_preinv(fmpz * res, const fmpz_t e, const fmpz * f,
     slong lenT, lenQ;
     slong i, window, l, c;
 
+    if ((lenf - 2)*(2*fmpz_bits(p) + FLINT_BIT_COUNT(lenf))
+                       >= FMPZ_MOD_POLY_POWMOD_PRECOMP_CUTOFF*FLINT_BITS)
+    {
+        fmpz_mod_poly_powmod_precomp_t P;
+
+        _fmpz_mod_poly_powmod_precomp_init(P, f, lenf, finv, lenfinv, p);
+        _fmpz_mod_poly_powmod_x_fmpz_precomp(res, e, P);
+        _fmpz_mod_poly_powmod_precomp_clear(P);
+
+        return;
+    }
+
     lenT = 2 * lenf - 3;
     lenQ = lenT - lenf + 1;
 
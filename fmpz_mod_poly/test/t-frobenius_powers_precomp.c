@@ -100,6 +100,8 @@ main(void)
         exp = n_randint(state, 50) + 1;
         exp2 = n_randint(state, exp);
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_mod_poly_init(f, ctx);
         fmpz_mod_poly_init(finv, ctx);
         fmpz_mod_poly_init(res, ctx);
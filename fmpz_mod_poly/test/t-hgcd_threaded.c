@@ -0,0 +1,114 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    fmpz_mod_ctx_t ctx;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("hgcd_threaded....");
+    fflush(stdout);
+
+    fmpz_mod_ctx_init_ui(ctx, 2);
+
+    /*
+       Compare gcd, xgcd and resultant with the Euclidean versions for
+       inputs long enough for the matrix products to be threaded
+    */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, r1, r2;
+        fmpz_mod_poly_t a, b, c, g1, g2, s, t, sum, temp;
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        fmpz_init(p);
+        fmpz_init(r1);
+        fmpz_init(r2);
+
+        fmpz_randprime(p, state, n_randint(state, 100) + 2, 0);
+        fmpz_mod_ctx_set_modulus(ctx, p);
+
+        fmpz_mod_poly_init(a, ctx);
+        fmpz_mod_poly_init(b, ctx);
+        fmpz_mod_poly_init(c, ctx);
+        fmpz_mod_poly_init(g1, ctx);
+        fmpz_mod_poly_init(g2, ctx);
+        fmpz_mod_poly_init(s, ctx);
+        fmpz_mod_poly_init(t, ctx);
+        fmpz_mod_poly_init(sum, ctx);
+        fmpz_mod_poly_init(temp, ctx);
+
+        fmpz_mod_poly_randtest(a, state, n_randint(state, 1000) + 300, ctx);
+        fmpz_mod_poly_randtest(b, state, n_randint(state, 1000) + 300, ctx);
+        fmpz_mod_poly_randtest(c, state, n_randint(state, 50), ctx);
+
+        fmpz_mod_poly_resultant_euclidean(r1, a, b, ctx);
+        fmpz_mod_poly_resultant_hgcd(r2, a, b, ctx);
+
+        fmpz_mod_poly_mul(a, a, c, ctx);
+        fmpz_mod_poly_mul(b, b, c, ctx);
+
+        fmpz_mod_poly_gcd_euclidean(g1, a, b, ctx);
+        fmpz_mod_poly_gcd_hgcd(g2, a, b, ctx);
+
+        result = (fmpz_equal(r1, r2) && fmpz_mod_poly_equal(g1, g2, ctx));
+
+        fmpz_mod_poly_xgcd_hgcd(g2, s, t, a, b, ctx);
+        fmpz_mod_poly_mul(sum, s, a, ctx);
+        fmpz_mod_poly_mul(temp, t, b, ctx);
+        fmpz_mod_poly_add(sum, sum, temp, ctx);
+
+        result = result && fmpz_mod_poly_equal(g1, g2, ctx)
+                        && fmpz_mod_poly_equal(g1, sum, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_mod_poly_print(a, ctx), flint_printf("\n\n");
+            fmpz_mod_poly_print(b, ctx), flint_printf("\n\n");
+            fmpz_mod_poly_print(g1, ctx), flint_printf("\n\n");
+            fmpz_mod_poly_print(g2, ctx), flint_printf("\n\n");
+            flint_printf("r1 = "), fmpz_print(r1), flint_printf("\n");
+            flint_printf("r2 = "), fmpz_print(r2), flint_printf("\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mod_poly_clear(a, ctx);
+        fmpz_mod_poly_clear(b, ctx);
+        fmpz_mod_poly_clear(c, ctx);
+        fmpz_mod_poly_clear(g1, ctx);
+        fmpz_mod_poly_clear(g2, ctx);
+        fmpz_mod_poly_clear(s, ctx);
+        fmpz_mod_poly_clear(t, ctx);
+        fmpz_mod_poly_clear(sum, ctx);
+        fmpz_mod_poly_clear(temp, ctx);
+
+        fmpz_clear(p);
+        fmpz_clear(r1);
+        fmpz_clear(r2);
+    }
+
+    fmpz_mod_ctx_clear(ctx);
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
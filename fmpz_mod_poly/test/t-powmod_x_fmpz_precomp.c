@@ -0,0 +1,150 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    fmpz_mod_ctx_t ctx;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("powmod_x_fmpz_precomp....");
+    fflush(stdout);
+
+    fmpz_mod_ctx_init_ui(ctx, 2);
+
+    /* Short moduli, several exponents per precomputation */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fmpz_mod_poly_t res1, res2, f, finv;
+        fmpz_mod_poly_powmod_precomp_t P;
+        fmpz_t p, exp;
+        slong j;
+
+        fmpz_init(p);
+        fmpz_init(exp);
+        fmpz_randprime(p, state, n_randint(state, 150) + 2, 0);
+        fmpz_mod_ctx_set_modulus(ctx, p);
+
+        fmpz_mod_poly_init(f, ctx);
+        fmpz_mod_poly_init(finv, ctx);
+        fmpz_mod_poly_init(res1, ctx);
+        fmpz_mod_poly_init(res2, ctx);
+
+        fmpz_mod_poly_randtest_not_zero(f, state, n_randint(state, 50) + 1, ctx);
+
+        fmpz_mod_poly_reverse(finv, f, f->length, ctx);
+        fmpz_mod_poly_inv_series_newton(finv, finv, f->length, ctx);
+
+        fmpz_mod_poly_powmod_precomp_init(P, f, finv, ctx);
+
+        for (j = 0; j < 3; j++)
+        {
+            fmpz_randtest_unsigned(exp, state, n_randint(state, 100) + 1);
+
+            fmpz_mod_poly_powmod_x_fmpz_precomp(res1, exp, P, ctx);
+            fmpz_mod_poly_powmod_x_fmpz_preinv(res2, exp, f, finv, ctx);
+
+            result = (fmpz_mod_poly_equal(res1, res2, ctx));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("exp:\n"); fmpz_print(exp), flint_printf("\n\n");
+                flint_printf("f:\n"); fmpz_mod_poly_print(f, ctx), flint_printf("\n\n");
+                flint_printf("res1:\n"); fmpz_mod_poly_print(res1, ctx), flint_printf("\n\n");
+                flint_printf("res2:\n"); fmpz_mod_poly_print(res2, ctx), flint_printf("\n\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fmpz_mod_poly_powmod_precomp_clear(P, ctx);
+
+        fmpz_clear(p);
+        fmpz_clear(exp);
+        fmpz_mod_poly_clear(f, ctx);
+        fmpz_mod_poly_clear(finv, ctx);
+        fmpz_mod_poly_clear(res1, ctx);
+        fmpz_mod_poly_clear(res2, ctx);
+    }
+
+    /* Moduli long enough for the transforms to be cached */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        fmpz_mod_poly_t a, res1, res2, f, finv;
+        fmpz_mod_poly_powmod_precomp_t P;
+        fmpz_t p, exp;
+        slong len, pbits;
+
+        fmpz_init(p);
+        fmpz_init(exp);
+        pbits = n_randint(state, 80) + 60;
+        fmpz_randprime(p, state, pbits, 0);
+        fmpz_mod_ctx_set_modulus(ctx, p);
+
+        len = FMPZ_MOD_POLY_POWMOD_PRECOMP_CUTOFF*FLINT_BITS/(2*pbits)
+              + 2 + n_randint(state, 100);
+
+        fmpz_randtest_unsigned(exp, state, n_randint(state, 40) + 10);
+        fmpz_add_ui(exp, exp, 3);
+
+        fmpz_mod_poly_init(f, ctx);
+        fmpz_mod_poly_init(finv, ctx);
+        fmpz_mod_poly_init(res1, ctx);
+        fmpz_mod_poly_init(res2, ctx);
+        fmpz_mod_poly_init(a, ctx);
+
+        fmpz_mod_poly_randtest_monic(f, state, len, ctx);
+
+        fmpz_mod_poly_reverse(finv, f, f->length, ctx);
+        fmpz_mod_poly_inv_series_newton(finv, finv, f->length, ctx);
+
+        fmpz_mod_poly_powmod_precomp_init(P, f, finv, ctx);
+        fmpz_mod_poly_powmod_x_fmpz_precomp(res1, exp, P, ctx);
+
+        fmpz_mod_poly_set_coeff_ui(a, 1, 1, ctx);
+        fmpz_mod_poly_powmod_fmpz_binexp_preinv(res2, a, exp, f, finv, ctx);
+
+        result = (fmpz_mod_poly_equal(res1, res2, ctx) && P->bits != 0
+                                               && P->transforms_saved > 0);
+        if (!result)
+        {
+            flint_printf("FAIL (cached):\n");
+            flint_printf("len = %wd, p = ", len); fmpz_print(p); flint_printf("\n");
+            flint_printf("exp: "); fmpz_print(exp); flint_printf("\n\n");
+            flint_printf("transforms saved = %wd\n", P->transforms_saved);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mod_poly_powmod_precomp_clear(P, ctx);
+
+        fmpz_clear(p);
+        fmpz_clear(exp);
+        fmpz_mod_poly_clear(a, ctx);
+        fmpz_mod_poly_clear(f, ctx);
+        fmpz_mod_poly_clear(finv, ctx);
+        fmpz_mod_poly_clear(res1, ctx);
+        fmpz_mod_poly_clear(res2, ctx);
+    }
+
+    fmpz_mod_ctx_clear(ctx);
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
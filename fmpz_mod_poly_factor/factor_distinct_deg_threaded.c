@@ -176,6 +176,124 @@ _fmpz_mod_poly_interval_poly_worker(void * arg_ptr)
     return;
 }
 
+typedef struct
+{
+    fmpz_mod_poly_struct * res;
+    const fmpz_mod_poly_struct * a;
+    const fmpz_mod_poly_struct * b;
+    const fmpz_mod_poly_struct * v;
+    const fmpz_mod_poly_struct * vinv;
+    const fmpz_mod_ctx_struct * ctx;
+}
+_interval_gcd_arg_t;
+
+static void
+_interval_mulmod_worker(void * arg_ptr)
+{
+    _interval_gcd_arg_t * arg = (_interval_gcd_arg_t *) arg_ptr;
+
+    fmpz_mod_poly_mulmod_preinv(arg->res, arg->a, arg->b,
+                                             arg->v, arg->vinv, arg->ctx);
+}
+
+static void
+_interval_gcd_worker(void * arg_ptr)
+{
+    _interval_gcd_arg_t * arg = (_interval_gcd_arg_t *) arg_ptr;
+
+    fmpz_mod_poly_gcd(arg->res, arg->a, arg->b, arg->ctx);
+}
+
+/* run jobs 1, ..., num - 1 on the given threads and job 0 locally */
+static void
+_interval_run(void (* worker)(void *), _interval_gcd_arg_t * args, slong num,
+                                                 thread_pool_handle * threads)
+{
+    slong i;
+
+    for (i = 1; i < num; i++)
+        thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                                          worker, args + i);
+
+    worker(args + 0);
+
+    for (i = 1; i < num; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+}
+
+/*
+    Given c <= num_threads + 1 interval polynomials I, computes II, the gcd
+    of v with their product, removes it from v and replaces each I[i] by the
+    part of II not already accounted for by I[0], ..., I[i - 1]. The product
+    is formed as a balanced tree in T and the gcds of the I[i] with II are
+    independent, so both are done in parallel; only the cheap cascade of
+    gcds among the (small) results is sequential.
+*/
+static void
+_fmpz_mod_poly_interval_gcds(fmpz_mod_poly_struct * I, slong c,
+                  fmpz_mod_poly_t II, fmpz_mod_poly_t v, fmpz_mod_poly_t vinv,
+                       fmpz_mod_poly_struct * T, thread_pool_handle * threads,
+                       _interval_gcd_arg_t * args, const fmpz_mod_ctx_t ctx)
+{
+    slong i, k, s, num;
+
+    for (i = 0; i < c; i++)
+        fmpz_mod_poly_set(T + i, I + i, ctx);
+
+    for (s = 1; s < c; s *= 2)
+    {
+        for (num = 0, i = 0; i + s < c; i += 2*s, num++)
+        {
+            args[num].res  = T + i;
+            args[num].a    = T + i;
+            args[num].b    = T + i + s;
+            args[num].v    = v;
+            args[num].vinv = vinv;
+            args[num].ctx  = ctx;
+        }
+
+        _interval_run(_interval_mulmod_worker, args, num, threads);
+    }
+
+    fmpz_mod_poly_gcd(II, v, T + 0, ctx);
+
+    if (II->length > 1)
+    {
+        fmpz_mod_poly_remove(v, II, ctx);
+
+        fmpz_mod_poly_reverse(vinv, v, v->length, ctx);
+        fmpz_mod_poly_inv_series_newton(vinv, vinv, v->length, ctx);
+
+        for (i = 0; i < c; i++)
+        {
+            args[i].res = I + i;
+            args[i].a   = I + i;
+            args[i].b   = II;
+            args[i].ctx = ctx;
+        }
+
+        _interval_run(_interval_gcd_worker, args, c, threads);
+
+        for (i = 1; i < c; i++)
+        {
+            for (k = 0; k < i && I[i].length > 1; k++)
+            {
+                if (I[k].length > 1)
+                {
+                    fmpz_mod_poly_gcd(T + 0, I + i, I + k, ctx);
+
+                    if (T[0].length > 1)
+                        fmpz_mod_poly_div(I + i, I + i, T + 0, ctx);
+                }
+            }
+        }
+    } else
+    {
+        for (i = 0; i < c; i++)
+            fmpz_mod_poly_set_ui(I + i, 1, ctx);
+    }
+}
+
 /* the degrees are written as exponents of the corresponding factors */
 void fmpz_mod_poly_factor_distinct_deg_threaded_with_frob(
     fmpz_mod_poly_factor_t res,
@@ -195,6 +313,7 @@ void fmpz_mod_poly_factor_distinct_deg_threaded_with_frob(
     fmpz_mod_poly_matrix_precompute_arg_t * args1;
     fmpz_mod_poly_compose_mod_precomp_preinv_arg_t * args2;
     fmpz_mod_poly_interval_poly_arg_t * args3;
+    _interval_gcd_arg_t * args4;
 
     FLINT_ASSERT(fmpz_mod_poly_is_monic(poly, ctx));
 
@@ -235,6 +354,7 @@ void fmpz_mod_poly_factor_distinct_deg_threaded_with_frob(
     args1 = FLINT_ARRAY_ALLOC(num_threads + 1, fmpz_mod_poly_matrix_precompute_arg_t);
     args2 = FLINT_ARRAY_ALLOC(num_threads + 1, fmpz_mod_poly_compose_mod_precomp_preinv_arg_t);
     args3 = FLINT_ARRAY_ALLOC(num_threads + 1, fmpz_mod_poly_interval_poly_arg_t);
+    args4 = FLINT_ARRAY_ALLOC(num_threads + 1, _interval_gcd_arg_t);
 
     fmpz_mod_poly_set(v, poly, ctx);
     fmpz_mod_poly_set(vinv, polyinv, ctx);
@@ -445,32 +565,8 @@ void fmpz_mod_poly_factor_distinct_deg_threaded_with_frob(
                _fmpz_vec_clear(args3[i].tmp, v->length - 1);
             }
 
-            fmpz_mod_poly_set_ui(II, 1, ctx);
-
-            for (i = 0; i < c1; i++)
-                fmpz_mod_poly_mulmod_preinv(II, II,  I + num_threads + 1 + i,
-                                                                 v, vinv, ctx);
-
-            fmpz_mod_poly_gcd(II, v, II, ctx);
-
-            if (II->length > 1)
-            {
-                fmpz_mod_poly_remove(v, II, ctx);
-                fmpz_mod_poly_reverse(vinv, v, v->length, ctx);
-                fmpz_mod_poly_inv_series_newton(vinv, vinv, v->length, ctx);
-                
-                for (i = 0; i < c1; i++)
-                {
-                    fmpz_mod_poly_gcd(I + num_threads + 1 + i,
-                                             I + num_threads + 1 + i, II, ctx);
-                    if (I[num_threads + 1 + i].length > 1)
-                        fmpz_mod_poly_remove(II, I + num_threads + 1 + i, ctx);
-                }
-            } else
-            {
-                for (i = 0; i < c1; i++)
-                    fmpz_mod_poly_set_ui(I + num_threads + 1 + i, 1, ctx);
-            }
+            _fmpz_mod_poly_interval_gcds(I + num_threads + 1, c1, II, v, vinv,
+                                            scratch, threads, args4, ctx);
 
             d = d + c1*l;
 
@@ -563,34 +659,8 @@ void fmpz_mod_poly_factor_distinct_deg_threaded_with_frob(
                _fmpz_vec_clear(args3[i].tmp, v->length - 1);
             }
 
-            fmpz_mod_poly_set_ui(II, 1, ctx);
-
-            for (i = 0; i < c2; i++)
-                fmpz_mod_poly_mulmod_preinv(II, II,
-                                    I + j*(num_threads + 1) + i, v, vinv, ctx);
-
-            fmpz_mod_poly_gcd(II, v, II, ctx);
-
-            if (II->length > 1)
-            {
-                fmpz_mod_poly_remove(v, II, ctx);
-
-                fmpz_mod_poly_reverse(vinv, v, v->length, ctx);
-                fmpz_mod_poly_inv_series_newton(vinv, vinv, v->length, ctx);
-
-                for (i = 0; i < c2; i++)
-                {
-                    fmpz_mod_poly_gcd(I + j*(num_threads + 1) + i,
-                                      I + j*(num_threads + 1) + i, II, ctx);
-
-                    if (I[j*(num_threads + 1) + i].length > 1)
-                        fmpz_mod_poly_remove(II, I + j*(num_threads + 1) + i, ctx);
-                }
-            } else
-            {
-                for (i = 0; i < c2; i++)
-                    fmpz_mod_poly_set_ui(I + j*(num_threads + 1) + i, 1, ctx);
-            }
+            _fmpz_mod_poly_interval_gcds(I + j*(num_threads + 1), c2, II, v,
+                                      vinv, scratch, threads, args4, ctx);
 
             d = d + c2*l;
 
@@ -664,6 +734,7 @@ void fmpz_mod_poly_factor_distinct_deg_threaded_with_frob(
     flint_free(args1);
     flint_free(args2);
     flint_free(args3);
+    flint_free(args4);
 }
 
 void fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
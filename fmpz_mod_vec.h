@@ -50,6 +50,12 @@ FLINT_DLL void _fmpz_mod_vec_mul(fmpz * A, const fmpz * B, const fmpz * C,
 FLINT_DLL void _fmpz_mod_vec_scalar_div_fmpz_mod(fmpz * A, const fmpz * B,
                           slong len, const fmpz_t c, const fmpz_mod_ctx_t ctx);
 
+FLINT_DLL int _fmpz_mod_vec_inv(fmpz * A, const fmpz * B, slong len,
+                                                    const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL int _fmpz_mod_vec_pow_fmpz(fmpz * A, const fmpz * B, slong len,
+                                  const fmpz_t e, const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_vec_dot(fmpz_t d, const fmpz * A, const fmpz * B,
                                           slong len, const fmpz_mod_ctx_t ctx);
 
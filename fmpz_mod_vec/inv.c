@@ -0,0 +1,52 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_vec.h"
+#include "fmpz_mod_vec.h"
+
+/* Montgomery's simultaneous inversion, see _nmod_vec_inv */
+int _fmpz_mod_vec_inv(fmpz * A, const fmpz * B, slong len,
+                                                    const fmpz_mod_ctx_t ctx)
+{
+    fmpz * p;
+    fmpz_t inv, t;
+    slong i;
+    int success;
+
+    if (len < 1)
+        return 1;
+
+    p = _fmpz_vec_init(len);
+    fmpz_init(inv);
+    fmpz_init(t);
+
+    fmpz_set(p + 0, B + 0);
+    for (i = 1; i < len; i++)
+        fmpz_mod_mul(p + i, p + i - 1, B + i, ctx);
+
+    success = fmpz_invmod(inv, p + len - 1, fmpz_mod_ctx_modulus(ctx));
+
+    if (success)
+    {
+        for (i = len - 1; i > 0; i--)
+        {
+            fmpz_mod_mul(t, inv, p + i - 1, ctx);
+            fmpz_mod_mul(inv, inv, B + i, ctx);
+            fmpz_swap(A + i, t);
+        }
+
+        fmpz_swap(A + 0, inv);
+    }
+
+    fmpz_clear(inv);
+    fmpz_clear(t);
+    _fmpz_vec_clear(p, len);
+
+    return success;
+}
@@ -0,0 +1,38 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod_vec.h"
+
+int _fmpz_mod_vec_pow_fmpz(fmpz * A, const fmpz * B, slong len,
+                                 const fmpz_t e, const fmpz_mod_ctx_t ctx)
+{
+    slong i;
+
+    if (fmpz_sgn(e) < 0)
+    {
+        fmpz_t f;
+
+        /* one inversion for the whole vector instead of one per entry */
+        if (!_fmpz_mod_vec_inv(A, B, len, ctx))
+            return 0;
+
+        fmpz_init(f);
+        fmpz_neg(f, e);
+        for (i = 0; i < len; i++)
+            fmpz_mod_pow_fmpz(A + i, A + i, f, ctx);
+        fmpz_clear(f);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            fmpz_mod_pow_fmpz(A + i, B + i, e, ctx);
+    }
+
+    return 1;
+}
@@ -0,0 +1,110 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fmpz_vec.h"
+#include "fmpz_mod_vec.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("inv....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong len, j;
+        fmpz_t n, e;
+        fmpz_mod_ctx_t ctx;
+        fmpz * a, * b, * c;
+        int all_invertible, success;
+
+        len = n_randint(state, 50);
+
+        fmpz_init(n);
+        fmpz_init(e);
+        fmpz_randtest_unsigned(n, state, 200);
+        fmpz_add_ui(n, n, 2);
+        fmpz_mod_ctx_init(ctx, n);
+
+        a = _fmpz_vec_init(len);
+        b = _fmpz_vec_init(len);
+        c = _fmpz_vec_init(len);
+
+        all_invertible = 1;
+        for (j = 0; j < len; j++)
+        {
+            fmpz_mod_rand(a + j, state, ctx);
+            all_invertible &= fmpz_mod_is_invertible(a + j, ctx);
+        }
+
+        if (n_randint(state, 2))
+        {
+            _fmpz_vec_set(b, a, len);
+            success = _fmpz_mod_vec_inv(b, b, len, ctx);
+        }
+        else
+        {
+            success = _fmpz_mod_vec_inv(b, a, len, ctx);
+        }
+
+        if (success != all_invertible)
+        {
+            flint_printf("FAIL: check success\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (success)
+        {
+            for (j = 0; j < len; j++)
+                fmpz_mod_inv(c + j, a + j, ctx);
+
+            if (!_fmpz_vec_equal(b, c, len))
+            {
+                flint_printf("FAIL: check inverse\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        /* powers with a shared, possibly negative, exponent */
+        fmpz_randtest(e, state, 100);
+        if (fmpz_sgn(e) < 0 && !all_invertible)
+            fmpz_neg(e, e);
+
+        success = _fmpz_mod_vec_pow_fmpz(b, a, len, e, ctx);
+
+        for (j = 0; j < len; j++)
+            success &= fmpz_mod_pow_fmpz(c + j, a + j, e, ctx);
+
+        if (!success || !_fmpz_vec_equal(b, c, len))
+        {
+            flint_printf("FAIL: check pow_fmpz\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, len);
+        _fmpz_vec_clear(c, len);
+        fmpz_mod_ctx_clear(ctx);
+        fmpz_clear(n);
+        fmpz_clear(e);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -257,6 +257,35 @@ FLINT_DLL void _fmpz_vec_scalar_mod_fmpz(fmpz *res, const fmpz *vec, slong len,
 
 FLINT_DLL void _fmpz_vec_scalar_smod_fmpz(fmpz *res, const fmpz *vec, slong len, const fmpz_t p);
 
+/* vectors at least this long are reduced with a precomputed inverse of p */
+#define FMPZ_VEC_PREINVN_CUTOFF 16
+
+/* limbs of p times entries per thread used by the functions below */
+#define FMPZ_VEC_PREINVN_THREAD_LIMBS 10000
+
+/*
+    A single division by a precomputed inverse is no faster than one by
+    GMP, so vectors are only handed to the functions below when the
+    inverse is actually used for p and there are threads to share them.
+*/
+FMPZ_VEC_INLINE
+int _fmpz_vec_scalar_use_preinvn(slong len, const fmpz_t p)
+{
+    return len >= FMPZ_VEC_PREINVN_CUTOFF && COEFF_IS_MPZ(*p) &&
+           fmpz_sgn(p) > 0 && _fmpz_preinvn_is_used(fmpz_size(p)) &&
+           flint_get_num_threads() > 1 &&
+           len >= FMPZ_VEC_PREINVN_THREAD_LIMBS / fmpz_size(p);
+}
+
+FLINT_DLL void _fmpz_vec_scalar_mod_fmpz_preinvn(fmpz * res, const fmpz * vec,
+                       slong len, const fmpz_t p, const fmpz_preinvn_t pinv);
+
+FLINT_DLL void _fmpz_vec_scalar_smod_fmpz_preinvn(fmpz * res, const fmpz * vec,
+                       slong len, const fmpz_t p, const fmpz_preinvn_t pinv);
+
+FLINT_DLL void _fmpz_vec_scalar_fdiv_q_fmpz_preinvn(fmpz * res,
+     const fmpz * vec, slong len, const fmpz_t p, const fmpz_preinvn_t pinv);
+
 /*  Gaussian content  ********************************************************/
 
 FLINT_DLL void _fmpz_vec_content(fmpz_t res, const fmpz * vec, slong len);
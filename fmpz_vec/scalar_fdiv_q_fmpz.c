@@ -20,6 +20,16 @@ _fmpz_vec_scalar_fdiv_q_fmpz(fmpz * vec1, const fmpz * vec2, slong len2,
                              const fmpz_t c)
 {
     slong i;
+
+    if (_fmpz_vec_scalar_use_preinvn(len2, c))
+    {
+        fmpz_preinvn_t cinv;
+        fmpz_preinvn_init(cinv, c);
+        _fmpz_vec_scalar_fdiv_q_fmpz_preinvn(vec1, vec2, len2, c, cinv);
+        fmpz_preinvn_clear(cinv);
+        return;
+    }
+
     for (i = 0; i < len2; i++)
         fmpz_fdiv_q(vec1 + i, vec2 + i, c);
 }
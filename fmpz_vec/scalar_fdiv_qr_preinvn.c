@@ -0,0 +1,128 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "thread_support.h"
+
+#define FMPZ_VEC_PREINVN_MOD   0
+#define FMPZ_VEC_PREINVN_SMOD  1
+#define FMPZ_VEC_PREINVN_FDIV  2
+
+/* entries handled per task, so that temporaries are set up once per task */
+#define FMPZ_VEC_PREINVN_BLOCK 16
+
+typedef struct
+{
+    fmpz * res;
+    const fmpz * vec;
+    slong len;
+    const fmpz * p;
+    const fmpz * pdiv2;
+    const fmpz_preinvn_struct * pinv;
+    int op;
+}
+work_t;
+
+static void
+worker(slong b, work_t * work)
+{
+    slong i, start, stop;
+    fmpz_t q, r;
+    fmpz * res = work->res;
+    const fmpz * vec = work->vec;
+
+    start = b * FMPZ_VEC_PREINVN_BLOCK;
+    stop = FLINT_MIN(start + FMPZ_VEC_PREINVN_BLOCK, work->len);
+
+    fmpz_init(q);
+    fmpz_init(r);
+
+    for (i = start; i < stop; i++)
+    {
+        fmpz_fdiv_qr_preinvn(q, r, vec + i, work->p, work->pinv);
+
+        if (work->op == FMPZ_VEC_PREINVN_FDIV)
+        {
+            fmpz_swap(res + i, q);
+        }
+        else
+        {
+            if (work->op == FMPZ_VEC_PREINVN_SMOD && fmpz_cmp(r, work->pdiv2) > 0)
+                fmpz_sub(r, r, work->p);
+
+            fmpz_swap(res + i, r);
+        }
+    }
+
+    fmpz_clear(q);
+    fmpz_clear(r);
+}
+
+static void
+_fmpz_vec_scalar_fdiv_qr_preinvn(fmpz * res, const fmpz * vec, slong len,
+                        const fmpz_t p, const fmpz_preinvn_t pinv, int op)
+{
+    work_t work;
+    fmpz_t pdiv2;
+    slong max_threads, num_blocks, limbs;
+
+    if (len <= 0)
+        return;
+
+    fmpz_init(pdiv2);
+    if (op == FMPZ_VEC_PREINVN_SMOD)
+        fmpz_fdiv_q_2exp(pdiv2, p, 1);
+
+    work.res = res;
+    work.vec = vec;
+    work.len = len;
+    work.p = p;
+    work.pdiv2 = pdiv2;
+    work.pinv = pinv;
+    work.op = op;
+
+    num_blocks = (len + FMPZ_VEC_PREINVN_BLOCK - 1) / FMPZ_VEC_PREINVN_BLOCK;
+
+    limbs = fmpz_size(p);
+    max_threads = flint_get_num_threads();
+    max_threads = FLINT_MIN(max_threads,
+                            limbs * len / FMPZ_VEC_PREINVN_THREAD_LIMBS + 1);
+
+    flint_parallel_do((do_func_t) worker, &work, num_blocks, max_threads,
+                                                     FLINT_PARALLEL_UNIFORM);
+
+    fmpz_clear(pdiv2);
+}
+
+void
+_fmpz_vec_scalar_mod_fmpz_preinvn(fmpz * res, const fmpz * vec, slong len,
+                                  const fmpz_t p, const fmpz_preinvn_t pinv)
+{
+    _fmpz_vec_scalar_fdiv_qr_preinvn(res, vec, len, p, pinv,
+                                                     FMPZ_VEC_PREINVN_MOD);
+}
+
+void
+_fmpz_vec_scalar_smod_fmpz_preinvn(fmpz * res, const fmpz * vec, slong len,
+                                  const fmpz_t p, const fmpz_preinvn_t pinv)
+{
+    _fmpz_vec_scalar_fdiv_qr_preinvn(res, vec, len, p, pinv,
+                                                     FMPZ_VEC_PREINVN_SMOD);
+}
+
+void
+_fmpz_vec_scalar_fdiv_q_fmpz_preinvn(fmpz * res, const fmpz * vec,
+                       slong len, const fmpz_t p, const fmpz_preinvn_t pinv)
+{
+    _fmpz_vec_scalar_fdiv_qr_preinvn(res, vec, len, p, pinv,
+                                                     FMPZ_VEC_PREINVN_FDIV);
+}
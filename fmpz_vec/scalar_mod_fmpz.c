@@ -18,7 +18,15 @@ void _fmpz_vec_scalar_mod_fmpz(fmpz *res, const fmpz *vec, slong len, const fmpz
 {
     slong i;
 
+    if (_fmpz_vec_scalar_use_preinvn(len, p))
+    {
+        fmpz_preinvn_t pinv;
+        fmpz_preinvn_init(pinv, p);
+        _fmpz_vec_scalar_mod_fmpz_preinvn(res, vec, len, p, pinv);
+        fmpz_preinvn_clear(pinv);
+        return;
+    }
+
     for (i = 0; i < len; i++)
         fmpz_mod(res + i, vec + i, p);
 }
-
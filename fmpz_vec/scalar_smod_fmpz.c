@@ -19,6 +19,15 @@ void _fmpz_vec_scalar_smod_fmpz(fmpz *res, const fmpz *vec, slong len, const fmp
     slong i;
     fmpz_t pdiv2;
 
+    if (_fmpz_vec_scalar_use_preinvn(len, p))
+    {
+        fmpz_preinvn_t pinv;
+        fmpz_preinvn_init(pinv, p);
+        _fmpz_vec_scalar_smod_fmpz_preinvn(res, vec, len, p, pinv);
+        fmpz_preinvn_clear(pinv);
+        return;
+    }
+
     fmpz_init(pdiv2);
     fmpz_fdiv_q_2exp(pdiv2, p, 1);
 
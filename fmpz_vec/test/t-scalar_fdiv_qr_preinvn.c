@@ -0,0 +1,167 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("scalar_fdiv_qr_preinvn....");
+    fflush(stdout);
+
+    /* Compare mod, smod and fdiv_q with the entrywise functions */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, pdiv2;
+        fmpz_preinvn_t pinv;
+        fmpz *a, *b, *c;
+        slong j, len = n_randint(state, 200);
+        int aliasing = n_randint(state, 2);
+
+        fmpz_init(p);
+        fmpz_init(pdiv2);
+        fmpz_randtest_unsigned(p, state, 400);
+        fmpz_add_ui(p, p, 1);
+        fmpz_fdiv_q_2exp(pdiv2, p, 1);
+        fmpz_preinvn_init(pinv, p);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        a = _fmpz_vec_init(len);
+        b = _fmpz_vec_init(len);
+        c = _fmpz_vec_init(len);
+        _fmpz_vec_randtest(a, state, len, 1000);
+
+        /* mod */
+        for (j = 0; j < len; j++)
+            fmpz_mod(c + j, a + j, p);
+        if (aliasing)
+        {
+            _fmpz_vec_set(b, a, len);
+            _fmpz_vec_scalar_mod_fmpz_preinvn(b, b, len, p, pinv);
+        }
+        else
+            _fmpz_vec_scalar_mod_fmpz_preinvn(b, a, len, p, pinv);
+
+        result = _fmpz_vec_equal(b, c, len);
+
+        _fmpz_vec_scalar_mod_fmpz(b, a, len, p);
+        result = result && _fmpz_vec_equal(b, c, len);
+
+        /* smod */
+        for (j = 0; j < len; j++)
+        {
+            if (fmpz_cmp(c + j, pdiv2) > 0)
+                fmpz_sub(c + j, c + j, p);
+        }
+        _fmpz_vec_scalar_smod_fmpz_preinvn(b, a, len, p, pinv);
+        result = result && _fmpz_vec_equal(b, c, len);
+
+        _fmpz_vec_scalar_smod_fmpz(b, a, len, p);
+        result = result && _fmpz_vec_equal(b, c, len);
+
+        /* fdiv_q */
+        for (j = 0; j < len; j++)
+            fmpz_fdiv_q(c + j, a + j, p);
+        _fmpz_vec_scalar_fdiv_q_fmpz_preinvn(b, a, len, p, pinv);
+        result = result && _fmpz_vec_equal(b, c, len);
+
+        _fmpz_vec_scalar_fdiv_q_fmpz(b, a, len, p);
+        result = result && _fmpz_vec_equal(b, c, len);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_print(p), flint_printf("\n\n");
+            _fmpz_vec_print(a, len), flint_printf("\n\n");
+            _fmpz_vec_print(b, len), flint_printf("\n\n");
+            _fmpz_vec_print(c, len), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, len);
+        _fmpz_vec_clear(c, len);
+        fmpz_preinvn_clear(pinv);
+        fmpz_clear(p);
+        fmpz_clear(pdiv2);
+    }
+
+    /* Vectors long enough to be reduced in parallel */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, pdiv2;
+        fmpz *a, *b, *c;
+        slong j, len;
+
+        fmpz_init(p);
+        fmpz_init(pdiv2);
+        fmpz_randtest_unsigned(p, state, 64 + n_randint(state, 1000));
+        fmpz_add_ui(p, p, 1);
+        fmpz_fdiv_q_2exp(pdiv2, p, 1);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        len = FMPZ_VEC_PREINVN_THREAD_LIMBS / fmpz_size(p)
+                                                + n_randint(state, 100);
+
+        a = _fmpz_vec_init(len);
+        b = _fmpz_vec_init(len);
+        c = _fmpz_vec_init(len);
+        _fmpz_vec_randtest(a, state, len, 2000);
+
+        for (j = 0; j < len; j++)
+            fmpz_mod(c + j, a + j, p);
+        _fmpz_vec_scalar_mod_fmpz(b, a, len, p);
+        result = _fmpz_vec_equal(b, c, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (fmpz_cmp(c + j, pdiv2) > 0)
+                fmpz_sub(c + j, c + j, p);
+        }
+        _fmpz_vec_scalar_smod_fmpz(b, a, len, p);
+        result = result && _fmpz_vec_equal(b, c, len);
+
+        for (j = 0; j < len; j++)
+            fmpz_fdiv_q(c + j, a + j, p);
+        _fmpz_vec_scalar_fdiv_q_fmpz(b, a, len, p);
+        result = result && _fmpz_vec_equal(b, c, len);
+
+        if (!result)
+        {
+            flint_printf("FAIL (long):\n");
+            fmpz_print(p), flint_printf("\n\n");
+            flint_printf("len = %wd\n", len);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, len);
+        _fmpz_vec_clear(c, len);
+        fmpz_clear(p);
+        fmpz_clear(pdiv2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
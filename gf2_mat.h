@@ -0,0 +1,203 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GF2_MAT_H
+#define GF2_MAT_H
+
+#ifdef GF2_MAT_INLINES_C
+#define GF2_MAT_INLINE FLINT_DLL
+#else
+#define GF2_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "nmod_mat.h"
+#include "thread_support.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Dense matrix over GF(2) with the entries of each row packed into limbs:
+    entry (i, j) is bit j % FLINT_BITS of rows[i][j / FLINT_BITS]. The bits
+    of the last limb of a row beyond column c - 1 are unspecified; every
+    function ignores them on input and leaves them unchanged on output, so
+    that windows may share limbs with the surrounding matrix.
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong r;
+    slong c;
+    mp_limb_t ** rows;
+}
+gf2_mat_struct;
+
+typedef gf2_mat_struct gf2_mat_t[1];
+
+#define GF2_MAT_STRASSEN_CUTOFF 4096
+
+/* number of 8 bit tables used together by the Four Russians algorithms */
+#define GF2_MAT_TABLES (FLINT_BITS/8)
+
+GF2_MAT_INLINE
+slong _gf2_mat_row_limbs(slong c)
+{
+    return (c + FLINT_BITS - 1)/FLINT_BITS;
+}
+
+/* mask of the significant bits of the last limb of a row of length c */
+GF2_MAT_INLINE
+mp_limb_t _gf2_mat_last_mask(slong c)
+{
+    return (c % FLINT_BITS == 0) ? ~UWORD(0)
+                                 : (UWORD(1) << (c % FLINT_BITS)) - 1;
+}
+
+/* d ^= s on n limbs, touching only the masked bits of the last one */
+GF2_MAT_INLINE
+void _gf2_mat_row_add(mp_ptr d, mp_srcptr s, slong n, mp_limb_t mask)
+{
+    slong i;
+
+    for (i = 0; i < n - 1; i++)
+        d[i] ^= s[i];
+
+    if (n > 0)
+        d[n - 1] ^= s[n - 1] & mask;
+}
+
+/* Memory management *********************************************************/
+
+FLINT_DLL void gf2_mat_init(gf2_mat_t mat, slong rows, slong cols);
+
+FLINT_DLL void gf2_mat_init_set(gf2_mat_t mat, const gf2_mat_t src);
+
+FLINT_DLL void gf2_mat_clear(gf2_mat_t mat);
+
+GF2_MAT_INLINE
+void gf2_mat_swap(gf2_mat_t mat1, gf2_mat_t mat2)
+{
+    gf2_mat_struct t = *mat1;
+    *mat1 = *mat2;
+    *mat2 = t;
+}
+
+/* Windows start at a column divisible by FLINT_BITS */
+FLINT_DLL void gf2_mat_window_init(gf2_mat_t window, const gf2_mat_t mat,
+                                   slong r1, slong c1, slong r2, slong c2);
+
+FLINT_DLL void gf2_mat_window_clear(gf2_mat_t window);
+
+/* Basic properties and manipulation *****************************************/
+
+GF2_MAT_INLINE
+slong gf2_mat_nrows(const gf2_mat_t mat)
+{
+    return mat->r;
+}
+
+GF2_MAT_INLINE
+slong gf2_mat_ncols(const gf2_mat_t mat)
+{
+    return mat->c;
+}
+
+GF2_MAT_INLINE
+int gf2_mat_get_entry(const gf2_mat_t mat, slong i, slong j)
+{
+    return (mat->rows[i][j / FLINT_BITS] >> (j % FLINT_BITS)) & 1;
+}
+
+GF2_MAT_INLINE
+void gf2_mat_set_entry(gf2_mat_t mat, slong i, slong j, int x)
+{
+    mp_limb_t bit = UWORD(1) << (j % FLINT_BITS);
+
+    if (x & 1)
+        mat->rows[i][j / FLINT_BITS] |= bit;
+    else
+        mat->rows[i][j / FLINT_BITS] &= ~bit;
+}
+
+GF2_MAT_INLINE
+void gf2_mat_swap_rows(gf2_mat_t mat, slong r, slong s)
+{
+    if (r != s)
+    {
+        mp_limb_t * t = mat->rows[r];
+        mat->rows[r] = mat->rows[s];
+        mat->rows[s] = t;
+    }
+}
+
+FLINT_DLL void gf2_mat_zero(gf2_mat_t mat);
+
+FLINT_DLL void gf2_mat_one(gf2_mat_t mat);
+
+FLINT_DLL void gf2_mat_set(gf2_mat_t B, const gf2_mat_t A);
+
+FLINT_DLL int gf2_mat_equal(const gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL int gf2_mat_is_zero(const gf2_mat_t A);
+
+FLINT_DLL void gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL void gf2_mat_set_nmod_mat(gf2_mat_t B, const nmod_mat_t A);
+
+FLINT_DLL void gf2_mat_get_nmod_mat(nmod_mat_t B, const gf2_mat_t A);
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void gf2_mat_randtest(gf2_mat_t mat, flint_rand_t state);
+
+/* Arithmetic ****************************************************************/
+
+FLINT_DLL void gf2_mat_add(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A,
+                                                          const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A,
+                                                          const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul_strassen(gf2_mat_t C, const gf2_mat_t A,
+                                                          const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_addmul(gf2_mat_t D, const gf2_mat_t C,
+                                        const gf2_mat_t A, const gf2_mat_t B);
+
+/* Gaussian elimination ******************************************************/
+
+FLINT_DLL slong gf2_mat_rref(gf2_mat_t A);
+
+FLINT_DLL slong gf2_mat_rank(const gf2_mat_t A);
+
+/* Internal ******************************************************************/
+
+FLINT_DLL void _gf2_mat_add_table_rows(mp_ptr c, mp_srcptr * tp,
+                                                   slong n, mp_limb_t mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,32 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_add(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, j, limbs = _gf2_mat_row_limbs(A->c);
+    mp_limb_t mask = _gf2_mat_last_mask(A->c);
+
+    if (limbs == 0)
+        return;
+
+    for (i = 0; i < A->r; i++)
+    {
+        mp_ptr c = C->rows[i];
+        mp_srcptr a = A->rows[i], b = B->rows[i];
+
+        for (j = 0; j < limbs - 1; j++)
+            c[j] = a[j] ^ b[j];
+
+        c[limbs - 1] = (c[limbs - 1] & ~mask)
+                     | ((a[limbs - 1] ^ b[limbs - 1]) & mask);
+    }
+}
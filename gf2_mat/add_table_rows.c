@@ -0,0 +1,61 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+/*
+    c ^= tp[0] ^ ... ^ tp[GF2_MAT_TABLES - 1] on n limbs, touching only the
+    masked bits of the last one. This is the inner loop of the Four
+    Russians algorithms; the loads of each group of four limbs precede its
+    stores so that the compiler can vectorise it.
+*/
+FLINT_TARGET_CLONES
+void
+_gf2_mat_add_table_rows(mp_ptr c, mp_srcptr * tp, slong n, mp_limb_t mask)
+{
+    slong l, t;
+    mp_limb_t x;
+
+    if (n <= 0)
+        return;
+
+#if GF2_MAT_TABLES == 8
+    {
+        mp_srcptr t0 = tp[0], t1 = tp[1], t2 = tp[2], t3 = tp[3];
+        mp_srcptr t4 = tp[4], t5 = tp[5], t6 = tp[6], t7 = tp[7];
+
+        for (l = 0; l + 4 <= n - 1; l += 4)
+        {
+            mp_limb_t y[4];
+
+            for (t = 0; t < 4; t++)
+                y[t] = c[l + t] ^ t0[l + t] ^ t1[l + t] ^ t2[l + t]
+                     ^ t3[l + t] ^ t4[l + t] ^ t5[l + t] ^ t6[l + t]
+                     ^ t7[l + t];
+
+            for (t = 0; t < 4; t++)
+                c[l + t] = y[t];
+        }
+    }
+#else
+    l = 0;
+#endif
+
+    for ( ; l < n; l++)
+    {
+        x = 0;
+        for (t = 0; t < GF2_MAT_TABLES; t++)
+            x ^= tp[t][l];
+
+        if (l == n - 1)
+            x &= mask;
+
+        c[l] ^= x;
+    }
+}
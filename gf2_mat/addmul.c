@@ -0,0 +1,25 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_addmul(gf2_mat_t D, const gf2_mat_t C,
+                                        const gf2_mat_t A, const gf2_mat_t B)
+{
+    gf2_mat_t T;
+
+    if (A->r == 0 || B->c == 0)
+        return;
+
+    gf2_mat_init(T, A->r, B->c);
+    gf2_mat_mul(T, A, B);
+    gf2_mat_add(D, C, T);
+    gf2_mat_clear(T);
+}
@@ -0,0 +1,35 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+int
+gf2_mat_equal(const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, j, limbs = _gf2_mat_row_limbs(A->c);
+    mp_limb_t mask = _gf2_mat_last_mask(A->c);
+
+    if (A->r != B->r || A->c != B->c)
+        return 0;
+
+    if (limbs == 0)
+        return 1;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < limbs - 1; j++)
+            if (A->rows[i][j] != B->rows[i][j])
+                return 0;
+
+        if ((A->rows[i][limbs - 1] ^ B->rows[i][limbs - 1]) & mask)
+            return 0;
+    }
+
+    return 1;
+}
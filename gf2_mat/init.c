@@ -0,0 +1,54 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_init(gf2_mat_t mat, slong rows, slong cols)
+{
+    slong i, limbs = _gf2_mat_row_limbs(cols);
+
+    if (rows != 0)
+        mat->rows = (mp_limb_t **) flint_malloc(rows*sizeof(mp_limb_t *));
+    else
+        mat->rows = NULL;
+
+    if (rows != 0 && limbs != 0)
+    {
+        mat->entries = (mp_limb_t *) flint_calloc(flint_mul_sizes(rows, limbs),
+                                                            sizeof(mp_limb_t));
+
+        for (i = 0; i < rows; i++)
+            mat->rows[i] = mat->entries + i*limbs;
+    }
+    else
+    {
+        mat->entries = NULL;
+
+        for (i = 0; i < rows; i++)
+            mat->rows[i] = NULL;
+    }
+
+    mat->r = rows;
+    mat->c = cols;
+}
+
+void
+gf2_mat_init_set(gf2_mat_t mat, const gf2_mat_t src)
+{
+    gf2_mat_init(mat, src->r, src->c);
+    gf2_mat_set(mat, src);
+}
+
+void
+gf2_mat_clear(gf2_mat_t mat)
+{
+    flint_free(mat->entries);
+    flint_free(mat->rows);
+}
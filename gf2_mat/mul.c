@@ -0,0 +1,29 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong m = A->r;
+    slong k = A->c;
+    slong n = B->c;
+
+    if (B->r != k || C->r != m || C->c != n)
+    {
+        flint_printf("Exception (gf2_mat_mul). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (FLINT_MIN(FLINT_MIN(m, k), n) >= GF2_MAT_STRASSEN_CUTOFF)
+        gf2_mat_mul_strassen(C, A, B);
+    else
+        gf2_mat_mul_m4rm(C, A, B);
+}
@@ -0,0 +1,42 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, j, m = A->r, k = A->c, n = B->c;
+    slong limbs = _gf2_mat_row_limbs(n);
+    mp_limb_t mask = _gf2_mat_last_mask(n);
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, m, n);
+        gf2_mat_mul_classical(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    if (B->r != k || C->r != m || C->c != n)
+    {
+        flint_printf("Exception (gf2_mat_mul_classical). "
+                     "Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    gf2_mat_zero(C);
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < k; j++)
+            if (gf2_mat_get_entry(A, i, j))
+                _gf2_mat_row_add(C->rows[i], B->rows[j], limbs, mask);
+}
@@ -0,0 +1,208 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+/*
+    Method of the Four Russians. For each group of M4RM_K consecutive rows
+    of B we tabulate all 2^M4RM_K sums of those rows, restricted to a block
+    of M4RM_BLOCK limbs of columns so that the tables stay in cache, and
+    then every row of C needs a single table lookup per M4RM_K bits of the
+    corresponding row of A. We use one table per byte of a limb of A, so
+    that each pass over C consumes a whole limb of A.
+*/
+
+#define M4RM_K 8
+#define M4RM_BLOCK 32
+
+/*
+    Table t gets the 2^kb sums of the kb rows of B starting at row p + K*t,
+    restricted to the limbs [lb, lb + bw), stored with stride bw.
+*/
+static void
+_m4rm_build_tables(mp_ptr T, const gf2_mat_struct * B,
+                                      slong p, slong nt, slong lb, slong bw)
+{
+    slong j, l, s, t;
+
+    for (t = 0; t < nt; t++)
+    {
+        mp_ptr Tt = T + t*(WORD(1) << M4RM_K)*bw;
+        slong kb = FLINT_MIN(M4RM_K, B->r - p - M4RM_K*t);
+
+        for (l = 0; l < bw; l++)
+            Tt[l] = 0;
+
+        for (j = 0; j < kb; j++)
+        {
+            mp_srcptr b = B->rows[p + M4RM_K*t + j] + lb;
+            mp_ptr D = Tt + (WORD(1) << j)*bw;
+
+            for (s = 0; s < (WORD(1) << j); s++)
+                for (l = 0; l < bw; l++)
+                    D[s*bw + l] = Tt[s*bw + l] ^ b[l];
+        }
+    }
+}
+
+typedef struct
+{
+    gf2_mat_struct * C;
+    const gf2_mat_struct * A;
+    const gf2_mat_struct * B;
+    slong r0;
+    slong r1;
+    slong l0;
+    slong l1;
+}
+_m4rm_arg_struct;
+
+static void
+_m4rm_worker(void * varg)
+{
+    _m4rm_arg_struct * arg = (_m4rm_arg_struct *) varg;
+    gf2_mat_struct * C = arg->C;
+    const gf2_mat_struct * A = arg->A;
+    const gf2_mat_struct * B = arg->B;
+    slong k = A->c, limbs = _gf2_mat_row_limbs(B->c);
+    slong i, l, t, p, lb, bw;
+    mp_srcptr tp[GF2_MAT_TABLES];
+    mp_ptr T;
+
+    if (arg->r0 >= arg->r1 || arg->l0 >= arg->l1)
+        return;
+
+    T = (mp_ptr) flint_malloc(GF2_MAT_TABLES*(WORD(1) << M4RM_K)*M4RM_BLOCK
+                                                           *sizeof(mp_limb_t));
+
+    for (lb = arg->l0; lb < arg->l1; lb += M4RM_BLOCK)
+    {
+        mp_limb_t lmask;
+
+        bw = FLINT_MIN(M4RM_BLOCK, arg->l1 - lb);
+        lmask = (lb + bw == limbs) ? _gf2_mat_last_mask(B->c) : ~UWORD(0);
+
+        for (i = arg->r0; i < arg->r1; i++)
+        {
+            mp_ptr c = C->rows[i] + lb;
+
+            for (l = 0; l < bw - 1; l++)
+                c[l] = 0;
+            c[bw - 1] &= ~lmask;
+        }
+
+        for (p = 0; p < k; p += FLINT_BITS)
+        {
+            slong nt = FLINT_MIN(GF2_MAT_TABLES, (k - p + M4RM_K - 1)/M4RM_K);
+            mp_limb_t amask = (k - p >= FLINT_BITS) ? ~UWORD(0) :
+                                              (UWORD(1) << (k - p)) - 1;
+
+            _m4rm_build_tables(T, B, p, nt, lb, bw);
+
+            for (i = arg->r0; i < arg->r1; i++)
+            {
+                mp_limb_t w = A->rows[i][p / FLINT_BITS] & amask;
+
+                /* unused tables select the zero row of the first one */
+                for (t = 0; t < GF2_MAT_TABLES; t++)
+                    tp[t] = (t < nt) ? T + ((t << M4RM_K)
+                                    + ((w >> (t*M4RM_K)) & 255))*bw : T;
+
+                _gf2_mat_add_table_rows(C->rows[i] + lb, tp, bw, lmask);
+            }
+        }
+    }
+
+    flint_free(T);
+}
+
+void
+gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, m = A->r, k = A->c, n = B->c;
+    slong limbs = _gf2_mat_row_limbs(n);
+    slong num_threads;
+    thread_pool_handle * threads;
+    _m4rm_arg_struct * args;
+    int by_rows;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, m, n);
+        gf2_mat_mul_m4rm(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    if (B->r != k || C->r != m || C->c != n)
+    {
+        flint_printf("Exception (gf2_mat_mul_m4rm). "
+                     "Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (k == 0)
+    {
+        gf2_mat_zero(C);
+        return;
+    }
+
+    /*
+        Split the columns of C between the threads if there are enough of
+        them, otherwise split the rows; each thread then builds its own
+        tables, which only pays off if it has many rows.
+    */
+    by_rows = (limbs < 4*flint_get_num_threads());
+
+    num_threads = flint_request_threads(&threads, (k < 256) ? 1 :
+                                          by_rows ? m/1024 : limbs/4);
+
+    args = (_m4rm_arg_struct *) flint_malloc((num_threads + 1)
+                                                 *sizeof(_m4rm_arg_struct));
+
+    for (i = 0; i <= num_threads; i++)
+    {
+        args[i].C = C;
+        args[i].A = A;
+        args[i].B = B;
+
+        if (by_rows)
+        {
+            args[i].r0 = m*i/(num_threads + 1);
+            args[i].r1 = m*(i + 1)/(num_threads + 1);
+            args[i].l0 = 0;
+            args[i].l1 = limbs;
+        }
+        else
+        {
+            args[i].r0 = 0;
+            args[i].r1 = m;
+            args[i].l0 = limbs*i/(num_threads + 1);
+            args[i].l1 = limbs*(i + 1)/(num_threads + 1);
+        }
+    }
+
+    for (i = 0; i < num_threads; i++)
+        thread_pool_wake(global_thread_pool, threads[i], 0,
+                                                       _m4rm_worker, &args[i]);
+
+    _m4rm_worker(&args[num_threads]);
+
+    for (i = 0; i < num_threads; i++)
+        thread_pool_wait(global_thread_pool, threads[i]);
+
+    flint_give_back_threads(threads, num_threads);
+
+    flint_free(args);
+}
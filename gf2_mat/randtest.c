@@ -0,0 +1,53 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+/*
+    Uniformly random, sparse or almost full matrices, chosen at random so
+    that both generic and structured inputs are exercised.
+*/
+void
+gf2_mat_randtest(gf2_mat_t mat, flint_rand_t state)
+{
+    slong i, j, limbs = _gf2_mat_row_limbs(mat->c);
+    mp_limb_t mask = _gf2_mat_last_mask(mat->c);
+    ulong kind = n_randint(state, 4);
+
+    if (limbs == 0)
+        return;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        for (j = 0; j < limbs; j++)
+        {
+            mp_limb_t w = n_randlimb(state);
+
+            if (kind == 1)
+                w &= n_randlimb(state) & n_randlimb(state) & n_randlimb(state);
+            else if (kind == 2)
+                w |= n_randlimb(state) | n_randlimb(state);
+
+            if (j == limbs - 1)
+                w = (mat->rows[i][j] & ~mask) | (w & mask);
+
+            mat->rows[i][j] = w;
+        }
+    }
+
+    if (kind == 3 && mat->r > 1)
+    {
+        /* make some rows depend on others */
+        for (i = 0; i < mat->r; i++)
+            if (n_randint(state, 2))
+                _gf2_mat_row_add(mat->rows[i],
+                    mat->rows[n_randint(state, mat->r)], limbs, mask);
+    }
+}
@@ -0,0 +1,225 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+/*
+    Method of the Four Russians inversion (M4RI). The columns are processed
+    one limb at a time. Up to FLINT_BITS pivots are found in the limb by
+    Gaussian elimination on the single limb of each remaining row, the
+    pivot rows are reduced against each other, and then every other row is
+    cleared in the limb using GF2_MAT_TABLES tables of all sums of eight
+    pivot rows, one lookup per table and row.
+*/
+
+#define RREF_BLOCK 32
+
+typedef struct
+{
+    gf2_mat_struct * A;
+    slong i0;
+    slong i1;
+    slong r0;
+    slong kk;
+    slong wi;
+    mp_srcptr T;
+    const mp_limb_t * L;
+}
+_rref_arg_struct;
+
+static void
+_rref_worker(void * varg)
+{
+    _rref_arg_struct * arg = (_rref_arg_struct *) varg;
+    gf2_mat_struct * A = arg->A;
+    slong wi = arg->wi, wl = _gf2_mat_row_limbs(A->c) - wi;
+    mp_limb_t mask = _gf2_mat_last_mask(A->c);
+    mp_srcptr tp[GF2_MAT_TABLES];
+    slong i, t, lb, bw;
+
+    /* block the columns so that the parts of the tables in use stay in cache */
+    for (lb = 0; lb < wl; lb += RREF_BLOCK)
+    {
+        bw = FLINT_MIN(RREF_BLOCK, wl - lb);
+
+        for (i = arg->i0; i < arg->i1; i++)
+        {
+            mp_limb_t w, s;
+
+            if (i >= arg->r0 && i < arg->r0 + arg->kk)
+                continue;
+
+            /* bit j of s is the coefficient of pivot row j */
+            w = A->rows[i][wi];
+            s = 0;
+            for (t = 0; t < FLINT_BITS/8; t++)
+                s |= arg->L[256*t + ((w >> (8*t)) & 255)];
+
+            if (s == 0)
+                continue;
+
+            for (t = 0; t < GF2_MAT_TABLES; t++)
+                tp[t] = arg->T + ((t << 8) + ((s >> (8*t)) & 255))*wl + lb;
+
+            _gf2_mat_add_table_rows(A->rows[i] + wi + lb, tp, bw,
+                                            (lb + bw == wl) ? mask : ~UWORD(0));
+        }
+    }
+}
+
+slong
+gf2_mat_rref(gf2_mat_t A)
+{
+    slong m = A->r, n = A->c;
+    slong limbs = _gf2_mat_row_limbs(n);
+    mp_limb_t mask = _gf2_mat_last_mask(n);
+    slong r0, wi, i, j, b, s, t, kk, num_threads;
+    slong pcols[FLINT_BITS];
+    mp_limb_t L[256*(FLINT_BITS/8)];
+    thread_pool_handle * threads;
+    _rref_arg_struct * args;
+    mp_ptr T, wv;
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    T = (mp_ptr) flint_malloc(GF2_MAT_TABLES*256*limbs*sizeof(mp_limb_t));
+    wv = (mp_ptr) flint_malloc(m*sizeof(mp_limb_t));
+
+    num_threads = flint_request_threads(&threads,
+                                            FLINT_MAX(1, m*limbs/32768));
+    args = (_rref_arg_struct *) flint_malloc((num_threads + 1)
+                                                 *sizeof(_rref_arg_struct));
+
+    r0 = 0;
+
+    for (wi = 0; wi < limbs && r0 < m; wi++)
+    {
+        slong kw = FLINT_MIN(FLINT_BITS, n - wi*FLINT_BITS);
+        slong wl = limbs - wi;
+        mp_limb_t wmask = _gf2_mat_last_mask(kw);
+
+        /*
+            Forward elimination on the limb wi of the remaining rows: wv[i]
+            is that limb of row i reduced by the pivots found so far.
+        */
+        for (i = r0; i < m; i++)
+            wv[i] = A->rows[i][wi] & wmask;
+
+        kk = 0;
+
+        for (b = 0; b < kw && r0 + kk < m; b++)
+        {
+            mp_limb_t v;
+
+            for (i = r0 + kk; i < m; i++)
+                if ((wv[i] >> b) & 1)
+                    break;
+
+            if (i == m)
+                continue;
+
+            gf2_mat_swap_rows(A, i, r0 + kk);
+            v = wv[i];
+            wv[i] = wv[r0 + kk];
+            wv[r0 + kk] = v;
+
+            /* branch free, as the condition is unpredictable */
+            for (i = r0 + kk + 1; i < m; i++)
+                wv[i] ^= v & -((wv[i] >> b) & 1);
+
+            pcols[kk] = b;
+            kk++;
+        }
+
+        if (kk == 0)
+            continue;
+
+        /* reduce the pivot rows against each other, forwards then backwards */
+        for (j = 1; j < kk; j++)
+            for (t = 0; t < j; t++)
+                if ((A->rows[r0 + j][wi] >> pcols[t]) & 1)
+                    _gf2_mat_row_add(A->rows[r0 + j] + wi,
+                                     A->rows[r0 + t] + wi, wl, mask);
+
+        for (j = kk - 1; j > 0; j--)
+            for (t = 0; t < j; t++)
+                if ((A->rows[r0 + t][wi] >> pcols[j]) & 1)
+                    _gf2_mat_row_add(A->rows[r0 + t] + wi,
+                                     A->rows[r0 + j] + wi, wl, mask);
+
+        /* table t holds the sums of the pivot rows 8t, ..., 8t + 7 */
+        for (t = 0; t < GF2_MAT_TABLES; t++)
+        {
+            mp_ptr Tt = T + t*256*wl;
+
+            for (i = 0; i < wl; i++)
+                Tt[i] = 0;
+
+            for (j = 0; j < 8 && 8*t + j < kk; j++)
+            {
+                mp_srcptr row = A->rows[r0 + 8*t + j] + wi;
+
+                for (s = 0; s < (WORD(1) << j); s++)
+                {
+                    mp_ptr d = Tt + ((WORD(1) << j) + s)*wl;
+                    mp_srcptr e = Tt + s*wl;
+
+                    for (i = 0; i < wl; i++)
+                        d[i] = e[i] ^ row[i];
+                }
+            }
+        }
+
+        /* L[256*t + x] = pivots whose column is set in byte t equal to x */
+        for (t = 0; t < FLINT_BITS/8; t++)
+            for (s = 0; s < 256; s++)
+                L[256*t + s] = 0;
+
+        for (j = 0; j < kk; j++)
+        {
+            t = pcols[j] / 8;
+
+            for (s = 0; s < 256; s++)
+                if ((s >> (pcols[j] % 8)) & 1)
+                    L[256*t + s] |= UWORD(1) << j;
+        }
+
+        for (i = 0; i <= num_threads; i++)
+        {
+            args[i].A = A;
+            args[i].i0 = m*i/(num_threads + 1);
+            args[i].i1 = m*(i + 1)/(num_threads + 1);
+            args[i].r0 = r0;
+            args[i].kk = kk;
+            args[i].wi = wi;
+            args[i].T = T;
+            args[i].L = L;
+        }
+
+        for (i = 0; i < num_threads; i++)
+            thread_pool_wake(global_thread_pool, threads[i], 0,
+                                                       _rref_worker, &args[i]);
+
+        _rref_worker(&args[num_threads]);
+
+        for (i = 0; i < num_threads; i++)
+            thread_pool_wait(global_thread_pool, threads[i]);
+
+        r0 += kk;
+    }
+
+    flint_give_back_threads(threads, num_threads);
+
+    flint_free(args);
+    flint_free(wv);
+    flint_free(T);
+
+    return r0;
+}
@@ -0,0 +1,34 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_set_nmod_mat(gf2_mat_t B, const nmod_mat_t A)
+{
+    slong i, j;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c; j += FLINT_BITS)
+        {
+            slong k, len = FLINT_MIN(FLINT_BITS, A->c - j);
+            mp_limb_t w = 0;
+
+            for (k = 0; k < len; k++)
+                w |= (A->rows[i][j + k] & UWORD(1)) << k;
+
+            if (len == FLINT_BITS)
+                B->rows[i][j/FLINT_BITS] = w;
+            else
+                B->rows[i][j/FLINT_BITS] = (B->rows[i][j/FLINT_BITS]
+                                     & ~_gf2_mat_last_mask(len)) | w;
+        }
+    }
+}
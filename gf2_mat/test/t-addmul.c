@@ -0,0 +1,77 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("addmul....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C, D, E;
+        slong m, k, n;
+
+        m = n_randint(state, 100);
+        k = n_randint(state, 200);
+        n = n_randint(state, 200);
+
+        gf2_mat_init(A, m, k);
+        gf2_mat_init(B, k, n);
+        gf2_mat_init(C, m, n);
+        gf2_mat_init(D, m, n);
+        gf2_mat_init(E, m, n);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_randtest(C, state);
+        gf2_mat_randtest(D, state);
+
+        gf2_mat_addmul(D, C, A, B);
+        gf2_mat_mul(E, A, B);
+        gf2_mat_add(E, E, C);
+
+        if (!gf2_mat_equal(D, E))
+        {
+            flint_printf("FAIL\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_addmul(C, C, A, B);
+
+        if (!gf2_mat_equal(C, E))
+        {
+            flint_printf("FAIL: aliasing\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        gf2_mat_clear(D);
+        gf2_mat_clear(E);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t a, b, c, d;
+        slong m, k, n;
+
+        m = n_randint(state, 300);
+        k = n_randint(state, 300);
+        n = n_randint(state, 300);
+
+        gf2_mat_init(A, m, k);
+        gf2_mat_init(B, k, n);
+        gf2_mat_init(C, m, n);
+        nmod_mat_init(a, m, k, 2);
+        nmod_mat_init(b, k, n, 2);
+        nmod_mat_init(c, m, n, 2);
+        nmod_mat_init(d, m, n, 2);
+
+        nmod_mat_randtest(a, state);
+        nmod_mat_randtest(b, state);
+        gf2_mat_set_nmod_mat(A, a);
+        gf2_mat_set_nmod_mat(B, b);
+
+        gf2_mat_mul(C, A, B);
+        nmod_mat_mul_classical(d, a, b);
+        gf2_mat_get_nmod_mat(c, C);
+
+        if (!nmod_mat_equal(c, d))
+        {
+            flint_printf("FAIL\n");
+            flint_printf("m = %wd, k = %wd, n = %wd\n", m, k, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (m == k)
+        {
+            gf2_mat_mul(B, A, B);
+            gf2_mat_get_nmod_mat(c, B);
+
+            if (!nmod_mat_equal(c, d))
+            {
+                flint_printf("FAIL: aliasing\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        nmod_mat_clear(a);
+        nmod_mat_clear(b);
+        nmod_mat_clear(c);
+        nmod_mat_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
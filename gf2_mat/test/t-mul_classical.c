@@ -0,0 +1,89 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_classical....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t a, b, c, d;
+        slong m, k, n;
+
+        m = n_randint(state, 100);
+        k = n_randint(state, 200);
+        n = n_randint(state, 200);
+
+        gf2_mat_init(A, m, k);
+        gf2_mat_init(B, k, n);
+        gf2_mat_init(C, m, n);
+        nmod_mat_init(a, m, k, 2);
+        nmod_mat_init(b, k, n, 2);
+        nmod_mat_init(c, m, n, 2);
+        nmod_mat_init(d, m, n, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_randtest(C, state);
+
+        gf2_mat_mul_classical(C, A, B);
+
+        gf2_mat_get_nmod_mat(a, A);
+        gf2_mat_get_nmod_mat(b, B);
+        gf2_mat_get_nmod_mat(c, C);
+        nmod_mat_mul_classical(d, a, b);
+
+        if (!nmod_mat_equal(c, d))
+        {
+            flint_printf("FAIL\n");
+            flint_printf("m = %wd, k = %wd, n = %wd\n", m, k, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (m == k)
+        {
+            gf2_mat_mul_classical(A, A, B);
+            gf2_mat_get_nmod_mat(c, A);
+
+            if (!nmod_mat_equal(c, d))
+            {
+                flint_printf("FAIL: aliasing\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        nmod_mat_clear(a);
+        nmod_mat_clear(b);
+        nmod_mat_clear(c);
+        nmod_mat_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+/* products of windows, which must leave the rest of the parents alone */
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_strassen....");
+    fflush(stdout);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t PA, PB, PC, PD, A, B, C, D;
+        slong m, k, n, j, l;
+
+        m = n_randint(state, 300);
+        k = n_randint(state, 400);
+        n = n_randint(state, 400);
+
+        gf2_mat_init(PA, m + 2, k + 2*FLINT_BITS);
+        gf2_mat_init(PB, k + 2, n + 2*FLINT_BITS);
+        gf2_mat_init(PC, m + 2, n + 2*FLINT_BITS);
+        gf2_mat_init(PD, m + 2, n + 2*FLINT_BITS);
+
+        gf2_mat_randtest(PA, state);
+        gf2_mat_randtest(PB, state);
+        gf2_mat_randtest(PC, state);
+        gf2_mat_set(PD, PC);
+
+        gf2_mat_window_init(A, PA, 1, FLINT_BITS, m + 1, k + FLINT_BITS);
+        gf2_mat_window_init(B, PB, 1, FLINT_BITS, k + 1, n + FLINT_BITS);
+        gf2_mat_window_init(C, PC, 1, FLINT_BITS, m + 1, n + FLINT_BITS);
+        gf2_mat_init(D, m, n);
+
+        gf2_mat_mul_strassen(C, A, B);
+        gf2_mat_mul_classical(D, A, B);
+
+        if (!gf2_mat_equal(C, D))
+        {
+            flint_printf("FAIL: product\n");
+            flint_printf("m = %wd, k = %wd, n = %wd\n", m, k, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (j = 0; j < m + 2; j++)
+        {
+            for (l = 0; l < n + 2*FLINT_BITS; l++)
+            {
+                if (j >= 1 && j < m + 1 && l >= FLINT_BITS && l < n + FLINT_BITS)
+                    continue;
+
+                if (gf2_mat_get_entry(PC, j, l) != gf2_mat_get_entry(PD, j, l))
+                {
+                    flint_printf("FAIL: outside of window\n");
+                    flint_printf("m = %wd, k = %wd, n = %wd\n", m, k, n);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        gf2_mat_window_clear(A);
+        gf2_mat_window_clear(B);
+        gf2_mat_window_clear(C);
+        gf2_mat_clear(D);
+        gf2_mat_clear(PA);
+        gf2_mat_clear(PB);
+        gf2_mat_clear(PC);
+        gf2_mat_clear(PD);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
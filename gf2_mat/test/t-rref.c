@@ -0,0 +1,108 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+#include "perm.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rref....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A;
+        nmod_mat_t a, b;
+        slong m, n, r1, r2, * piv, * P;
+
+        m = n_randint(state, 100);
+        n = n_randint(state, 200);
+
+        gf2_mat_init(A, m, n);
+        nmod_mat_init(a, m, n, 2);
+        nmod_mat_init(b, m, n, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_get_nmod_mat(a, A);
+
+        /* the elimination through LU, which nmod_mat_rref bypasses mod 2 */
+        piv = (slong *) flint_malloc((n + 1)*sizeof(slong));
+        P = _perm_init(m);
+        r1 = gf2_mat_rref(A);
+        r2 = (m == 0 || n == 0) ? 0 : _nmod_mat_rref(a, piv, P);
+        flint_free(piv);
+        _perm_clear(P);
+        gf2_mat_get_nmod_mat(b, A);
+
+        if (r1 != r2 || !nmod_mat_equal(a, b))
+        {
+            flint_printf("FAIL\n");
+            flint_printf("m = %wd, n = %wd, r1 = %wd, r2 = %wd\n", m, n, r1, r2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (gf2_mat_rank(A) != r1)
+        {
+            flint_printf("FAIL: rank\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_clear(A);
+        nmod_mat_clear(a);
+        nmod_mat_clear(b);
+    }
+
+    /* threaded elimination of larger matrices */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        slong m, n, r1, r2;
+
+        m = 1000 + n_randint(state, 500);
+        n = 2000 + n_randint(state, 3000);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, m, n);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_set(B, A);
+
+        flint_set_num_threads(1);
+        r1 = gf2_mat_rref(A);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        r2 = gf2_mat_rref(B);
+
+        if (r1 != r2 || !gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL: threads\n");
+            flint_printf("m = %wd, n = %wd, r1 = %wd, r2 = %wd\n", m, n, r1, r2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t C, D;
+        slong r, c, j, k;
+
+        r = n_randint(state, 50);
+        c = n_randint(state, 200);
+
+        gf2_mat_init(A, r, c);
+        gf2_mat_init(B, r, c);
+        nmod_mat_init(C, r, c, 2);
+        nmod_mat_init(D, r, c, 2);
+
+        nmod_mat_randtest(C, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_set_nmod_mat(A, C);
+
+        for (j = 0; j < r; j++)
+        {
+            for (k = 0; k < c; k++)
+            {
+                if (gf2_mat_get_entry(A, j, k) != nmod_mat_entry(C, j, k))
+                {
+                    flint_printf("FAIL: entry\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        gf2_mat_get_nmod_mat(D, A);
+
+        if (!nmod_mat_equal(C, D))
+        {
+            flint_printf("FAIL: roundtrip\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_set(B, A);
+
+        if (!gf2_mat_equal(A, B) || gf2_mat_is_zero(A) != nmod_mat_is_zero(C))
+        {
+            flint_printf("FAIL: set, equal, is_zero\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_one(A);
+        nmod_mat_one(C);
+        gf2_mat_get_nmod_mat(D, A);
+
+        if (!nmod_mat_equal(C, D))
+        {
+            flint_printf("FAIL: one\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_zero(A);
+
+        if (!gf2_mat_is_zero(A))
+        {
+            flint_printf("FAIL: zero\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,76 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t C, D, E;
+        slong r, c;
+
+        r = n_randint(state, 150);
+        c = n_randint(state, 150);
+
+        gf2_mat_init(A, r, c);
+        gf2_mat_init(B, c, r);
+        nmod_mat_init(C, r, c, 2);
+        nmod_mat_init(D, c, r, 2);
+        nmod_mat_init(E, c, r, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_transpose(B, A);
+
+        gf2_mat_get_nmod_mat(C, A);
+        gf2_mat_get_nmod_mat(D, B);
+        nmod_mat_transpose(E, C);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: against nmod_mat\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_transpose(B, B);
+
+        if (!gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL: aliasing\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,48 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+#include "longlong.h"
+
+void
+gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A)
+{
+    slong i, j;
+
+    if (B == A)
+    {
+        gf2_mat_t t;
+        gf2_mat_init(t, A->c, A->r);
+        gf2_mat_transpose(t, A);
+        gf2_mat_swap(B, t);
+        gf2_mat_clear(t);
+        return;
+    }
+
+    gf2_mat_zero(B);
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c; j += FLINT_BITS)
+        {
+            mp_limb_t w = A->rows[i][j / FLINT_BITS];
+
+            if (A->c - j < FLINT_BITS)
+                w &= _gf2_mat_last_mask(A->c - j);
+
+            while (w != 0)
+            {
+                slong k;
+                count_trailing_zeros(k, w);
+                B->rows[j + k][i / FLINT_BITS] |= UWORD(1) << (i % FLINT_BITS);
+                w &= w - 1;
+            }
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_window_init(gf2_mat_t window, const gf2_mat_t mat,
+                                     slong r1, slong c1, slong r2, slong c2)
+{
+    slong i;
+
+    if (c1 % FLINT_BITS != 0 && c2 > c1)
+    {
+        flint_printf("Exception (gf2_mat_window_init). "
+                     "Column offset not divisible by FLINT_BITS.\n");
+        flint_abort();
+    }
+
+    window->entries = NULL;
+
+    if (r2 > r1)
+        window->rows = (mp_limb_t **) flint_malloc((r2 - r1)*sizeof(mp_limb_t *));
+    else
+        window->rows = NULL;
+
+    if (c2 > c1)
+    {
+        for (i = 0; i < r2 - r1; i++)
+            window->rows[i] = mat->rows[r1 + i] + c1/FLINT_BITS;
+    }
+    else
+    {
+        for (i = 0; i < r2 - r1; i++)
+            window->rows[i] = NULL;
+    }
+
+    window->r = r2 - r1;
+    window->c = c2 - c1;
+}
+
+void
+gf2_mat_window_clear(gf2_mat_t window)
+{
+    flint_free(window->rows);
+}
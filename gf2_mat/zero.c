@@ -0,0 +1,28 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_mat.h"
+
+void
+gf2_mat_zero(gf2_mat_t mat)
+{
+    slong i, j, limbs = _gf2_mat_row_limbs(mat->c);
+    mp_limb_t mask = _gf2_mat_last_mask(mat->c);
+
+    if (limbs == 0)
+        return;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        for (j = 0; j < limbs - 1; j++)
+            mat->rows[i][j] = 0;
+
+        mat->rows[i][limbs - 1] &= ~mask;
+    }
+}
@@ -0,0 +1,119 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GF2_SPARSE_MAT_H
+#define GF2_SPARSE_MAT_H
+
+#ifdef GF2_SPARSE_MAT_INLINES_C
+#define GF2_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define GF2_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#include <stdint.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "nmod_mat.h"
+#include "thread_support.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Compressed sparse row storage of a matrix over GF(2): the nonzero
+    entries of row i are in columns cols[k] for
+    row_starts[i] <= k < row_starts[i + 1], in strictly increasing order.
+*/
+typedef struct
+{
+    slong r;
+    slong c;
+    slong * row_starts;
+    slong * cols;
+    slong row_alloc;    /* allocated length of row_starts minus one */
+    slong alloc;        /* allocated length of cols */
+}
+gf2_sparse_mat_struct;
+
+typedef gf2_sparse_mat_struct gf2_sparse_mat_t[1];
+
+/* Memory management and basic manipulation **********************************/
+
+FLINT_DLL void gf2_sparse_mat_init(gf2_sparse_mat_t M, slong rows, slong cols);
+
+FLINT_DLL void gf2_sparse_mat_clear(gf2_sparse_mat_t M);
+
+FLINT_DLL void gf2_sparse_mat_fit_length(gf2_sparse_mat_t M,
+                                                       slong rows, slong nnz);
+
+GF2_SPARSE_MAT_INLINE
+void gf2_sparse_mat_swap(gf2_sparse_mat_t M1, gf2_sparse_mat_t M2)
+{
+    gf2_sparse_mat_struct t = *M1;
+    *M1 = *M2;
+    *M2 = t;
+}
+
+GF2_SPARSE_MAT_INLINE
+slong gf2_sparse_mat_nnz(const gf2_sparse_mat_t M)
+{
+    return M->row_starts[M->r];
+}
+
+FLINT_DLL void gf2_sparse_mat_append_row(gf2_sparse_mat_t M,
+                                               const slong * cols, slong len);
+
+FLINT_DLL int gf2_sparse_mat_equal(const gf2_sparse_mat_t A,
+                                                    const gf2_sparse_mat_t B);
+
+FLINT_DLL void gf2_sparse_mat_transpose(gf2_sparse_mat_t B,
+                                                    const gf2_sparse_mat_t A);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL void gf2_sparse_mat_set_nmod_mat(gf2_sparse_mat_t M,
+                                                          const nmod_mat_t A);
+
+FLINT_DLL void gf2_sparse_mat_get_nmod_mat(nmod_mat_t A,
+                                                    const gf2_sparse_mat_t M);
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void gf2_sparse_mat_randtest(gf2_sparse_mat_t M,
+                     flint_rand_t state, slong rows, slong cols, slong weight);
+
+/* Products with blocks of vectors *******************************************/
+
+FLINT_DLL void gf2_sparse_mat_mul_block(uint64_t * y,
+                 const gf2_sparse_mat_t M, const uint64_t * x, slong words);
+
+/* Nullspace *****************************************************************/
+
+FLINT_DLL slong gf2_sparse_mat_filter_columns(slong * cols,
+                                      const gf2_sparse_mat_t M, slong extra);
+
+FLINT_DLL int _gf2_sparse_mat_block_lanczos(uint64_t * x,
+        const gf2_sparse_mat_t M, const gf2_sparse_mat_t MT, slong words,
+                                                         flint_rand_t state);
+
+FLINT_DLL slong gf2_sparse_mat_nullspace_block_lanczos(uint64_t * X,
+         const gf2_sparse_mat_t M, slong words, flint_rand_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,57 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_sparse_mat.h"
+
+static int
+_slong_cmp(const void * a, const void * b)
+{
+    slong x = *((const slong *) a);
+    slong y = *((const slong *) b);
+
+    return (x > y) - (x < y);
+}
+
+/* repeated columns cancel in pairs, as for exponent vectors mod 2 */
+void
+gf2_sparse_mat_append_row(gf2_sparse_mat_t M, const slong * cols, slong len)
+{
+    slong i, k, start;
+    slong * c;
+
+    start = M->row_starts[M->r];
+    gf2_sparse_mat_fit_length(M, M->r + 1, start + len);
+
+    c = M->cols + start;
+
+    for (i = 0; i < len; i++)
+    {
+        if (cols[i] < 0 || cols[i] >= M->c)
+        {
+            flint_printf("Exception (gf2_sparse_mat_append_row). "
+                                                  "Column out of range.\n");
+            flint_abort();
+        }
+
+        c[i] = cols[i];
+    }
+
+    qsort(c, len, sizeof(slong), _slong_cmp);
+
+    for (i = k = 0; i < len; i++)
+    {
+        if (i + 1 < len && c[i] == c[i + 1])
+            i++;
+        else
+            c[k++] = c[i];
+    }
+
+    M->r++;
+    M->row_starts[M->r] = start + k;
+}
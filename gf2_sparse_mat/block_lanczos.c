@@ -0,0 +1,725 @@
+/*
+    Copyright 2006 Jason Papadopoulos.
+    Copyright 2006, 2011 William Hart.
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "gf2_sparse_mat.h"
+#include "thread_pool.h"
+
+/*
+    Montgomery's block Lanczos algorithm, generalised from the version in
+    the quadratic sieve to blocks of K = 64*W bits for W words. Vectors
+    of length n are stored as n blocks of W words, so that bit k of block
+    i is entry i of the k-th vector. K x K matrices are stored as K rows
+    of W words.
+*/
+
+#define MAX_WORDS 4
+
+/* below this many words per vector the dense kernels are not threaded */
+#define KERNEL_THREADED_CUTOFF 20000
+
+#define BIT_WORD(i) ((i) / 64)
+#define BIT_MASK(i) (((uint64_t) 1) << ((i) % 64))
+
+/* so that the kernels are specialised for each W */
+#if defined(__GNUC__)
+#define KERNEL_INLINE static __inline__ __attribute__((always_inline))
+#else
+#define KERNEL_INLINE static __inline__
+#endif
+
+/* c = a*b for K x K matrices. The result may overwrite a or b. */
+static void
+_mul_KxK_KxK(uint64_t * c, const uint64_t * a, const uint64_t * b, slong W)
+{
+    uint64_t tmp[64*MAX_WORDS*MAX_WORDS];
+    slong i, j, l, K = 64*W;
+
+    for (i = 0; i < K; i++)
+    {
+        uint64_t * t = tmp + i*W;
+
+        for (l = 0; l < W; l++)
+            t[l] = 0;
+
+        for (j = 0; j < K; j++)
+            if (a[i*W + BIT_WORD(j)] & BIT_MASK(j))
+                for (l = 0; l < W; l++)
+                    t[l] ^= b[j*W + l];
+    }
+
+    memcpy(c, tmp, K*W*sizeof(uint64_t));
+}
+
+/*
+    Fills the K/8 tables of 256 entries of c with the partial products
+    (v << 8t)*x for all bytes v, so that a product by x takes one lookup
+    per byte.
+*/
+KERNEL_INLINE void
+_precompute_NxK_KxK(uint64_t * c, const uint64_t * x, const slong W)
+{
+    slong t, b, v, l, K = 64*W;
+
+    for (t = 0; t < K/8; t++)
+    {
+        uint64_t * ct = c + t*256*W;
+        const uint64_t * xt = x + 8*t*W;
+
+        for (l = 0; l < W; l++)
+            ct[l] = 0;
+
+        for (b = 0; b < 8; b++)
+            for (v = WORD(1) << b; v < WORD(2) << b; v++)
+                for (l = 0; l < W; l++)
+                    ct[v*W + l] = ct[(v - (WORD(1) << b))*W + l] ^ xt[b*W + l];
+    }
+}
+
+/* y[start, stop) ^= v[start, stop)*x given the tables c of x */
+KERNEL_INLINE void
+_mul_NxK_KxK_acc_w(uint64_t * y, const uint64_t * v, const uint64_t * c,
+                                     slong start, slong stop, const slong W)
+{
+    slong i, j, l;
+
+    for (i = start; i < stop; i++)
+    {
+        uint64_t acc[MAX_WORDS];
+
+        for (l = 0; l < W; l++)
+            acc[l] = y[i*W + l];
+
+        for (j = 0; j < W; j++)
+        {
+            uint64_t word = v[i*W + j];
+            const uint64_t * cj = c + 8*j*256*W;
+            const uint64_t * ct;
+
+#define ACC_BYTE(b)                                                  \
+            ct = cj + ((b)*256 + ((word >> (8*(b))) & 0xff))*W;      \
+            for (l = 0; l < W; l++)                                  \
+                acc[l] ^= ct[l];
+
+            ACC_BYTE(0) ACC_BYTE(1) ACC_BYTE(2) ACC_BYTE(3)
+            ACC_BYTE(4) ACC_BYTE(5) ACC_BYTE(6) ACC_BYTE(7)
+#undef ACC_BYTE
+        }
+
+        for (l = 0; l < W; l++)
+            y[i*W + l] = acc[l];
+    }
+}
+
+/* adds y[i] to entry x[i] of the tables c for i in [start, stop) */
+KERNEL_INLINE void
+_mul_KxN_NxK_w(uint64_t * c, const uint64_t * x, const uint64_t * y,
+                                     slong start, slong stop, const slong W)
+{
+    slong i, j, l;
+
+    for (i = start; i < stop; i++)
+    {
+        uint64_t yi[MAX_WORDS];
+
+        for (l = 0; l < W; l++)
+            yi[l] = y[i*W + l];
+
+        for (j = 0; j < W; j++)
+        {
+            uint64_t word = x[i*W + j];
+            uint64_t * cj = c + 8*j*256*W;
+            uint64_t * ct;
+
+#define SCATTER_BYTE(b)                                              \
+            ct = cj + ((b)*256 + ((word >> (8*(b))) & 0xff))*W;      \
+            for (l = 0; l < W; l++)                                  \
+                ct[l] ^= yi[l];
+
+            SCATTER_BYTE(0) SCATTER_BYTE(1) SCATTER_BYTE(2) SCATTER_BYTE(3)
+            SCATTER_BYTE(4) SCATTER_BYTE(5) SCATTER_BYTE(6) SCATTER_BYTE(7)
+#undef SCATTER_BYTE
+        }
+    }
+}
+
+typedef struct
+{
+    uint64_t * y;
+    const uint64_t * v;
+    uint64_t * c;
+    slong start;
+    slong stop;
+    slong W;
+} _kernel_arg_struct;
+
+static void
+_mul_NxK_KxK_acc_worker(void * varg)
+{
+    _kernel_arg_struct * arg = (_kernel_arg_struct *) varg;
+
+    if (arg->W == 1)
+        _mul_NxK_KxK_acc_w(arg->y, arg->v, arg->c, arg->start, arg->stop, 1);
+    else
+        _mul_NxK_KxK_acc_w(arg->y, arg->v, arg->c, arg->start, arg->stop, 4);
+}
+
+static void
+_mul_KxN_NxK_worker(void * varg)
+{
+    _kernel_arg_struct * arg = (_kernel_arg_struct *) varg;
+    slong K = 64*arg->W;
+
+    memset(arg->c, 0, (K/8)*256*arg->W*sizeof(uint64_t));
+
+    if (arg->W == 1)
+        _mul_KxN_NxK_w(arg->c, arg->v, arg->y, arg->start, arg->stop, 1);
+    else
+        _mul_KxN_NxK_w(arg->c, arg->v, arg->y, arg->start, arg->stop, 4);
+}
+
+/*
+    Splits the n rows between the available threads. For x^T y every
+    helper thread fills its own copy of the tables.
+*/
+static slong
+_kernel_threads(thread_pool_handle ** threads, slong n, slong W)
+{
+    if (n*W < KERNEL_THREADED_CUTOFF)
+    {
+        *threads = NULL;
+        return 0;
+    }
+
+    return flint_request_threads(threads, flint_get_num_threads());
+}
+
+/* y ^= v*x for the n x K matrix v and K x K matrix x, using scratch c */
+static void
+_mul_NxK_KxK_acc(uint64_t * y, const uint64_t * v, const uint64_t * x,
+                                               uint64_t * c, slong n, slong W)
+{
+    _kernel_arg_struct * args;
+    thread_pool_handle * threads;
+    slong i, nw;
+
+    _precompute_NxK_KxK(c, x, W);
+
+    nw = _kernel_threads(&threads, n, W);
+    args = (_kernel_arg_struct *) flint_malloc((nw + 1)*sizeof(_kernel_arg_struct));
+
+    for (i = 0; i <= nw; i++)
+    {
+        args[i].y = y;
+        args[i].v = v;
+        args[i].c = c;
+        args[i].start = n*i/(nw + 1);
+        args[i].stop = n*(i + 1)/(nw + 1);
+        args[i].W = W;
+    }
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wake(global_thread_pool, threads[i], 0,
+                                          _mul_NxK_KxK_acc_worker, &args[i]);
+
+    _mul_NxK_KxK_acc_worker(&args[nw]);
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wait(global_thread_pool, threads[i]);
+
+    flint_give_back_threads(threads, nw);
+    flint_free(args);
+}
+
+/* xy = x^T*y for n x K matrices x and y, using scratch c */
+static void
+_mul_KxN_NxK(uint64_t * xy, const uint64_t * x, const uint64_t * y,
+                                               uint64_t * c, slong n, slong W)
+{
+    _kernel_arg_struct * args;
+    thread_pool_handle * threads;
+    uint64_t * cw;
+    slong i, j, t, b, v, l, nw, K = 64*W, size = (K/8)*256*W;
+
+    nw = _kernel_threads(&threads, n, W);
+    args = (_kernel_arg_struct *) flint_malloc((nw + 1)*sizeof(_kernel_arg_struct));
+    cw = (uint64_t *) flint_malloc((nw*size + 1)*sizeof(uint64_t));
+
+    for (i = 0; i <= nw; i++)
+    {
+        args[i].y = (uint64_t *) y;
+        args[i].v = x;
+        args[i].c = (i == nw) ? c : cw + i*size;
+        args[i].start = n*i/(nw + 1);
+        args[i].stop = n*(i + 1)/(nw + 1);
+        args[i].W = W;
+    }
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wake(global_thread_pool, threads[i], 0,
+                                              _mul_KxN_NxK_worker, &args[i]);
+
+    _mul_KxN_NxK_worker(&args[nw]);
+
+    for (i = 0; i < nw; i++)
+    {
+        thread_pool_wait(global_thread_pool, threads[i]);
+
+        for (j = 0; j < size; j++)
+            c[j] ^= cw[i*size + j];
+    }
+
+    flint_give_back_threads(threads, nw);
+    flint_free(args);
+    flint_free(cw);
+
+    /* row 8t + b of xy collects the entries of table t with bit b set */
+    for (t = 0; t < K/8; t++)
+    {
+        const uint64_t * ct = c + t*256*W;
+
+        for (b = 0; b < 8; b++)
+        {
+            uint64_t acc[MAX_WORDS];
+
+            for (l = 0; l < W; l++)
+                acc[l] = 0;
+
+            for (v = WORD(1) << b; v < 256; v = (v + 1) | (WORD(1) << b))
+                for (l = 0; l < W; l++)
+                    acc[l] ^= ct[v*W + l];
+
+            for (l = 0; l < W; l++)
+                xy[(8*t + b)*W + l] = acc[l];
+        }
+    }
+}
+
+/*
+    Given a K x K matrix t and a list of last_dim column indices last_s,
+    finds a submatrix of t that is invertible, stores its inverse in w
+    and lists the columns it uses in s. Returns the dimension of the
+    submatrix, or 0 if the iteration has broken down.
+*/
+static slong
+_find_nonsingular_sub(const uint64_t * t, slong * s, const slong * last_s,
+                                     slong last_dim, uint64_t * w, slong W)
+{
+    uint64_t M[64*MAX_WORDS][2*MAX_WORDS];
+    uint64_t mask[MAX_WORDS], tmp;
+    slong cols[64*MAX_WORDS];
+    slong i, j, l, dim, K = 64*W;
+    uint64_t * row_i, * row_j;
+
+    /* M = [t | I] */
+    for (i = 0; i < K; i++)
+    {
+        for (l = 0; l < W; l++)
+        {
+            M[i][l] = t[i*W + l];
+            M[i][W + l] = 0;
+        }
+
+        M[i][W + BIT_WORD(i)] = BIT_MASK(i);
+    }
+
+    /* the columns in last_s go last */
+    for (l = 0; l < W; l++)
+        mask[l] = 0;
+
+    for (i = 0; i < last_dim; i++)
+    {
+        cols[K - 1 - i] = last_s[i];
+        mask[BIT_WORD(last_s[i])] |= BIT_MASK(last_s[i]);
+    }
+
+    for (i = j = 0; i < K; i++)
+        if (!(mask[BIT_WORD(i)] & BIT_MASK(i)))
+            cols[j++] = i;
+
+    for (i = dim = 0; i < K; i++)
+    {
+        slong cw = BIT_WORD(cols[i]);
+        uint64_t cm = BIT_MASK(cols[i]);
+
+        /* find the next pivot row and put in row i */
+        row_i = M[cols[i]];
+
+        for (j = i; j < K; j++)
+        {
+            row_j = M[cols[j]];
+
+            if (row_j[cw] & cm)
+            {
+                for (l = 0; l < 2*W; l++)
+                {
+                    tmp = row_j[l];
+                    row_j[l] = row_i[l];
+                    row_i[l] = tmp;
+                }
+                break;
+            }
+        }
+
+        /* if found, eliminate the pivot column from all other rows */
+        if (j < K)
+        {
+            for (j = 0; j < K; j++)
+            {
+                row_j = M[cols[j]];
+
+                if (row_i != row_j && (row_j[cw] & cm))
+                    for (l = 0; l < 2*W; l++)
+                        row_j[l] ^= row_i[l];
+            }
+
+            s[dim++] = cols[i];
+            continue;
+        }
+
+        /* otherwise use the right half to compensate */
+        for (j = i; j < K; j++)
+        {
+            row_j = M[cols[j]];
+
+            if (row_j[W + cw] & cm)
+            {
+                for (l = 0; l < 2*W; l++)
+                {
+                    tmp = row_j[l];
+                    row_j[l] = row_i[l];
+                    row_i[l] = tmp;
+                }
+                break;
+            }
+        }
+
+        if (j == K)
+            return 0;
+
+        for (j = 0; j < K; j++)
+        {
+            row_j = M[cols[j]];
+
+            if (row_i != row_j && (row_j[W + cw] & cm))
+                for (l = 0; l < 2*W; l++)
+                    row_j[l] ^= row_i[l];
+        }
+
+        for (l = 0; l < 2*W; l++)
+            row_i[l] = 0;
+    }
+
+    for (i = 0; i < K; i++)
+        for (l = 0; l < W; l++)
+            w[i*W + l] = M[i][W + l];
+
+    /* the recurrence needs every column in s or last_s */
+    for (l = 0; l < W; l++)
+        mask[l] = 0;
+
+    for (i = 0; i < dim; i++)
+        mask[BIT_WORD(s[i])] |= BIT_MASK(s[i]);
+
+    for (i = 0; i < last_dim; i++)
+        mask[BIT_WORD(last_s[i])] |= BIT_MASK(last_s[i]);
+
+    for (l = 0; l < W; l++)
+        if (mask[l] != ~(uint64_t) 0)
+            return 0;
+
+    return dim;
+}
+
+/* sets row k of trans, a K x n bit matrix, to vector k of v */
+static void
+_transpose_vector(uint64_t ** trans, const uint64_t * v, slong n, slong W)
+{
+    slong i, j, l;
+    uint64_t word;
+
+    for (i = 0; i < n; i++)
+    {
+        for (l = 0; l < W; l++)
+        {
+            word = v[i*W + l];
+
+            for (j = 64*l; word != 0; j++, word >>= 1)
+                if (word & 1)
+                    trans[j][BIT_WORD(i)] |= BIT_MASK(i);
+        }
+    }
+}
+
+/*
+    At the end of the iteration x and v contain mostly nullspace vectors
+    of A^T A. Given ax = A x and av = A v, Gaussian elimination on the
+    columns of [ax | av], mirrored on [x | v], finds the combinations
+    that are in the nullspace of A and stores them in x.
+*/
+static void
+_combine_cols(uint64_t * x, const uint64_t * v, const uint64_t * ax,
+                              const uint64_t * av, slong n, slong r, slong W)
+{
+    slong i, j, k, bitpos, col, K = 64*W, num_deps = 2*K;
+    slong words_n = (n + 63)/64, words_r = (r + 63)/64;
+    uint64_t * matrix[2*64*MAX_WORDS], * amatrix[2*64*MAX_WORDS], * tmp;
+    uint64_t mask;
+
+    for (i = 0; i < num_deps; i++)
+    {
+        matrix[i] = (uint64_t *) flint_calloc(words_n + 1, sizeof(uint64_t));
+        amatrix[i] = (uint64_t *) flint_calloc(words_r + 1, sizeof(uint64_t));
+    }
+
+    _transpose_vector(matrix, x, n, W);
+    _transpose_vector(matrix + K, v, n, W);
+    _transpose_vector(amatrix, ax, r, W);
+    _transpose_vector(amatrix + K, av, r, W);
+
+    for (i = bitpos = 0; i < num_deps && bitpos < r; bitpos++)
+    {
+        mask = BIT_MASK(bitpos);
+        col = BIT_WORD(bitpos);
+
+        for (j = i; j < num_deps; j++)
+        {
+            if (amatrix[j][col] & mask)
+            {
+                tmp = matrix[i]; matrix[i] = matrix[j]; matrix[j] = tmp;
+                tmp = amatrix[i]; amatrix[i] = amatrix[j]; amatrix[j] = tmp;
+                break;
+            }
+        }
+
+        if (j == num_deps)
+            continue;
+
+        for (j++; j < num_deps; j++)
+        {
+            if (amatrix[j][col] & mask)
+            {
+                for (k = 0; k < words_r; k++)
+                    amatrix[j][k] ^= amatrix[i][k];
+                for (k = 0; k < words_n; k++)
+                    matrix[j][k] ^= matrix[i][k];
+            }
+        }
+
+        i++;
+    }
+
+    /* rows i to K - 1 are in the nullspace */
+    memset(x, 0, n*W*sizeof(uint64_t));
+
+    for (k = i; k < K; k++)
+        for (j = 0; j < n; j++)
+            if (matrix[k][BIT_WORD(j)] & BIT_MASK(j))
+                x[j*W + BIT_WORD(k)] |= BIT_MASK(k);
+
+    for (i = 0; i < num_deps; i++)
+    {
+        flint_free(matrix[i]);
+        flint_free(amatrix[i]);
+    }
+}
+
+/* y = M^T M x */
+static void
+_mul_sym(uint64_t * y, const gf2_sparse_mat_t M, const gf2_sparse_mat_t MT,
+                             const uint64_t * x, uint64_t * scratch, slong W)
+{
+    gf2_sparse_mat_mul_block(scratch, M, x, W);
+    gf2_sparse_mat_mul_block(y, MT, scratch, W);
+}
+
+int
+_gf2_sparse_mat_block_lanczos(uint64_t * x, const gf2_sparse_mat_t M,
+              const gf2_sparse_mat_t MT, slong W, flint_rand_t state)
+{
+    uint64_t * vnext, * v[3], * v0, * scratch, * c, * tmp;
+    uint64_t * winv[3], * vt_a_v[2], * vt_a2_v[2], * d, * e, * f, * f2;
+    uint64_t mask0[MAX_WORDS], mask1[MAX_WORDS];
+    slong s[2][64*MAX_WORDS];
+    slong i, l, iter, dim0, dim1, vsize, K = 64*W;
+    slong n = M->c, r = M->r;
+    int success = 0;
+
+    /* M x and M v are stored in the spare vectors at the end */
+    vsize = FLINT_MAX(n, r)*W;
+
+    v[0] = (uint64_t *) flint_malloc(vsize*sizeof(uint64_t));
+    v[1] = (uint64_t *) flint_malloc(vsize*sizeof(uint64_t));
+    v[2] = (uint64_t *) flint_malloc(vsize*sizeof(uint64_t));
+    vnext = (uint64_t *) flint_malloc(vsize*sizeof(uint64_t));
+    v0 = (uint64_t *) flint_malloc(vsize*sizeof(uint64_t));
+    scratch = (uint64_t *) flint_malloc(vsize*sizeof(uint64_t));
+    c = (uint64_t *) flint_malloc((K/8)*256*W*sizeof(uint64_t));
+
+    for (i = 0; i < 3; i++)
+        winv[i] = (uint64_t *) flint_calloc(K*W, sizeof(uint64_t));
+    for (i = 0; i < 2; i++)
+    {
+        vt_a_v[i] = (uint64_t *) flint_calloc(K*W, sizeof(uint64_t));
+        vt_a2_v[i] = (uint64_t *) flint_calloc(K*W, sizeof(uint64_t));
+    }
+    d = (uint64_t *) flint_malloc(K*W*sizeof(uint64_t));
+    e = (uint64_t *) flint_malloc(K*W*sizeof(uint64_t));
+    f = (uint64_t *) flint_malloc(K*W*sizeof(uint64_t));
+    f2 = (uint64_t *) flint_malloc(K*W*sizeof(uint64_t));
+
+    /*
+        The iteration computes v[0], vt_a_v[0], vt_a2_v[0], s[0] and
+        winv[0]. Higher subscripts hold past versions, which start off
+        empty except for s[1], which contains all the column indices.
+    */
+    memset(v[1], 0, vsize*sizeof(uint64_t));
+    memset(v[2], 0, vsize*sizeof(uint64_t));
+
+    for (i = 0; i < K; i++)
+        s[1][i] = i;
+
+    dim0 = 0;
+    dim1 = K;
+    for (l = 0; l < W; l++)
+        mask1[l] = ~(uint64_t) 0;
+
+    /* the solution x starts off random and v[0] as A x */
+    for (i = 0; i < n*W; i++)
+#if FLINT_BITS == 64
+        x[i] = (uint64_t) n_randlimb(state);
+#else
+        x[i] = (uint64_t) n_randlimb(state) +
+                                     ((uint64_t) n_randlimb(state) << 32);
+#endif
+
+    _mul_sym(v[0], M, MT, x, scratch, W);
+    memcpy(v0, v[0], n*W*sizeof(uint64_t));
+
+    /* each iteration removes about K - 0.76 dimensions */
+    for (iter = 0; iter <= n/(K - 1) + 10; iter++)
+    {
+        _mul_sym(vnext, M, MT, v[0], scratch, W);
+
+        _mul_KxN_NxK(vt_a_v[0], v[0], vnext, c, n, W);
+        _mul_KxN_NxK(vt_a2_v[0], vnext, vnext, c, n, W);
+
+        /* if v0^T A v0 vanishes, the iteration has finished */
+        for (i = 0; i < K*W && vt_a_v[0][i] == 0; i++)
+            ;
+
+        if (i == K*W)
+        {
+            success = 1;
+            break;
+        }
+
+        dim0 = _find_nonsingular_sub(vt_a_v[0], s[0], s[1], dim1,
+                                                                winv[0], W);
+        if (dim0 == 0)
+            break;
+
+        for (l = 0; l < W; l++)
+            mask0[l] = 0;
+        for (i = 0; i < dim0; i++)
+            mask0[BIT_WORD(s[0][i])] |= BIT_MASK(s[0][i]);
+
+        /* d = winv0 (vt_a2_v0 & mask0 + vt_a_v0) + I */
+        for (i = 0; i < K*W; i++)
+            d[i] = (vt_a2_v[0][i] & mask0[i % W]) ^ vt_a_v[0][i];
+
+        _mul_KxK_KxK(d, winv[0], d, W);
+
+        for (i = 0; i < K; i++)
+            d[i*W + BIT_WORD(i)] ^= BIT_MASK(i);
+
+        /* e = (winv1 vt_a_v0) & mask0 */
+        _mul_KxK_KxK(e, winv[1], vt_a_v[0], W);
+
+        for (i = 0; i < K*W; i++)
+            e[i] &= mask0[i % W];
+
+        /* f = winv2 (vt_a_v1 winv1 + I) ((vt_a2_v1 & mask1 + vt_a_v1) & mask0) */
+        _mul_KxK_KxK(f, vt_a_v[1], winv[1], W);
+
+        for (i = 0; i < K; i++)
+            f[i*W + BIT_WORD(i)] ^= BIT_MASK(i);
+
+        _mul_KxK_KxK(f, winv[2], f, W);
+
+        for (i = 0; i < K*W; i++)
+            f2[i] = ((vt_a2_v[1][i] & mask1[i % W]) ^ vt_a_v[1][i])
+                                                             & mask0[i % W];
+
+        _mul_KxK_KxK(f, f, f2, W);
+
+        /* the next v */
+        for (i = 0; i < n*W; i++)
+            vnext[i] &= mask0[i % W];
+
+        _mul_NxK_KxK_acc(vnext, v[0], d, c, n, W);
+        _mul_NxK_KxK_acc(vnext, v[1], e, c, n, W);
+        _mul_NxK_KxK_acc(vnext, v[2], f, c, n, W);
+
+        /* update the solution */
+        _mul_KxN_NxK(d, v[0], v0, c, n, W);
+        _mul_KxK_KxK(d, winv[0], d, W);
+        _mul_NxK_KxK_acc(x, v[0], d, c, n, W);
+
+        /* rotate all the variables */
+        tmp = v[2]; v[2] = v[1]; v[1] = v[0]; v[0] = vnext; vnext = tmp;
+        tmp = winv[2]; winv[2] = winv[1]; winv[1] = winv[0]; winv[0] = tmp;
+        tmp = vt_a_v[1]; vt_a_v[1] = vt_a_v[0]; vt_a_v[0] = tmp;
+        tmp = vt_a2_v[1]; vt_a2_v[1] = vt_a2_v[0]; vt_a2_v[0] = tmp;
+
+        memcpy(s[1], s[0], K*sizeof(slong));
+        for (l = 0; l < W; l++)
+            mask1[l] = mask0[l];
+        dim1 = dim0;
+    }
+
+    if (success)
+    {
+        /* convert the output to actual nullspace vectors and check them */
+        gf2_sparse_mat_mul_block(v[1], M, x, W);
+        gf2_sparse_mat_mul_block(v[2], M, v[0], W);
+
+        _combine_cols(x, v[0], v[1], v[2], n, r, W);
+
+        gf2_sparse_mat_mul_block(v[1], M, x, W);
+
+        for (i = 0; i < r*W && success; i++)
+            if (v[1][i] != 0)
+                success = 0;
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        flint_free(v[i]);
+        flint_free(winv[i]);
+    }
+    for (i = 0; i < 2; i++)
+    {
+        flint_free(vt_a_v[i]);
+        flint_free(vt_a2_v[i]);
+    }
+    flint_free(vnext);
+    flint_free(v0);
+    flint_free(scratch);
+    flint_free(c);
+    flint_free(d);
+    flint_free(e);
+    flint_free(f);
+    flint_free(f2);
+
+    return success;
+}
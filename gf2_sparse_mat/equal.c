@@ -0,0 +1,29 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_sparse_mat.h"
+
+int
+gf2_sparse_mat_equal(const gf2_sparse_mat_t A, const gf2_sparse_mat_t B)
+{
+    slong i;
+
+    if (A->r != B->r || A->c != B->c)
+        return 0;
+
+    for (i = 0; i <= A->r; i++)
+        if (A->row_starts[i] != B->row_starts[i])
+            return 0;
+
+    for (i = 0; i < gf2_sparse_mat_nnz(A); i++)
+        if (A->cols[i] != B->cols[i])
+            return 0;
+
+    return 1;
+}
@@ -0,0 +1,131 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_sparse_mat.h"
+
+typedef struct
+{
+    slong col;
+    slong weight;
+} _col_weight_struct;
+
+static int
+_col_weight_cmp(const void * a, const void * b)
+{
+    const _col_weight_struct * x = (const _col_weight_struct *) a;
+    const _col_weight_struct * y = (const _col_weight_struct *) b;
+
+    if (x->weight != y->weight)
+        return (x->weight > y->weight) - (x->weight < y->weight);
+
+    return (x->col > y->col) - (x->col < y->col);
+}
+
+/*
+    Light filtering before block Lanczos, as in the quadratic sieve: a
+    row with a single entry forces the corresponding unknown to zero, so
+    that column can be deleted, which may create new singleton rows.
+    Once no singletons remain, the heaviest columns beyond the number of
+    nonempty rows plus extra are deleted and the process is repeated.
+*/
+slong
+gf2_sparse_mat_filter_columns(slong * cols, const gf2_sparse_mat_t M,
+                                                                 slong extra)
+{
+    gf2_sparse_mat_t T;
+    _col_weight_struct * w;
+    slong * count, * stack;
+    char * active;
+    slong i, j, k, top, num_cols, num_rows;
+
+    gf2_sparse_mat_init(T, 0, 0);
+    gf2_sparse_mat_transpose(T, M);
+
+    count = (slong *) flint_malloc((M->r + 1)*sizeof(slong));
+    stack = (slong *) flint_malloc((M->r + 1)*sizeof(slong));
+    active = (char *) flint_malloc(M->c + 1);
+    w = (_col_weight_struct *) flint_malloc((M->c + 1)*sizeof(_col_weight_struct));
+
+    for (j = 0; j < M->c; j++)
+        active[j] = 1;
+
+    top = 0;
+    for (i = 0; i < M->r; i++)
+    {
+        count[i] = M->row_starts[i + 1] - M->row_starts[i];
+        if (count[i] == 1)
+            stack[top++] = i;
+    }
+
+    num_cols = M->c;
+
+    while (1)
+    {
+        while (top > 0)
+        {
+            i = stack[--top];
+
+            if (count[i] != 1)
+                continue;
+
+            for (k = M->row_starts[i]; !active[M->cols[k]]; k++)
+                ;
+            j = M->cols[k];
+
+            active[j] = 0;
+            num_cols--;
+
+            for (k = T->row_starts[j]; k < T->row_starts[j + 1]; k++)
+                if (--count[T->cols[k]] == 1)
+                    stack[top++] = T->cols[k];
+        }
+
+        for (i = num_rows = 0; i < M->r; i++)
+            num_rows += (count[i] != 0);
+
+        if (num_cols <= num_rows + extra)
+            break;
+
+        for (j = k = 0; j < M->c; j++)
+        {
+            if (active[j])
+            {
+                w[k].col = j;
+                w[k].weight = T->row_starts[j + 1] - T->row_starts[j];
+                k++;
+            }
+        }
+
+        qsort(w, k, sizeof(_col_weight_struct), _col_weight_cmp);
+
+        for (k = num_rows + extra; k < num_cols; k++)
+        {
+            j = w[k].col;
+            active[j] = 0;
+
+            for (i = T->row_starts[j]; i < T->row_starts[j + 1]; i++)
+                if (--count[T->cols[i]] == 1)
+                    stack[top++] = T->cols[i];
+        }
+
+        num_cols = num_rows + extra;
+    }
+
+    for (j = k = 0; j < M->c; j++)
+        if (active[j])
+            cols[k++] = j;
+
+    gf2_sparse_mat_clear(T);
+    flint_free(count);
+    flint_free(stack);
+    flint_free(active);
+    flint_free(w);
+
+    return num_cols;
+}
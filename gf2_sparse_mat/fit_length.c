@@ -0,0 +1,29 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_sparse_mat.h"
+
+void
+gf2_sparse_mat_fit_length(gf2_sparse_mat_t M, slong rows, slong nnz)
+{
+    if (rows > M->row_alloc)
+    {
+        rows = FLINT_MAX(rows, 2*M->row_alloc);
+        M->row_starts = (slong *) flint_realloc(M->row_starts,
+                                                   (rows + 1)*sizeof(slong));
+        M->row_alloc = rows;
+    }
+
+    if (nnz > M->alloc)
+    {
+        nnz = FLINT_MAX(nnz, 2*M->alloc);
+        M->cols = (slong *) flint_realloc(M->cols, nnz*sizeof(slong));
+        M->alloc = nnz;
+    }
+}
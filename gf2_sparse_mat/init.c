@@ -0,0 +1,28 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_sparse_mat.h"
+
+void
+gf2_sparse_mat_init(gf2_sparse_mat_t M, slong rows, slong cols)
+{
+    M->r = rows;
+    M->c = cols;
+    M->row_alloc = rows;
+    M->row_starts = (slong *) flint_calloc(rows + 1, sizeof(slong));
+    M->alloc = 0;
+    M->cols = NULL;
+}
+
+void
+gf2_sparse_mat_clear(gf2_sparse_mat_t M)
+{
+    flint_free(M->row_starts);
+    flint_free(M->cols);
+}
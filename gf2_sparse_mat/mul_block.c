@@ -0,0 +1,143 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_sparse_mat.h"
+
+/* below this many nonzero entries the threads are not woken */
+#define MUL_BLOCK_THREADED_CUTOFF 20000
+
+typedef struct
+{
+    uint64_t * y;
+    const gf2_sparse_mat_struct * M;
+    const uint64_t * x;
+    slong words;
+    slong start;
+    slong stop;
+} _mul_block_arg_t;
+
+static void
+_mul_block_worker(void * varg)
+{
+    _mul_block_arg_t * arg = (_mul_block_arg_t *) varg;
+    const gf2_sparse_mat_struct * M = arg->M;
+    const uint64_t * x = arg->x;
+    uint64_t * y = arg->y;
+    slong i, k, l, w = arg->words;
+
+    /* the common block sizes get loops the compiler can unroll */
+    if (w == 1)
+    {
+        for (i = arg->start; i < arg->stop; i++)
+        {
+            uint64_t t = 0;
+
+            for (k = M->row_starts[i]; k < M->row_starts[i + 1]; k++)
+                t ^= x[M->cols[k]];
+
+            y[i] = t;
+        }
+    }
+    else if (w == 4)
+    {
+        for (i = arg->start; i < arg->stop; i++)
+        {
+            uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0;
+
+            for (k = M->row_starts[i]; k < M->row_starts[i + 1]; k++)
+            {
+                const uint64_t * xk = x + 4*M->cols[k];
+                t0 ^= xk[0];
+                t1 ^= xk[1];
+                t2 ^= xk[2];
+                t3 ^= xk[3];
+            }
+
+            y[4*i + 0] = t0;
+            y[4*i + 1] = t1;
+            y[4*i + 2] = t2;
+            y[4*i + 3] = t3;
+        }
+    }
+    else
+    {
+        for (i = arg->start; i < arg->stop; i++)
+        {
+            uint64_t * yi = y + w*i;
+
+            for (l = 0; l < w; l++)
+                yi[l] = 0;
+
+            for (k = M->row_starts[i]; k < M->row_starts[i + 1]; k++)
+                for (l = 0; l < w; l++)
+                    yi[l] ^= x[w*M->cols[k] + l];
+        }
+    }
+}
+
+/* first row whose entries start at or after position k */
+static slong
+_row_of_entry(const gf2_sparse_mat_t M, slong k)
+{
+    slong lo = 0, hi = M->r;
+
+    while (lo < hi)
+    {
+        slong mid = lo + (hi - lo)/2;
+
+        if (M->row_starts[mid] < k)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+void
+gf2_sparse_mat_mul_block(uint64_t * y, const gf2_sparse_mat_t M,
+                                              const uint64_t * x, slong words)
+{
+    _mul_block_arg_t * args;
+    thread_pool_handle * threads;
+    slong i, nw, nnz;
+
+    nnz = gf2_sparse_mat_nnz(M);
+
+    if (nnz*words < MUL_BLOCK_THREADED_CUTOFF)
+        nw = 0, threads = NULL;
+    else
+        nw = flint_request_threads(&threads, flint_get_num_threads());
+
+    args = (_mul_block_arg_t *) flint_malloc((nw + 1)*sizeof(_mul_block_arg_t));
+
+    /* share out the rows so that each thread gets as many entries */
+    for (i = 0; i <= nw; i++)
+    {
+        args[i].y = y;
+        args[i].M = M;
+        args[i].x = x;
+        args[i].words = words;
+        args[i].start = (i == 0) ? 0 : args[i - 1].stop;
+        args[i].stop = (i == nw) ? M->r :
+                                   _row_of_entry(M, (i + 1)*(nnz/(nw + 1)));
+    }
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wake(global_thread_pool, threads[i], 0,
+                                                 _mul_block_worker, &args[i]);
+
+    _mul_block_worker(&args[nw]);
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wait(global_thread_pool, threads[i]);
+
+    flint_give_back_threads(threads, nw);
+    flint_free(args);
+}
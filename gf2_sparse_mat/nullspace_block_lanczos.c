@@ -0,0 +1,181 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "gf2_sparse_mat.h"
+
+/* below this many columns after filtering a dense nullspace is cheaper */
+#define LANCZOS_CUTOFF 1000
+
+#define LANCZOS_ATTEMPTS 10
+
+/*
+    Replaces the K vectors in X by a basis of their span, stored in the
+    low bits, and returns its dimension.
+*/
+static slong
+_compact_basis(uint64_t * X, slong n, slong W)
+{
+    slong i, j, k, rank, K = 64*W, words = (n + 63)/64;
+    uint64_t ** rows, * t;
+
+    rows = (uint64_t **) flint_malloc(K*sizeof(uint64_t *));
+    for (k = 0; k < K; k++)
+        rows[k] = (uint64_t *) flint_calloc(words + 1, sizeof(uint64_t));
+
+    for (j = 0; j < n; j++)
+        for (k = 0; k < K; k++)
+            if ((X[j*W + k/64] >> (k % 64)) & 1)
+                rows[k][j/64] |= ((uint64_t) 1) << (j % 64);
+
+    for (j = rank = 0; j < n && rank < K; j++)
+    {
+        uint64_t m = ((uint64_t) 1) << (j % 64);
+
+        for (k = rank; k < K && !(rows[k][j/64] & m); k++)
+            ;
+
+        if (k == K)
+            continue;
+
+        t = rows[k]; rows[k] = rows[rank]; rows[rank] = t;
+
+        for (k = rank + 1; k < K; k++)
+            if (rows[k][j/64] & m)
+                for (i = j/64; i < words; i++)
+                    rows[k][i] ^= rows[rank][i];
+
+        rank++;
+    }
+
+    memset(X, 0, n*W*sizeof(uint64_t));
+
+    for (k = 0; k < rank; k++)
+        for (j = 0; j < n; j++)
+            if ((rows[k][j/64] >> (j % 64)) & 1)
+                X[j*W + k/64] |= ((uint64_t) 1) << (k % 64);
+
+    for (k = 0; k < K; k++)
+        flint_free(rows[k]);
+    flint_free(rows);
+
+    return rank;
+}
+
+slong
+gf2_sparse_mat_nullspace_block_lanczos(uint64_t * X, const gf2_sparse_mat_t M,
+                                             slong words, flint_rand_t state)
+{
+    gf2_sparse_mat_t T, S, ST;
+    slong * keep, * row_map, * cols;
+    uint64_t * x;
+    slong i, j, k, m, r, K;
+    int success = 0;
+
+    if (words != 1 && words != 4)
+    {
+        flint_printf("Exception (gf2_sparse_mat_nullspace_block_lanczos). "
+                                         "Block must be 1 or 4 words.\n");
+        flint_abort();
+    }
+
+    K = 64*words;
+
+    memset(X, 0, M->c*words*sizeof(uint64_t));
+
+    keep = (slong *) flint_malloc((M->c + 1)*sizeof(slong));
+    m = gf2_sparse_mat_filter_columns(keep, M, K);
+
+    if (m == 0)
+    {
+        flint_free(keep);
+        return 0;
+    }
+
+    /* the kept columns, without the rows they leave empty */
+    gf2_sparse_mat_init(T, 0, 0);
+    gf2_sparse_mat_transpose(T, M);
+
+    row_map = (slong *) flint_malloc((M->r + 1)*sizeof(slong));
+    for (i = 0; i < M->r; i++)
+        row_map[i] = -1;
+
+    for (j = 0; j < m; j++)
+        for (k = T->row_starts[keep[j]]; k < T->row_starts[keep[j] + 1]; k++)
+            row_map[T->cols[k]] = 0;
+
+    for (i = r = 0; i < M->r; i++)
+        if (row_map[i] == 0)
+            row_map[i] = r++;
+
+    gf2_sparse_mat_init(ST, 0, r);
+    gf2_sparse_mat_init(S, 0, 0);
+    cols = (slong *) flint_malloc((r + 1)*sizeof(slong));
+
+    for (j = 0; j < m; j++)
+    {
+        slong len = 0;
+
+        for (k = T->row_starts[keep[j]]; k < T->row_starts[keep[j] + 1]; k++)
+            cols[len++] = row_map[T->cols[k]];
+
+        gf2_sparse_mat_append_row(ST, cols, len);
+    }
+
+    gf2_sparse_mat_transpose(S, ST);
+
+    x = (uint64_t *) flint_calloc(m*words, sizeof(uint64_t));
+
+    if (m < LANCZOS_CUTOFF)
+    {
+        nmod_mat_t A, B;
+        slong nullity;
+
+        nmod_mat_init(A, r, m, 2);
+        nmod_mat_init(B, m, m, 2);
+        gf2_sparse_mat_get_nmod_mat(A, S);
+
+        nullity = FLINT_MIN(nmod_mat_nullspace(B, A), K);
+
+        for (j = 0; j < m; j++)
+            for (k = 0; k < nullity; k++)
+                if (nmod_mat_entry(B, j, k))
+                    x[j*words + k/64] |= ((uint64_t) 1) << (k % 64);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        success = 1;
+    }
+    else
+    {
+        for (i = 0; i < LANCZOS_ATTEMPTS && !success; i++)
+            success = _gf2_sparse_mat_block_lanczos(x, S, ST, words, state);
+    }
+
+    k = 0;
+
+    if (success)
+    {
+        for (j = 0; j < m; j++)
+            for (i = 0; i < words; i++)
+                X[keep[j]*words + i] = x[j*words + i];
+
+        k = _compact_basis(X, M->c, words);
+    }
+
+    gf2_sparse_mat_clear(T);
+    gf2_sparse_mat_clear(S);
+    gf2_sparse_mat_clear(ST);
+    flint_free(keep);
+    flint_free(row_map);
+    flint_free(cols);
+    flint_free(x);
+
+    return k;
+}
@@ -0,0 +1,34 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_sparse_mat.h"
+
+void
+gf2_sparse_mat_set_nmod_mat(gf2_sparse_mat_t M, const nmod_mat_t A)
+{
+    slong i, j, len;
+    slong * cols;
+
+    M->r = 0;
+    M->c = A->c;
+    M->row_starts[0] = 0;
+
+    cols = (slong *) flint_malloc((A->c + 1)*sizeof(slong));
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = len = 0; j < A->c; j++)
+            if (nmod_mat_entry(A, i, j) & 1)
+                cols[len++] = j;
+
+        gf2_sparse_mat_append_row(M, cols, len);
+    }
+
+    flint_free(cols);
+}
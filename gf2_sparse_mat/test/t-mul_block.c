@@ -0,0 +1,103 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_block....");
+    fflush(stdout);
+
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+        gf2_sparse_mat_t M;
+        nmod_mat_t A, X, Y;
+        uint64_t * x, * y;
+        slong j, k, r, c, w, words;
+
+        /* occasionally large enough to be split between threads */
+        if (n_randint(state, 10) == 0)
+        {
+            r = n_randint(state, 2000);
+            c = n_randint(state, 2000);
+            w = n_randint(state, 30);
+        }
+        else
+        {
+            r = n_randint(state, 50);
+            c = n_randint(state, 50);
+            w = n_randint(state, 10);
+        }
+
+        words = n_randint(state, 5) + 1;
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        gf2_sparse_mat_init(M, 0, c);
+        nmod_mat_init(A, r, c, 2);
+        nmod_mat_init(X, c, 64*words, 2);
+        nmod_mat_init(Y, r, 64*words, 2);
+        x = (uint64_t *) flint_malloc((c*words + 1)*sizeof(uint64_t));
+        y = (uint64_t *) flint_malloc((r*words + 1)*sizeof(uint64_t));
+
+        gf2_sparse_mat_randtest(M, state, r, c, w);
+        gf2_sparse_mat_get_nmod_mat(A, M);
+
+        for (j = 0; j < c*words; j++)
+        {
+            x[j] = n_randtest(state);
+#if FLINT_BITS == 32
+            x[j] += ((uint64_t) n_randtest(state)) << 32;
+#endif
+        }
+
+        for (j = 0; j < c; j++)
+            for (k = 0; k < 64*words; k++)
+                nmod_mat_entry(X, j, k) = (x[j*words + k/64] >> (k % 64)) & 1;
+
+        gf2_sparse_mat_mul_block(y, M, x, words);
+        nmod_mat_mul(Y, A, X);
+
+        for (j = 0; j < r; j++)
+        {
+            for (k = 0; k < 64*words; k++)
+            {
+                if (((y[j*words + k/64] >> (k % 64)) & 1) !=
+                                                     nmod_mat_entry(Y, j, k))
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("r = %wd, c = %wd, j = %wd, k = %wd\n",
+                                                                 r, c, j, k);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        gf2_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        flint_free(x);
+        flint_free(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
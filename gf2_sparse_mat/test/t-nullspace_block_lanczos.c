@@ -0,0 +1,110 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace_block_lanczos....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        gf2_sparse_mat_t M;
+        nmod_mat_t A, X, Y;
+        uint64_t * x;
+        slong j, k, r, c, w, words, nullity;
+
+        /* large matrices take the block Lanczos path */
+        if (n_randint(state, 8) == 0)
+        {
+            r = 1000 + n_randint(state, 1000);
+            c = r + n_randint(state, 300);
+            w = 5 + n_randint(state, 20);
+        }
+        else
+        {
+            r = n_randint(state, 100);
+            c = n_randint(state, 100);
+            w = n_randint(state, 10);
+        }
+
+        words = n_randint(state, 2) ? 1 : 4;
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        gf2_sparse_mat_init(M, 0, c);
+        x = (uint64_t *) flint_malloc((c*words + 1)*sizeof(uint64_t));
+
+        gf2_sparse_mat_randtest(M, state, r, c, w);
+
+        nullity = gf2_sparse_mat_nullspace_block_lanczos(x, M, words, state);
+
+        if (nullity < 0 || nullity > 64*words ||
+            (c > r && nullity == 0))
+        {
+            flint_printf("FAIL: nullity\n");
+            flint_printf("r = %wd, c = %wd, nullity = %wd\n", r, c, nullity);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_init(A, r, c, 2);
+        nmod_mat_init(X, c, nullity, 2);
+        nmod_mat_init(Y, r, nullity, 2);
+
+        gf2_sparse_mat_get_nmod_mat(A, M);
+
+        for (j = 0; j < c; j++)
+        {
+            for (k = 0; k < 64*words; k++)
+            {
+                int bit = (x[j*words + k/64] >> (k % 64)) & 1;
+
+                if (k < nullity)
+                    nmod_mat_entry(X, j, k) = bit;
+                else if (bit)
+                {
+                    flint_printf("FAIL: high bits not cleared\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        nmod_mat_mul(Y, A, X);
+
+        if (!nmod_mat_is_zero(Y) || nmod_mat_rank(X) != nullity)
+        {
+            flint_printf("FAIL: not a basis of nullspace vectors\n");
+            flint_printf("r = %wd, c = %wd, nullity = %wd\n", r, c, nullity);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        flint_free(x);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_sparse_mat_t M, N, P;
+        nmod_mat_t A, B, C;
+        slong r, c, w;
+
+        r = n_randint(state, 30);
+        c = n_randint(state, 30);
+        w = n_randint(state, 10);
+
+        gf2_sparse_mat_init(M, 0, c);
+        gf2_sparse_mat_init(N, 0, 0);
+        gf2_sparse_mat_init(P, 0, 0);
+        nmod_mat_init(A, r, c, 2);
+        nmod_mat_init(B, c, r, 2);
+        nmod_mat_init(C, c, r, 2);
+
+        gf2_sparse_mat_randtest(M, state, r, c, w);
+        gf2_sparse_mat_transpose(N, M);
+
+        gf2_sparse_mat_get_nmod_mat(A, M);
+        gf2_sparse_mat_get_nmod_mat(B, N);
+        nmod_mat_transpose(C, A);
+
+        if (!nmod_mat_equal(B, C))
+        {
+            flint_printf("FAIL: against dense\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_sparse_mat_transpose(P, N);
+        gf2_sparse_mat_set_nmod_mat(N, A);
+
+        if (!gf2_sparse_mat_equal(M, P) || !gf2_sparse_mat_equal(M, N))
+        {
+            flint_printf("FAIL: involution\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        gf2_sparse_mat_clear(M);
+        gf2_sparse_mat_clear(N);
+        gf2_sparse_mat_clear(P);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
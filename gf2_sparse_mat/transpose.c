@@ -0,0 +1,40 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gf2_sparse_mat.h"
+
+void
+gf2_sparse_mat_transpose(gf2_sparse_mat_t B, const gf2_sparse_mat_t A)
+{
+    gf2_sparse_mat_t T;
+    slong i, j, k, nnz;
+
+    nnz = gf2_sparse_mat_nnz(A);
+
+    gf2_sparse_mat_init(T, A->c, A->r);
+    gf2_sparse_mat_fit_length(T, A->c, nnz);
+
+    /* count the entries of each column, then place them row by row */
+    for (k = 0; k < nnz; k++)
+        T->row_starts[A->cols[k] + 1]++;
+
+    for (j = 0; j < A->c; j++)
+        T->row_starts[j + 1] += T->row_starts[j];
+
+    for (i = 0; i < A->r; i++)
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+            T->cols[T->row_starts[A->cols[k]]++] = i;
+
+    for (j = A->c; j > 0; j--)
+        T->row_starts[j] = T->row_starts[j - 1];
+    T->row_starts[0] = 0;
+
+    gf2_sparse_mat_swap(B, T);
+    gf2_sparse_mat_clear(T);
+}
@@ -21,7 +21,6 @@
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
-#include "fmpz_poly.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -76,6 +75,30 @@
 FLINT_DLL void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
                         mp_srcptr i2, mp_size_t n2);
 
+FLINT_DLL int _flint_mpn_mul_fft_params(flint_bitcnt_t * depth,
+                         flint_bitcnt_t * w, mp_size_t n1, mp_size_t n2);
+
+/* Multiplication by a fixed integer whose transform is computed once */
+typedef struct
+{
+   mp_limb_t ** jj;   /* transformed coefficients of the fixed operand */
+   mp_size_t n1;      /* maximum size of the other operand */
+   mp_size_t n2;      /* size of the fixed operand */
+   mp_size_t j2;      /* number of FFT coefficients of the fixed operand */
+   flint_bitcnt_t depth;
+   flint_bitcnt_t w;
+} flint_mpn_mul_precache_struct;
+
+typedef flint_mpn_mul_precache_struct flint_mpn_mul_precache_t[1];
+
+FLINT_DLL void flint_mpn_mul_precache_init(flint_mpn_mul_precache_t pre,
+                               mp_srcptr i2, mp_size_t n2, mp_size_t n1);
+
+FLINT_DLL void flint_mpn_mul_precache_clear(flint_mpn_mul_precache_t pre);
+
+FLINT_DLL void flint_mpn_mul_precache(mp_ptr r, mp_srcptr i1, mp_size_t n1,
+                                         const flint_mpn_mul_precache_t pre);
+
 MPN_EXTRAS_INLINE mp_limb_t
 flint_mpn_mul(mp_ptr z, mp_srcptr x, mp_size_t xn, mp_srcptr y, mp_size_t yn)
 {
@@ -216,6 +239,12 @@ FLINT_DLL void flint_mpn_mulmod_preinvn(mp_ptr r,
         mp_srcptr a, mp_srcptr b, mp_size_t n, 
         mp_srcptr d, mp_srcptr dinv, ulong norm);
 
+FLINT_DLL void flint_mpn_redc(mp_ptr r, mp_ptr t, mp_srcptr m,
+                                          mp_size_t n, mp_limb_t minv);
+
+FLINT_DLL void flint_mpn_mulmod_redc(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                     mp_srcptr m, mp_size_t n, mp_limb_t minv, mp_ptr t);
+
 FLINT_DLL int flint_mpn_mulmod_2expp1_basecase(mp_ptr xp, mp_srcptr yp, mp_srcptr zp, 
     int c, flint_bitcnt_t b, mp_ptr tp);
 
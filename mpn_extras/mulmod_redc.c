@@ -0,0 +1,23 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+
+void flint_mpn_mulmod_redc(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                      mp_srcptr m, mp_size_t n, mp_limb_t minv, mp_ptr t)
+{
+    if (a == b)
+        mpn_sqr(t, a, n);
+    else
+        mpn_mul_n(t, a, b, n);
+
+    flint_mpn_redc(r, t, m, n, minv);
+}
@@ -0,0 +1,39 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+
+/*
+    Montgomery reduction: sets {r, n} to {t, 2n} / 2^(n*FLINT_BITS) mod {m, n},
+    fully reduced. Requires m odd, minv = -m^(-1) mod 2^FLINT_BITS and
+    {t, 2n} < m*2^(n*FLINT_BITS). The contents of t are destroyed.
+
+    Each step clears one low limb of t; its carry out belongs n limbs
+    higher, so it is parked in the limb just cleared and all the carries
+    are added in one go at the end.
+*/
+void flint_mpn_redc(mp_ptr r, mp_ptr t, mp_srcptr m, mp_size_t n,
+                                                             mp_limb_t minv)
+{
+    mp_size_t i;
+    mp_limb_t q, cy;
+
+    for (i = 0; i < n; i++)
+    {
+        q = t[i] * minv;
+        t[i] = mpn_addmul_1(t + i, m, n, q);
+    }
+
+    cy = mpn_add_n(r, t + n, t, n);
+
+    if (cy != 0 || mpn_cmp(r, m, n) >= 0)
+        mpn_sub_n(r, r, m, n);
+}
@@ -0,0 +1,106 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    int i, j, result;
+    mpz_t a, b, m, r1, r2;
+    mp_ptr ap, bp, mp, rp, t;
+    mp_size_t n;
+    mp_limb_t minv;
+    
+    FLINT_TEST_INIT(state);
+    _flint_rand_init_gmp(state);
+
+    flint_printf("mulmod_redc....");
+    fflush(stdout);
+
+    mpz_init(a);
+    mpz_init(b);
+    mpz_init(m);
+    mpz_init(r1);
+    mpz_init(r2);
+
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        n = n_randint(state, 20) + 1;
+
+        ap = flint_malloc(6*n*sizeof(mp_limb_t));
+        bp = ap + n;
+        mp = bp + n;
+        rp = mp + n;
+        t = rp + n;
+
+        /* odd modulus of exactly n limbs */
+        flint_mpn_rrandom(mp, state->gmp_state, n);
+        mp[0] |= 1;
+        if (mp[n - 1] == 0)
+            mp[n - 1] = 1;
+
+        minv = mp[0];
+        for (j = 0; j < 5; j++)
+            minv *= UWORD(2) - mp[0] * minv;
+        minv = -minv;
+
+        flint_mpn_urandomb(ap, state->gmp_state, n*FLINT_BITS);
+        flint_mpn_urandomb(bp, state->gmp_state, n*FLINT_BITS);
+        while (mpn_cmp(ap, mp, n) >= 0)
+            mpn_sub_n(ap, ap, mp, n);
+        while (mpn_cmp(bp, mp, n) >= 0)
+            mpn_sub_n(bp, bp, mp, n);
+        if (n_randint(state, 4) == 0)
+            flint_mpn_copyi(bp, ap, n);
+
+        flint_mpn_mulmod_redc(rp, ap, bp, mp, n, minv, t);
+
+        /* check r*2^(n*FLINT_BITS) = a*b mod m, and r < m */
+        mpz_import(a, n, -1, sizeof(mp_limb_t), 0, 0, ap);
+        mpz_import(b, n, -1, sizeof(mp_limb_t), 0, 0, bp);
+        mpz_import(m, n, -1, sizeof(mp_limb_t), 0, 0, mp);
+        mpz_import(r2, n, -1, sizeof(mp_limb_t), 0, 0, rp);
+
+        mpz_mul(r1, a, b);
+        mpz_mod(r1, r1, m);
+
+        result = (mpz_cmp(r2, m) < 0);
+
+        mpz_mul_2exp(r2, r2, n*FLINT_BITS);
+        mpz_mod(r2, r2, m);
+
+        result = result && (mpz_cmp(r1, r2) == 0);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wd\n", n);
+            gmp_printf("a = %Zd\nb = %Zd\nm = %Zd\n", a, b, m);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        flint_free(ap);
+    }
+
+    mpz_clear(a);
+    mpz_clear(b);
+    mpz_clear(m);
+    mpz_clear(r1);
+    mpz_clear(r2);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -244,16 +244,20 @@ int _nmod_zip_vand_solve(
         }
         /* roots[i] should be a root of master */
         FLINT_ASSERT(nmod_add(nmod_mul(r, T, ctx), master[0], ctx) == 0);
-        NMOD_RED3(V, V2, V1, V0, ctx);
+        NMOD_RED3(coeffs[i], V2, V1, V0, ctx);
         S = nmod_mul(S, r, ctx); /* shift is one */
         if (S == 0)
             return -1;
-        coeffs[i] = nmod_mul(V, nmod_inv(S, ctx), ctx);
+        scratch[i] = S;
     }
 
+    /* coeffs[i] = V/S, with all of the S inverted at once */
+    _nmod_vec_inv(scratch, scratch, mlength, ctx);
+    for (i = 0; i < mlength; i++)
+        coeffs[i] = nmod_mul(coeffs[i], scratch[i], ctx);
+
     /* check that the remaining points match */
-    for (j = 0; j < mlength; j++)
-        scratch[j] = nmod_pow_ui(monomials[j], mlength, ctx);
+    _nmod_vec_pow_ui(scratch, monomials, mlength, mlength, ctx);
 
     for (i = mlength; i < elength; i++)
     {
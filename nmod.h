@@ -231,6 +231,86 @@ void nmod_init(nmod_t * mod, mp_limb_t n)
    count_leading_zeros(mod->norm, n);
 }
 
+/* Montgomery arithmetic *****************************************************/
+
+typedef struct
+{
+   mp_limb_t n;
+   mp_limb_t ninv;     /* n^(-1) mod 2^FLINT_BITS */
+   mp_limb_t one;      /* 2^FLINT_BITS mod n */
+   mp_limb_t r2;       /* 2^(2*FLINT_BITS) mod n */
+} nmod_mont_t;
+
+NMOD_INLINE
+void nmod_mont_init(nmod_mont_t * mont, mp_limb_t n)
+{
+   mp_limb_t x;
+   int i;
+
+   /* n*n = 1 mod 8, and each Newton step doubles the number of bits */
+   x = n;
+   for (i = 0; i < 5; i++)
+      x *= UWORD(2) - n * x;
+
+   mont->n = n;
+   mont->ninv = x;
+   mont->one = (-n) % n;
+   mont->r2 = n_mulmod2(mont->one, mont->one, n);
+}
+
+/* requires hi < n; returns (hi*2^FLINT_BITS + lo)/2^FLINT_BITS mod n */
+NMOD_INLINE
+mp_limb_t _nmod_mont_redc(mp_limb_t hi, mp_limb_t lo, nmod_mont_t mont)
+{
+   mp_limb_t m, t1, t0;
+
+   m = lo * mont.ninv;
+   umul_ppmm(t1, t0, m, mont.n);
+
+   return (hi < t1) ? hi - t1 + mont.n : hi - t1;
+}
+
+NMOD_INLINE
+mp_limb_t nmod_mont_mul(mp_limb_t a, mp_limb_t b, nmod_mont_t mont)
+{
+   mp_limb_t hi, lo;
+   umul_ppmm(hi, lo, a, b);
+   return _nmod_mont_redc(hi, lo, mont);
+}
+
+NMOD_INLINE
+mp_limb_t nmod_mont_add(mp_limb_t a, mp_limb_t b, nmod_mont_t mont)
+{
+   const mp_limb_t neg = mont.n - a;
+   if (neg > b)
+      return a + b;
+   else
+      return b - neg;
+}
+
+NMOD_INLINE
+mp_limb_t nmod_mont_sub(mp_limb_t a, mp_limb_t b, nmod_mont_t mont)
+{
+   const mp_limb_t diff = a - b;
+
+   if (a < b)
+      return mont.n + diff;
+   else
+      return diff;
+}
+
+NMOD_INLINE
+mp_limb_t nmod_mont_from_nmod(mp_limb_t a, nmod_mont_t mont)
+{
+   return nmod_mont_mul(a, mont.r2, mont);
+}
+
+NMOD_INLINE
+mp_limb_t nmod_mont_to_nmod(mp_limb_t a, nmod_mont_t mont)
+{
+   return _nmod_mont_redc(0, a, mont);
+}
+
 /* discrete logs a la Pohlig - Hellman ***************************************/
 
 typedef struct {
@@ -216,6 +216,8 @@ FLINT_DLL void nmod_mat_mul_classical_threaded(nmod_mat_t C,
 		                       const nmod_mat_t A, const nmod_mat_t B);
 FLINT_DLL void nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
 
+FLINT_DLL void nmod_mat_mul_strassen_threaded(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
+
 FLINT_DLL void _nmod_mat_mul_classical_op(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op);
 
@@ -362,11 +364,16 @@ FLINT_DLL void nmod_mat_solve_triu(nmod_mat_t X, const nmod_mat_t U, const nmod_
 FLINT_DLL void nmod_mat_solve_triu_recursive(nmod_mat_t X, const nmod_mat_t U, const nmod_mat_t B, int unit);
 FLINT_DLL void nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U, const nmod_mat_t B, int unit);
 
+FLINT_DLL void _nmod_mat_solve_tri_threaded(nmod_mat_t X, const nmod_mat_t T, const nmod_mat_t B, int unit, int upper);
+
 /* LU decomposition */
 
 FLINT_DLL slong nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_classical(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_classical_delayed(slong * P, nmod_mat_t A, int rank_check);
+FLINT_DLL slong nmod_mat_lu_classical_threaded(slong * P, nmod_mat_t A, int rank_check);
+FLINT_DLL slong _nmod_mat_lu_classical_threaded_pool(slong * P, nmod_mat_t A,
+              int rank_check, thread_pool_handle * threads, slong num_threads);
 FLINT_DLL slong nmod_mat_lu_recursive(slong * P, nmod_mat_t A, int rank_check);
 
 /* Nonsingular solving */
@@ -407,6 +414,11 @@ FLINT_DLL slong nmod_mat_howell_form(nmod_mat_t A);
 
 FLINT_DLL void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 
+/* Block Krylov basis, see nmod_mat/block_krylov.c */
+
+FLINT_DLL int _nmod_mat_block_krylov(nmod_mat_t C, const nmod_mat_t A,
+                                                 slong s, flint_rand_t state);
+
 /* Characteristic polynomial and minimal polynomial */
 
 /* The following prototype actually lives in nmod_poly.h
@@ -425,6 +437,19 @@ FLINT_DLL void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
 #define NMOD_MAT_SOLVE_TRI_COLS_CUTOFF 64
 
+/* Number of rows from which threads are used in the base case of LU */
+#define NMOD_MAT_LU_THREADED_ROWS_CUTOFF 256
+
+/* Dimension from which the charpoly and minpoly use block Krylov bases */
+#define NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF 80
+
+/* Block size for the block Krylov bases, at most n */
+#define NMOD_MAT_KRYLOV_BLOCK_SIZE(n) \
+    FLINT_MIN((n), FLINT_MIN(64, FLINT_MAX(8, (slong) n_sqrt(n))))
+
+/* Leading blocks of a block Krylov basis whose rank is checked early */
+#define NMOD_MAT_KRYLOV_EARLY_BLOCKS 8
+
 /*
    Suggested initial modulus size for multimodular algorithms. This should
    be chosen so that we get the most number of bits per cycle
@@ -0,0 +1,109 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat.h"
+
+/*
+    Let n = d*s + r with 0 <= r < s. For s random vectors u_0, ..., u_{s-1}
+    we form the block Krylov matrix K = [U, AU, ..., A^(d-1) U, A^d U_r],
+    where U_r consists of the first r columns of U, so that u_i generates
+    a chain of length d_i = d + (i < r) and column l*s + i of K is
+    A^l u_i. If K is invertible, C is set to K^(-1) W where column i of W
+    is A^(d_i) u_i, the first iterate of u_i not in K, and we return 1.
+    Otherwise we return 0.
+
+    All the work is in products of s x n by n x n matrices and in the
+    solve, so that this inherits the speed of nmod_mat_mul.
+
+    If the minimal polynomial of A has degree k < d, the first k + 1 blocks
+    of K already have rank at most k s. The rank of the first 2, 4 and 8
+    blocks is checked as they are formed, at a cost of O(n^2), so that
+    such inputs are rejected before most of the work is done.
+*/
+int
+_nmod_mat_block_krylov(nmod_mat_t C, const nmod_mat_t A, slong s,
+                                                         flint_rand_t state)
+{
+    slong n = A->r, d = n / s, r = n % s;
+    slong i, j, rank;
+    nmod_mat_t AT, KT, WT, Y, Z, X0, X1;
+    int result;
+
+    nmod_mat_init(AT, n, n, A->mod.n);
+    nmod_mat_init(KT, n, n, A->mod.n);
+    nmod_mat_init(WT, s, n, A->mod.n);
+    nmod_mat_init(Y, s, n, A->mod.n);
+
+    nmod_mat_transpose(AT, A);
+
+    /* the rows of KT are the vectors of K */
+    for (i = 0; i < s; i++)
+        for (j = 0; j < n; j++)
+            nmod_mat_entry(KT, i, j) = n_randint(state, A->mod.n);
+
+    for (i = 1; i < d; i++)
+    {
+        nmod_mat_window_init(X0, KT, (i - 1)*s, 0, i*s, n);
+        nmod_mat_window_init(X1, KT, i*s, 0, (i + 1)*s, n);
+        nmod_mat_mul(X1, X0, AT);
+        nmod_mat_window_clear(X0);
+        nmod_mat_window_clear(X1);
+
+        if (i + 1 <= NMOD_MAT_KRYLOV_EARLY_BLOCKS && (i & (i + 1)) == 0)
+        {
+            nmod_mat_window_init(X0, KT, 0, 0, (i + 1)*s, n);
+            rank = nmod_mat_rank(X0);
+            nmod_mat_window_clear(X0);
+
+            if (rank < (i + 1)*s)
+            {
+                nmod_mat_clear(AT);
+                nmod_mat_clear(KT);
+                nmod_mat_clear(WT);
+                nmod_mat_clear(Y);
+                return 0;
+            }
+        }
+    }
+
+    /* Y = (A^d U)^T */
+    nmod_mat_window_init(X0, KT, (d - 1)*s, 0, d*s, n);
+    nmod_mat_mul(Y, X0, AT);
+    nmod_mat_window_clear(X0);
+
+    for (i = 0; i < r; i++)
+        _nmod_vec_set(KT->rows[d*s + i], Y->rows[i], n);
+
+    for (i = r; i < s; i++)
+        _nmod_vec_set(WT->rows[i], Y->rows[i], n);
+
+    if (r > 0)
+    {
+        nmod_mat_window_init(X0, Y, 0, 0, r, n);
+        nmod_mat_window_init(X1, WT, 0, 0, r, n);
+        nmod_mat_mul(X1, X0, AT);
+        nmod_mat_window_clear(X0);
+        nmod_mat_window_clear(X1);
+    }
+
+    nmod_mat_clear(AT);
+    nmod_mat_clear(Y);
+
+    nmod_mat_transpose(KT, KT);
+    nmod_mat_init(Z, n, s, A->mod.n);
+    nmod_mat_transpose(Z, WT);
+
+    result = nmod_mat_solve(C, KT, Z);
+
+    nmod_mat_clear(KT);
+    nmod_mat_clear(WT);
+    nmod_mat_clear(Z);
+
+    return result;
+}
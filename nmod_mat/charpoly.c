@@ -19,7 +19,22 @@
 void nmod_mat_charpoly(nmod_poly_t cp, const nmod_mat_t mat)
 {
     if (mat->r <= 8 || !n_is_prime(mat->mod.n))
+    {
         nmod_mat_charpoly_berkowitz(cp, mat);
+    }
+    else if (mat->r >= NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF &&
+             mat->r == mat->c && mat->mod.n > (ulong) mat->r)
+    {
+        flint_rand_t state;
+        int success;
+
+        flint_randinit(state);
+        success = nmod_mat_charpoly_krylov(cp, mat, state);
+        flint_randclear(state);
+
+        if (!success)
+            nmod_mat_charpoly_danilevsky(cp, mat);
+    }
     else
         nmod_mat_charpoly_danilevsky(cp, mat);
 }
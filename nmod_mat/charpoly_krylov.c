@@ -0,0 +1,150 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+#define CHARPOLY_BATCH 256
+
+/*
+    Given C from _nmod_mat_block_krylov with block size s, the matrix of A
+    in the basis K is a block companion matrix, and the characteristic
+    polynomial of A is the determinant of the s x s polynomial matrix
+    P(x) = diag(x^(d_j)) - Q(x), where Q_ij(x) is the sum of
+    C[l*s + i, j] x^l for l < d_i. We evaluate P at the points 0, ..., n,
+    which needs a prime modulus p > n, by multiplying the chains of C
+    with a Vandermonde matrix, and interpolate the determinants.
+*/
+void
+_nmod_mat_charpoly_krylov(nmod_poly_t cp, const nmod_mat_t C, slong s)
+{
+    slong n = C->r, d = n / s, r = n % s;
+    slong dmax = d + (r > 0);
+    slong a, a0, b, i, j, l;
+    nmod_t mod = C->mod;
+    nmod_mat_t * Cc, * Q;
+    nmod_mat_t V, Vw, M;
+    mp_ptr xs, ys;
+
+    /* the chains of C, as d_i x s matrices */
+    Cc = (nmod_mat_t *) flint_malloc(s*sizeof(nmod_mat_t));
+    Q = (nmod_mat_t *) flint_malloc(s*sizeof(nmod_mat_t));
+
+    for (i = 0; i < s; i++)
+    {
+        slong di = d + (i < r);
+
+        nmod_mat_init(Cc[i], di, s, mod.n);
+        nmod_mat_init(Q[i], CHARPOLY_BATCH, s, mod.n);
+
+        for (l = 0; l < di; l++)
+            _nmod_vec_set(Cc[i]->rows[l], C->rows[l*s + i], s);
+    }
+
+    xs = _nmod_vec_init(n + 1);
+    ys = _nmod_vec_init(n + 1);
+
+    nmod_mat_init(V, CHARPOLY_BATCH, dmax + 1, mod.n);
+    nmod_mat_init(M, s, s, mod.n);
+
+    for (a0 = 0; a0 <= n; a0 += CHARPOLY_BATCH)
+    {
+        b = FLINT_MIN(CHARPOLY_BATCH, n + 1 - a0);
+
+        /* V[a, l] = (a0 + a)^l */
+        for (a = 0; a < b; a++)
+        {
+            mp_limb_t x = a0 + a;
+
+            xs[a0 + a] = x;
+            nmod_mat_entry(V, a, 0) = 1;
+            for (l = 1; l <= dmax; l++)
+                nmod_mat_entry(V, a, l) =
+                    nmod_mul(nmod_mat_entry(V, a, l - 1), x, mod);
+        }
+
+        for (i = 0; i < s; i++)
+        {
+            nmod_mat_t Qw;
+
+            nmod_mat_window_init(Vw, V, 0, 0, b, Cc[i]->r);
+            nmod_mat_window_init(Qw, Q[i], 0, 0, b, s);
+            nmod_mat_mul(Qw, Vw, Cc[i]);
+            nmod_mat_window_clear(Vw);
+            nmod_mat_window_clear(Qw);
+        }
+
+        for (a = 0; a < b; a++)
+        {
+            for (i = 0; i < s; i++)
+                for (j = 0; j < s; j++)
+                    nmod_mat_entry(M, i, j) =
+                        nmod_neg(nmod_mat_entry(Q[i], a, j), mod);
+
+            for (j = 0; j < s; j++)
+                nmod_mat_entry(M, j, j) = nmod_add(nmod_mat_entry(M, j, j),
+                                   nmod_mat_entry(V, a, d + (j < r)), mod);
+
+            ys[a0 + a] = _nmod_mat_det(M);
+        }
+    }
+
+    nmod_poly_interpolate_nmod_vec_fast(cp, xs, ys, n + 1);
+
+    for (i = 0; i < s; i++)
+    {
+        nmod_mat_clear(Cc[i]);
+        nmod_mat_clear(Q[i]);
+    }
+
+    flint_free(Cc);
+    flint_free(Q);
+    nmod_mat_clear(V);
+    nmod_mat_clear(M);
+    _nmod_vec_clear(xs);
+    _nmod_vec_clear(ys);
+}
+
+int
+nmod_mat_charpoly_krylov(nmod_poly_t cp, const nmod_mat_t A,
+                                                         flint_rand_t state)
+{
+    slong n = A->r, s;
+    nmod_mat_t C;
+    int success;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_mat_charpoly_krylov). "
+                     "Non-square matrix.\n");
+        flint_abort();
+    }
+
+    if (A->mod.n <= (ulong) n)
+        return 0;
+
+    if (n == 0)
+    {
+        nmod_poly_one(cp);
+        return 1;
+    }
+
+    s = NMOD_MAT_KRYLOV_BLOCK_SIZE(n);
+
+    nmod_mat_init(C, n, s, A->mod.n);
+
+    success = _nmod_mat_block_krylov(C, A, s, state);
+
+    if (success)
+        _nmod_mat_charpoly_krylov(cp, C, s);
+
+    nmod_mat_clear(C);
+
+    return success;
+}
@@ -0,0 +1,155 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "thread_support.h"
+
+/* below this many entries per elimination step the threads are not woken */
+#define LU_THREADED_STEP_CUTOFF 4096
+
+typedef struct
+{
+    mp_ptr * a;
+    slong start;
+    slong stop;
+    slong row;
+    slong col;
+    slong rank;
+    slong n;
+    mp_limb_t d;
+    nmod_t mod;
+} _lu_elim_arg_t;
+
+static void
+_lu_elim_worker(void * varg)
+{
+    _lu_elim_arg_t * arg = (_lu_elim_arg_t *) varg;
+    mp_ptr * a = arg->a;
+    slong i, row = arg->row, col = arg->col, rank = arg->rank;
+    slong length = arg->n - col - 1;
+    nmod_t mod = arg->mod;
+    mp_limb_t e;
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        e = nmod_mul(a[i][col], arg->d, mod);
+        if (length != 0)
+            _nmod_vec_scalar_addmul_nmod(a[i] + col + 1,
+                a[row] + col + 1, length, nmod_neg(e, mod), mod);
+
+        a[i][col] = 0;
+        a[i][rank - 1] = e;
+    }
+}
+
+/*
+    Same as nmod_mat_lu_classical, but for each pivot the rows below it
+    are eliminated by all threads, which get contiguous blocks of rows.
+*/
+slong
+_nmod_mat_lu_classical_threaded_pool(slong * P, nmod_mat_t A, int rank_check,
+                                  thread_pool_handle * threads, slong nw)
+{
+    _lu_elim_arg_t * args;
+    mp_limb_t d, ** a;
+    mp_ptr u;
+    slong i, j, t, m, n, rank, row, col, nv;
+
+    m = A->r;
+    n = A->c;
+    a = A->rows;
+
+    rank = row = col = 0;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+
+    args = (_lu_elim_arg_t *) flint_malloc((nw + 1)*sizeof(_lu_elim_arg_t));
+
+    while (row < m && col < n)
+    {
+        for (j = row; j < m && a[j][col] == 0; j++)
+            ;
+
+        if (j == m)
+        {
+            if (rank_check)
+            {
+                rank = 0;
+                break;
+            }
+            col++;
+            continue;
+        }
+
+        if (j != row)
+        {
+            u = a[j];
+            a[j] = a[row];
+            a[row] = u;
+
+            t = P[j];
+            P[j] = P[row];
+            P[row] = t;
+        }
+
+        rank++;
+
+        d = nmod_inv(a[row][col], A->mod);
+
+        nv = ((m - row - 1)*(n - col) < LU_THREADED_STEP_CUTOFF) ? 0 :
+                                             FLINT_MIN(nw, m - row - 2);
+
+        for (i = 0; i <= nv; i++)
+        {
+            args[i].a = a;
+            args[i].start = row + 1 + (i*(m - row - 1))/(nv + 1);
+            args[i].stop = row + 1 + ((i + 1)*(m - row - 1))/(nv + 1);
+            args[i].row = row;
+            args[i].col = col;
+            args[i].rank = rank;
+            args[i].n = n;
+            args[i].d = d;
+            args[i].mod = A->mod;
+        }
+
+        for (i = 0; i < nv; i++)
+            thread_pool_wake(global_thread_pool, threads[i], 0,
+                                                   _lu_elim_worker, &args[i]);
+
+        _lu_elim_worker(&args[nv]);
+
+        for (i = 0; i < nv; i++)
+            thread_pool_wait(global_thread_pool, threads[i]);
+
+        row++;
+        col++;
+    }
+
+    flint_free(args);
+
+    return rank;
+}
+
+slong
+nmod_mat_lu_classical_threaded(slong * P, nmod_mat_t A, int rank_check)
+{
+    thread_pool_handle * threads;
+    slong nw, rank;
+
+    nw = flint_request_threads(&threads, flint_get_num_threads());
+
+    rank = _nmod_mat_lu_classical_threaded_pool(P, A, rank_check, threads, nw);
+
+    flint_give_back_threads(threads, nw);
+
+    return rank;
+}
@@ -195,5 +195,19 @@ void nmod_mat_minpoly_with_gens(nmod_poly_t p, const nmod_mat_t X, ulong * P)
 
 void nmod_mat_minpoly(nmod_poly_t p, const nmod_mat_t X)
 {
+   if (X->r >= NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF && X->r == X->c &&
+       X->mod.n > (ulong) X->r && n_is_prime(X->mod.n))
+   {
+      flint_rand_t state;
+      int success;
+
+      flint_randinit(state);
+      success = nmod_mat_minpoly_krylov(p, X, state);
+      flint_randclear(state);
+
+      if (success)
+         return;
+   }
+
    nmod_mat_minpoly_with_gens(p, X, NULL);
 }
@@ -0,0 +1,116 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+/*
+    y = B x where B is the block companion matrix of A in the basis K of
+    _nmod_mat_block_krylov: column t of B is e_(t + s) if t < n - s and
+    column t mod s of C otherwise. The array xl has length s.
+*/
+static void
+_block_companion_mul_vec(mp_ptr y, const nmod_mat_t C, mp_srcptr x,
+                                                     mp_ptr xl, int nlimbs)
+{
+    slong n = C->r, s = C->c, t;
+
+    for (t = n - s; t < n; t++)
+        xl[t % s] = x[t];
+
+    for (t = 0; t < n; t++)
+    {
+        y[t] = _nmod_vec_dot(C->rows[t], xl, s, C->mod, nlimbs);
+
+        if (t >= s)
+            y[t] = nmod_add(y[t], x[t - s], C->mod);
+    }
+}
+
+/*
+    The minimal polynomial of a sequence u^T B^k e_0 divides the minimal
+    polynomial of A, which divides the characteristic polynomial. If its
+    degree is n, all three agree, so a cyclic matrix is certified with
+    O(n^2 s) operations on top of the characteristic polynomial.
+*/
+int
+nmod_mat_minpoly_krylov(nmod_poly_t p, const nmod_mat_t A,
+                                                         flint_rand_t state)
+{
+    slong n = A->r, s, i;
+    nmod_mat_t C;
+    nmod_berlekamp_massey_t B;
+    mp_ptr u, v, w, xl, t;
+    int nlimbs, success;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_mat_minpoly_krylov). "
+                     "Non-square matrix.\n");
+        flint_abort();
+    }
+
+    if (A->mod.n <= (ulong) n)
+        return 0;
+
+    if (n == 0)
+    {
+        nmod_poly_one(p);
+        return 1;
+    }
+
+    s = NMOD_MAT_KRYLOV_BLOCK_SIZE(n);
+
+    nmod_mat_init(C, n, s, A->mod.n);
+
+    if (!_nmod_mat_block_krylov(C, A, s, state))
+    {
+        nmod_mat_clear(C);
+        return 0;
+    }
+
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    xl = _nmod_vec_init(s);
+
+    for (i = 0; i < n; i++)
+    {
+        u[i] = n_randint(state, A->mod.n);
+        v[i] = (i == 0);
+    }
+
+    nlimbs = _nmod_vec_dot_bound_limbs(FLINT_MAX(n, s), A->mod);
+
+    nmod_berlekamp_massey_init(B, A->mod.n);
+
+    for (i = 0; i < 2*n; i++)
+    {
+        nmod_berlekamp_massey_add_point(B,
+                                    _nmod_vec_dot(u, v, n, A->mod, nlimbs));
+        _block_companion_mul_vec(w, C, v, xl, nlimbs);
+        t = v; v = w; w = t;
+    }
+
+    nmod_berlekamp_massey_reduce(B);
+
+    success = (nmod_poly_degree(nmod_berlekamp_massey_V_poly(B)) == n);
+
+    if (success)
+        _nmod_mat_charpoly_krylov(p, C, s);
+
+    nmod_berlekamp_massey_clear(B);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(xl);
+    nmod_mat_clear(C);
+
+    return success;
+}
@@ -15,6 +15,7 @@
 #include <gmp.h>
 #include "flint.h"
 #include "nmod_mat.h"
+#include "gf2_mat.h"
 #include "nmod_vec.h"
 #include "thread_support.h"
 
@@ -32,6 +33,26 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     slong cutoff;
     slong flint_num_threads = flint_get_num_threads();
 
+    /* over GF(2), packing the entries into bits wins by a large margin */
+    if (A->mod.n == 2 && min_dim >= 32)
+    {
+        gf2_mat_t A2, B2, C2;
+
+        gf2_mat_init(A2, m, k);
+        gf2_mat_init(B2, k, n);
+        gf2_mat_init(C2, m, n);
+
+        gf2_mat_set_nmod_mat(A2, A);
+        gf2_mat_set_nmod_mat(B2, B);
+        gf2_mat_mul(C2, A2, B2);
+        gf2_mat_get_nmod_mat(C, C2);
+
+        gf2_mat_clear(A2);
+        gf2_mat_clear(B2);
+        gf2_mat_clear(C2);
+        return;
+    }
+
 #if FLINT_USES_BLAS
     /*
         tuning is based on several assumptions:
@@ -67,6 +88,26 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
         if (min_dim > cutoff && nmod_mat_mul_blas(C, A, B))
             return;
     }
+#else
+    /*
+        nmod_mat_mul_blas falls back to the internal dgemm kernel, which
+        is slower than a real blas: it wins when a single dgemm suffices
+        and mul_classical can pack at most two entries per word, and with
+        crt only while mul_classical needs two limb dot products of
+        entries that are not too big.
+    */
+    if (FLINT_BITS == 64 && min_dim >= 64)
+    {
+        flint_bitcnt_t bits = FLINT_BIT_COUNT(A->mod.n);
+        flint_bitcnt_t dbits = FLINT_BIT_COUNT(k) + 2*bits;
+
+        if ((dbits > FLINT_BITS/3 + 2 && dbits <= 53 + 2) ||
+            (dbits > FLINT_BITS && bits <= 40 && min_dim >= 200))
+        {
+            if (nmod_mat_mul_blas(C, A, B))
+                return;
+        }
+    }
 #endif
 
     if (C == A || C == B)
@@ -85,7 +126,13 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
         cutoff = 200;
 
     if (flint_num_threads > 1)
-	    nmod_mat_mul_classical_threaded(C, A, B);
+    {
+        /* the seven half size products must be worth a Strassen step */
+        if (min_dim < 2*cutoff)
+            nmod_mat_mul_classical_threaded(C, A, B);
+        else
+            nmod_mat_mul_strassen_threaded(C, A, B);
+    }
     else if (min_dim < cutoff)
         nmod_mat_mul_classical(C, A, B);
     else
@@ -10,9 +10,22 @@
 #include "nmod_mat.h"
 #include "thread_support.h"
 
-#if FLINT_USES_BLAS && FLINT_BITS == 64
+#if FLINT_BITS == 64
 
+/*
+    Without BLAS the same code runs on FLINT's own packed dgemm kernel,
+    which is given the threads that are held for the conversions.
+*/
+#if FLINT_USES_BLAS
 #include "cblas.h"
+#define _DGEMM(m, n, k, dA, lda, dB, ldb, dC, ldc, threads, num_threads)    \
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,          \
+                                     1.0, dA, lda, dB, ldb, 0.0, dC, ldc)
+#else
+#include "d_mat.h"
+#define _DGEMM(m, n, k, dA, lda, dB, ldb, dC, ldc, threads, num_threads)    \
+    _d_mat_gemm_pool(dC, ldc, dA, lda, dB, ldb, m, n, k, threads, num_threads)
+#endif
 
 /*
     This code is on the edge of disaster. Blas is used for dot products
@@ -66,6 +79,8 @@ static void _distribute_rows(
 }
 
 
+#if FLINT_USES_BLAS
+
 /************ small enough that a single sgemm suffices **********************/
 
 static void _lift_vec_sp(float * a, ulong * b, slong len, ulong n)
@@ -242,6 +257,8 @@ static int _nmod_mat_mul_blas_sp(nmod_mat_t C,
 }
 
 
+#endif
+
 /******** handle larger larger moduli via several dgemm's and crt ************/
 
 #define MAX_CRT_NUM 12
@@ -474,8 +491,7 @@ static int _nmod_mat_mul_blas_crt(nmod_mat_t C,
         for (i = 0; i < num_workers; i++)
             thread_pool_wait(global_thread_pool, handles[i]);
 
-        cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                                       1.0, dA, k, dB, n, 0.0, dC + pi*m*n, n);
+        _DGEMM(m, n, k, dA, k, dB, n, dC + pi*m*n, n, handles, num_workers);
     }
 
     {
@@ -624,8 +640,10 @@ int nmod_mat_mul_blas(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     if (hi != 0 || lo >= MAX_BLAS_DP_INT)
         return _nmod_mat_mul_blas_crt(C, A, B);
 
+#if FLINT_USES_BLAS
     if (lo < MAX_BLAS_SP_INT)
         return _nmod_mat_mul_blas_sp(C, A, B);
+#endif
 
     dA = flint_malloc(m*k*sizeof(double));
     dB = flint_malloc(k*n*sizeof(double));
@@ -663,8 +681,7 @@ int nmod_mat_mul_blas(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
             thread_pool_wait(global_thread_pool, handles[i]);
     }
 
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                                                1.0, dA, k, dB, n, 0.0, dC, n);
+    _DGEMM(m, n, k, dA, k, dB, n, dC, n, handles, num_workers);
 
     /* convert output */
 
@@ -0,0 +1,223 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    nmod_mat_struct * P;      /* products */
+    nmod_mat_struct * S;      /* left operands */
+    nmod_mat_struct * T;      /* right operands */
+    slong start;
+    slong step;
+}
+_strassen_arg_t;
+
+static void
+_strassen_worker(void * arg_ptr)
+{
+    _strassen_arg_t * arg = (_strassen_arg_t *) arg_ptr;
+    slong i;
+
+    for (i = arg->start; i < 7; i += arg->step)
+        nmod_mat_mul(arg->P + i, arg->S + i, arg->T + i);
+}
+
+/*
+    One level of Strassen-Winograd in which the seven half size products
+    are independent tasks. The operand sums are formed first, then the
+    products are shared out among up to seven threads, each of which
+    multiplies with its part of the remaining threads through nmod_mat_mul
+    and hence recursively in parallel. Four products are written into the
+    quadrants of C and three need temporaries, so that at most eleven
+    quarter size matrices are allocated per level.
+*/
+void
+nmod_mat_mul_strassen_threaded(nmod_mat_t C, const nmod_mat_t A,
+                                                          const nmod_mat_t B)
+{
+    slong a, b, c, i;
+    slong anr, anc, bnr, bnc;
+    slong nt, nw, nw_save, share;
+    thread_pool_handle * threads;
+    _strassen_arg_t * args;
+
+    nmod_mat_t A11, A12, A21, A22;
+    nmod_mat_t B11, B12, B21, B22;
+    nmod_mat_t C11, C12, C21, C22;
+    nmod_mat_struct S[7], T[7], P[7], X[8];
+
+    a = A->r;
+    b = A->c;
+    c = B->c;
+
+    nt = flint_get_num_threads();
+
+    if (a <= 4 || b <= 4 || c <= 4 || nt < 2)
+    {
+        nmod_mat_mul(C, A, B);
+        return;
+    }
+
+    anr = a / 2;
+    anc = b / 2;
+    bnr = anc;
+    bnc = c / 2;
+
+    nmod_mat_window_init(A11, A, 0, 0, anr, anc);
+    nmod_mat_window_init(A12, A, 0, anc, anr, 2*anc);
+    nmod_mat_window_init(A21, A, anr, 0, 2*anr, anc);
+    nmod_mat_window_init(A22, A, anr, anc, 2*anr, 2*anc);
+
+    nmod_mat_window_init(B11, B, 0, 0, bnr, bnc);
+    nmod_mat_window_init(B12, B, 0, bnc, bnr, 2*bnc);
+    nmod_mat_window_init(B21, B, bnr, 0, 2*bnr, bnc);
+    nmod_mat_window_init(B22, B, bnr, bnc, 2*bnr, 2*bnc);
+
+    nmod_mat_window_init(C11, C, 0, 0, anr, bnc);
+    nmod_mat_window_init(C12, C, 0, bnc, anr, 2*bnc);
+    nmod_mat_window_init(C21, C, anr, 0, 2*anr, bnc);
+    nmod_mat_window_init(C22, C, anr, bnc, 2*anr, 2*bnc);
+
+    /* X[0..3] = S1..S4, X[4..7] = T1..T4 */
+    for (i = 0; i < 4; i++)
+    {
+        nmod_mat_init(X + i, anr, anc, A->mod.n);
+        nmod_mat_init(X + 4 + i, anc, bnc, A->mod.n);
+    }
+
+    nmod_mat_add(X + 0, A21, A22);
+    nmod_mat_sub(X + 1, X + 0, A11);
+    nmod_mat_sub(X + 2, A11, A21);
+    nmod_mat_sub(X + 3, A12, X + 1);
+
+    nmod_mat_sub(X + 4, B12, B11);
+    nmod_mat_sub(X + 5, B22, X + 4);
+    nmod_mat_sub(X + 6, B22, B12);
+    nmod_mat_sub(X + 7, X + 5, B21);
+
+    /*
+        P1 = A11 B11, P2 = A12 B21, P3 = S4 B22, P4 = A22 T4,
+        P5 = S1 T1, P6 = S2 T2, P7 = S3 T3
+    */
+    S[0] = *A11;    T[0] = *B11;
+    S[1] = *A12;    T[1] = *B21;
+    S[2] = X[3];    T[2] = *B22;
+    S[3] = *A22;    T[3] = X[7];
+    S[4] = X[0];    T[4] = X[4];
+    S[5] = X[1];    T[5] = X[5];
+    S[6] = X[2];    T[6] = X[6];
+
+    nmod_mat_init(P + 0, anr, bnc, A->mod.n);
+    nmod_mat_init(P + 1, anr, bnc, A->mod.n);
+    P[2] = *C11;
+    nmod_mat_init(P + 3, anr, bnc, A->mod.n);
+    P[4] = *C22;
+    P[5] = *C12;
+    P[6] = *C21;
+
+    nw = flint_request_threads(&threads, FLINT_MIN(nt, 7));
+
+    args = (_strassen_arg_t *) flint_malloc((nw + 1)*sizeof(_strassen_arg_t));
+    share = nt/(nw + 1);
+
+    for (i = 0; i <= nw; i++)
+    {
+        args[i].P = P;
+        args[i].S = S;
+        args[i].T = T;
+        args[i].start = i;
+        args[i].step = nw + 1;
+    }
+
+    nw_save = flint_set_num_workers(nt - share*nw - 1);
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wake(global_thread_pool, threads[i], share - 1,
+                                             _strassen_worker, &args[i + 1]);
+
+    _strassen_worker(&args[0]);
+
+    flint_reset_num_workers(nw_save);
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wait(global_thread_pool, threads[i]);
+
+    flint_give_back_threads(threads, nw);
+
+    flint_free(args);
+
+    for (i = 0; i < 8; i++)
+        nmod_mat_clear(X + i);
+
+    /* C12 = U5, C21 = U6, C22 = U7, C11 = U1 */
+    nmod_mat_add(C12, C12, P + 0);
+    nmod_mat_add(C21, C21, C12);
+    nmod_mat_add(C12, C12, C22);
+    nmod_mat_add(C22, C21, C22);
+    nmod_mat_add(C12, C12, C11);
+    nmod_mat_sub(C21, C21, P + 3);
+    nmod_mat_add(C11, P + 0, P + 1);
+
+    nmod_mat_clear(P + 0);
+    nmod_mat_clear(P + 1);
+    nmod_mat_clear(P + 3);
+
+    nmod_mat_window_clear(A11);
+    nmod_mat_window_clear(A12);
+    nmod_mat_window_clear(A21);
+    nmod_mat_window_clear(A22);
+
+    nmod_mat_window_clear(B11);
+    nmod_mat_window_clear(B12);
+    nmod_mat_window_clear(B21);
+    nmod_mat_window_clear(B22);
+
+    nmod_mat_window_clear(C11);
+    nmod_mat_window_clear(C12);
+    nmod_mat_window_clear(C21);
+    nmod_mat_window_clear(C22);
+
+    if (c > 2*bnc) /* A by last col of B -> last col of C */
+    {
+        nmod_mat_t Bc, Cc;
+        nmod_mat_window_init(Bc, B, 0, 2*bnc, b, c);
+        nmod_mat_window_init(Cc, C, 0, 2*bnc, a, c);
+        nmod_mat_mul(Cc, A, Bc);
+        nmod_mat_window_clear(Bc);
+        nmod_mat_window_clear(Cc);
+    }
+
+    if (a > 2*anr) /* last row of A by B -> last row of C */
+    {
+        nmod_mat_t Ar, Cr;
+        nmod_mat_window_init(Ar, A, 2*anr, 0, a, b);
+        nmod_mat_window_init(Cr, C, 2*anr, 0, a, c);
+        nmod_mat_mul(Cr, Ar, B);
+        nmod_mat_window_clear(Ar);
+        nmod_mat_window_clear(Cr);
+    }
+
+    if (b > 2*anc) /* last col of A by last row of B -> C */
+    {
+        nmod_mat_t Ac, Br, Cb;
+        nmod_mat_window_init(Ac, A, 0, 2*anc, 2*anr, b);
+        nmod_mat_window_init(Br, B, 2*bnr, 0, b, 2*bnc);
+        nmod_mat_window_init(Cb, C, 0, 0, 2*anr, 2*bnc);
+        nmod_mat_addmul(Cb, Cb, Ac, Br);
+        nmod_mat_window_clear(Ac);
+        nmod_mat_window_clear(Br);
+        nmod_mat_window_clear(Cb);
+    }
+}
@@ -14,6 +14,7 @@
 #include "ulong_extras.h"
 #include "nmod_vec.h"
 #include "nmod_mat.h"
+#include "gf2_mat.h"
 
 
 slong
@@ -29,6 +30,18 @@ nmod_mat_rank(const nmod_mat_t A)
     if (m == 0 || n == 0)
         return 0;
 
+    if (A->mod.n == 2 && FLINT_MIN(m, n) >= 32)
+    {
+        gf2_mat_t B;
+
+        gf2_mat_init(B, m, n);
+        gf2_mat_set_nmod_mat(B, A);
+        rank = gf2_mat_rref(B);
+        gf2_mat_clear(B);
+
+        return rank;
+    }
+
     nmod_mat_init_set(tmp, A);
     perm = flint_malloc(sizeof(slong) * m);
 
@@ -0,0 +1,104 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_mat.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    nmod_mat_struct * X;
+    const nmod_mat_struct * T;
+    const nmod_mat_struct * B;
+    slong c0;
+    slong c1;
+    int unit;
+    int upper;
+} _solve_tri_arg_t;
+
+static void
+_solve_tri_worker(void * varg)
+{
+    _solve_tri_arg_t * arg = (_solve_tri_arg_t *) varg;
+    nmod_mat_t XX, BB;
+
+    nmod_mat_window_init(XX, arg->X, 0, arg->c0, arg->X->r, arg->c1);
+    nmod_mat_window_init(BB, arg->B, 0, arg->c0, arg->B->r, arg->c1);
+
+    if (BB->r < NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF ||
+        BB->c < NMOD_MAT_SOLVE_TRI_COLS_CUTOFF)
+    {
+        if (arg->upper)
+            nmod_mat_solve_triu_classical(XX, arg->T, BB, arg->unit);
+        else
+            nmod_mat_solve_tril_classical(XX, arg->T, BB, arg->unit);
+    }
+    else
+    {
+        if (arg->upper)
+            nmod_mat_solve_triu_recursive(XX, arg->T, BB, arg->unit);
+        else
+            nmod_mat_solve_tril_recursive(XX, arg->T, BB, arg->unit);
+    }
+
+    nmod_mat_window_clear(XX);
+    nmod_mat_window_clear(BB);
+}
+
+/*
+    The columns of B are solved for independently. They are cut into
+    blocks of at least NMOD_MAT_SOLVE_TRI_COLS_CUTOFF columns, one per
+    thread, and the remaining threads are shared out between the blocks
+    for the multiplications in the recursive solves.
+*/
+void
+_nmod_mat_solve_tri_threaded(nmod_mat_t X, const nmod_mat_t T,
+                                  const nmod_mat_t B, int unit, int upper)
+{
+    _solve_tri_arg_t * args;
+    thread_pool_handle * threads;
+    slong i, m, nt, nw, nw_save, share;
+
+    m = B->c;
+    nt = flint_get_num_threads();
+
+    nw = flint_request_threads(&threads,
+                     FLINT_MIN(nt, m/NMOD_MAT_SOLVE_TRI_COLS_CUTOFF));
+
+    args = (_solve_tri_arg_t *) flint_malloc((nw + 1)*sizeof(_solve_tri_arg_t));
+    share = nt/(nw + 1);
+
+    for (i = 0; i <= nw; i++)
+    {
+        args[i].X = X;
+        args[i].T = T;
+        args[i].B = B;
+        args[i].c0 = (i*m)/(nw + 1);
+        args[i].c1 = ((i + 1)*m)/(nw + 1);
+        args[i].unit = unit;
+        args[i].upper = upper;
+    }
+
+    nw_save = flint_set_num_workers(nt - share*nw - 1);
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wake(global_thread_pool, threads[i], share - 1,
+                                                 _solve_tri_worker, &args[i]);
+
+    _solve_tri_worker(&args[nw]);
+
+    flint_reset_num_workers(nw_save);
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wait(global_thread_pool, threads[i]);
+
+    flint_give_back_threads(threads, nw);
+
+    flint_free(args);
+}
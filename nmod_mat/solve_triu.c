@@ -14,6 +14,7 @@
 #include "flint.h"
 #include "nmod_mat.h"
 #include "nmod_vec.h"
+#include "thread_support.h"
 
 void
 nmod_mat_solve_triu(nmod_mat_t X, const nmod_mat_t U,
@@ -24,6 +25,11 @@ nmod_mat_solve_triu(nmod_mat_t X, const nmod_mat_t U,
     {
         nmod_mat_solve_triu_classical(X, U, B, unit);
     }
+    else if (flint_get_num_threads() > 1 &&
+             B->c >= 2*NMOD_MAT_SOLVE_TRI_COLS_CUTOFF)
+    {
+        _nmod_mat_solve_tri_threaded(X, U, B, unit, 1);
+    }
     else
     {
         nmod_mat_solve_triu_recursive(X, U, B, unit);
@@ -0,0 +1,109 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong n, s, rep;
+    mp_limb_t p;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("charpoly_krylov....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 200 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_t A;
+        nmod_poly_t f, g;
+        int full, success;
+
+        n = n_randint(state, 100);
+        p = n_randtest_prime(state, 0);
+        full = n_randint(state, 2);
+
+        nmod_mat_init(A, n, n, p);
+        nmod_poly_init(f, p);
+        nmod_poly_init(g, p);
+
+        if (full)
+            nmod_mat_randfull(A, state);
+        else
+            nmod_mat_randtest(A, state);
+
+        success = nmod_mat_charpoly_krylov(f, A, state);
+        nmod_mat_charpoly_berkowitz(g, A);
+
+        if ((p <= n && success) ||
+            (full && p > UWORD(1) << 40 && !success) ||
+            (success && !nmod_poly_equal(f, g)))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wd, p = %wu, success = %d\n", n, p, success);
+            flint_printf("Matrix A:\n"), nmod_mat_print_pretty(A), flint_printf("\n");
+            flint_printf("cp = "), nmod_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("cp_berkowitz = "), nmod_poly_print_pretty(g, "X"), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+    }
+
+    /* all block sizes */
+    for (rep = 0; rep < 200 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_t A, C;
+        nmod_poly_t f, g;
+
+        n = 1 + n_randint(state, 40);
+        s = 1 + n_randint(state, n);
+        p = n_randprime(state, 20 + n_randint(state, FLINT_BITS - 20), 1);
+
+        nmod_mat_init(A, n, n, p);
+        nmod_mat_init(C, n, s, p);
+        nmod_poly_init(f, p);
+        nmod_poly_init(g, p);
+
+        nmod_mat_randtest(A, state);
+
+        if (_nmod_mat_block_krylov(C, A, s, state))
+        {
+            _nmod_mat_charpoly_krylov(f, C, s);
+            nmod_mat_charpoly_berkowitz(g, A);
+
+            if (!nmod_poly_equal(f, g))
+            {
+                flint_printf("FAIL (block size):\n");
+                flint_printf("n = %wd, s = %wd, p = %wu\n", n, s, p);
+                flint_printf("Matrix A:\n"), nmod_mat_print_pretty(A), flint_printf("\n");
+                flint_printf("cp = "), nmod_poly_print_pretty(f, "X"), flint_printf("\n");
+                flint_printf("cp_berkowitz = "), nmod_poly_print_pretty(g, "X"), flint_printf("\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(C);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
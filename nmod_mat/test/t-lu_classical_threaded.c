@@ -0,0 +1,134 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+#include "perm.h"
+
+int
+main(void)
+{
+    slong i, max_threads = 7;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lu_classical_threaded....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, LU, LU2;
+        mp_limb_t mod;
+        slong m, n, r, d, rank, rank2;
+        slong * P, * P2;
+        int rank_check;
+
+        m = n_randint(state, 300);
+        n = n_randint(state, 50);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+        rank_check = n_randint(state, 2);
+
+        mod = n_randtest_prime(state, 0);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_randrank(A, state, r);
+
+        if (n_randint(state, 2))
+        {
+            d = n_randint(state, 2*m*n + 1);
+            nmod_mat_randops(A, d, state);
+        }
+
+        nmod_mat_init_set(LU, A);
+        nmod_mat_init_set(LU2, A);
+        P = flint_malloc(sizeof(slong) * m);
+        P2 = flint_malloc(sizeof(slong) * m);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        rank = nmod_mat_lu_classical_threaded(P, LU, rank_check);
+        rank2 = nmod_mat_lu_classical(P2, LU2, rank_check);
+
+        if (rank != rank2 || (!rank_check && rank != r) ||
+            (rank == r && (!nmod_mat_equal(LU, LU2) || !_perm_equal(P, P2, m))))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, n = %wd, r = %wd, rank = %wd, rank2 = %wd\n",
+                                                        m, n, r, rank, rank2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(LU);
+        nmod_mat_clear(LU2);
+        flint_free(P);
+        flint_free(P2);
+    }
+
+    /* Check nmod_mat_lu on tall panels while the pool is busy */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, LU, LU2;
+        thread_pool_handle * threads;
+        mp_limb_t mod;
+        slong m, n, r, rank, rank2, nw;
+        slong * P, * P2;
+
+        m = NMOD_MAT_LU_THREADED_ROWS_CUTOFF + n_randint(state, 100);
+        n = 4 + n_randint(state, 16);
+        r = n_randint(state, n + 1);
+
+        mod = n_randtest_prime(state, 0);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_randrank(A, state, r);
+        nmod_mat_randops(A, n_randint(state, 2*m*n + 1), state);
+
+        nmod_mat_init_set(LU, A);
+        nmod_mat_init_set(LU2, A);
+        P = flint_malloc(sizeof(slong) * m);
+        P2 = flint_malloc(sizeof(slong) * m);
+
+        flint_set_num_threads(4 + n_randint(state, max_threads - 3));
+
+        /* hold all or all but one of the workers */
+        nw = flint_request_threads(&threads,
+                             flint_get_num_threads() - n_randint(state, 2));
+
+        rank = nmod_mat_lu(P, LU, 0);
+        rank2 = nmod_mat_lu_classical(P2, LU2, 0);
+
+        flint_give_back_threads(threads, nw);
+
+        if (rank != rank2 || rank != r ||
+            !nmod_mat_equal(LU, LU2) || !_perm_equal(P, P2, m))
+        {
+            flint_printf("FAIL (busy pool):\n");
+            flint_printf("m = %wd, n = %wd, r = %wd, rank = %wd, rank2 = %wd\n",
+                                                        m, n, r, rank, rank2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(LU);
+        nmod_mat_clear(LU2);
+        flint_free(P);
+        flint_free(P2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
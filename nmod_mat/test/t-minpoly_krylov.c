@@ -0,0 +1,112 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong n, rep, i;
+    mp_limb_t p;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("minpoly_krylov....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 200 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_t A;
+        nmod_poly_t f, g;
+        int full, success;
+
+        n = n_randint(state, 100);
+        p = n_randtest_prime(state, 0);
+        full = n_randint(state, 2);
+
+        nmod_mat_init(A, n, n, p);
+        nmod_poly_init(f, p);
+        nmod_poly_init(g, p);
+
+        if (full)
+            nmod_mat_randfull(A, state);
+        else
+            nmod_mat_randtest(A, state);
+
+        success = nmod_mat_minpoly_krylov(f, A, state);
+        nmod_mat_minpoly_with_gens(g, A, NULL);
+
+        if ((p <= n && success) ||
+            (full && p > UWORD(1) << 40 && !success) ||
+            (success && !nmod_poly_equal(f, g)))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wd, p = %wu, success = %d\n", n, p, success);
+            flint_printf("Matrix A:\n"), nmod_mat_print_pretty(A), flint_printf("\n");
+            flint_printf("mp = "), nmod_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("mp_with_gens = "), nmod_poly_print_pretty(g, "X"), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+    }
+
+    /* matrices which are not cyclic must be rejected */
+    for (rep = 0; rep < 100 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_t A;
+        nmod_poly_t f;
+        mp_limb_t c;
+
+        n = 2 + n_randint(state, 60);
+        p = n_randprime(state, 20 + n_randint(state, FLINT_BITS - 20), 1);
+        c = n_randint(state, p);
+
+        nmod_mat_init(A, n, n, p);
+        nmod_poly_init(f, p);
+
+        /* two equal Jordan blocks have a minimal polynomial of degree < n */
+        for (i = 0; i < n / 2; i++)
+        {
+            nmod_mat_entry(A, i, i) = c;
+            nmod_mat_entry(A, i + n / 2, i + n / 2) = c;
+            if (i > 0)
+            {
+                nmod_mat_entry(A, i - 1, i) = 1;
+                nmod_mat_entry(A, i + n / 2 - 1, i + n / 2) = 1;
+            }
+        }
+
+        for (i = 0; i < 10; i++)
+            nmod_mat_similarity(A, n_randint(state, n), n_randint(state, p));
+
+        if (nmod_mat_minpoly_krylov(f, A, state))
+        {
+            flint_printf("FAIL (not cyclic):\n");
+            flint_printf("n = %wd, p = %wu\n", n, p);
+            flint_printf("Matrix A:\n"), nmod_mat_print_pretty(A), flint_printf("\n");
+            flint_printf("mp = "), nmod_poly_print_pretty(f, "X"), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_poly_clear(f);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
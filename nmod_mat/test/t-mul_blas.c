@@ -98,7 +98,7 @@ main(void)
                 flint_abort();
             }
         }
-#if FLINT_USES_BLAS && FLINT_BITS == 64
+#if FLINT_BITS == 64
         else
         {
             flint_printf("FAIL: blas should have worked\n");
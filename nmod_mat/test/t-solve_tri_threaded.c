@@ -0,0 +1,84 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, max_threads = 7;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_tri_threaded....");
+    fflush(stdout);
+
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, X, B, Y;
+        mp_limb_t m;
+        slong rows, cols;
+        int unit, upper;
+
+        m = n_randtest_prime(state, 0);
+        rows = n_randint(state, 200);
+        cols = n_randint(state, 600);
+        unit = n_randint(state, 2);
+        upper = n_randint(state, 2);
+
+        nmod_mat_init(A, rows, rows, m);
+        nmod_mat_init(B, rows, cols, m);
+        nmod_mat_init(X, rows, cols, m);
+        nmod_mat_init(Y, rows, cols, m);
+
+        if (upper)
+            nmod_mat_randtriu(A, state, unit);
+        else
+            nmod_mat_randtril(A, state, unit);
+        nmod_mat_randtest(X, state);
+        nmod_mat_mul(B, A, X);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        /* Check Y = A^(-1) * (A * X) = X */
+        _nmod_mat_solve_tri_threaded(Y, A, B, unit, upper);
+        if (!nmod_mat_equal(Y, X))
+        {
+            flint_printf("FAIL!\n");
+            flint_printf("rows = %wd, cols = %wd, unit = %d, upper = %d\n",
+                                                    rows, cols, unit, upper);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* Check aliasing */
+        _nmod_mat_solve_tri_threaded(B, A, B, unit, upper);
+        if (!nmod_mat_equal(B, X))
+        {
+            flint_printf("FAIL!\n");
+            flint_printf("aliasing test failed");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
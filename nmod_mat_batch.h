@@ -0,0 +1,235 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_MAT_BATCH_H
+#define NMOD_MAT_BATCH_H
+
+#ifdef NMOD_MAT_BATCH_INLINES_C
+#define NMOD_MAT_BATCH_INLINE FLINT_DLL
+#else
+#define NMOD_MAT_BATCH_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    A batch of num matrices of the same shape r x c over Z/nZ. The
+    matrices are stored in blocks of NMOD_MAT_BATCH_BLOCK, and within a
+    block as structure of arrays: entry (i, j) of matrix t is
+
+        entries[b*r*c*NMOD_MAT_BATCH_BLOCK + (i*c + j)*NMOD_MAT_BATCH_BLOCK + u]
+
+    where t = b*NMOD_MAT_BATCH_BLOCK + u. The last block is padded with
+    zero matrices. Every operation acts on all the matrices of the batch
+    independently, and the loops over the matrices of a block are the
+    innermost ones so that they can be vectorised.
+*/
+typedef struct
+{
+    mp_ptr entries;
+    slong num;
+    slong r;
+    slong c;
+    nmod_t mod;
+}
+nmod_mat_batch_struct;
+
+typedef nmod_mat_batch_struct nmod_mat_batch_t[1];
+
+#define NMOD_MAT_BATCH_BLOCK 16
+
+/* above this size det and solve work matrix by matrix with nmod_mat */
+#define NMOD_MAT_BATCH_GAUSS_CUTOFF 24
+
+#define nmod_mat_batch_entry(B, t, i, j)                                    \
+    ((B)->entries[((t) / NMOD_MAT_BATCH_BLOCK)*(B)->r*(B)->c*               \
+                        NMOD_MAT_BATCH_BLOCK +                              \
+                  ((i)*(B)->c + (j))*NMOD_MAT_BATCH_BLOCK +                 \
+                  (t) % NMOD_MAT_BATCH_BLOCK])
+
+/* number of blocks and pointer to block b */
+
+#define _nmod_mat_batch_num_blocks(B)                                       \
+    (((B)->num + NMOD_MAT_BATCH_BLOCK - 1) / NMOD_MAT_BATCH_BLOCK)
+
+#define _nmod_mat_batch_block(B, b)                                         \
+    ((B)->entries + (b)*(B)->r*(B)->c*NMOD_MAT_BATCH_BLOCK)
+
+/* Memory management *********************************************************/
+
+FLINT_DLL void nmod_mat_batch_init(nmod_mat_batch_t B, slong num,
+                                           slong rows, slong cols, mp_limb_t n);
+
+FLINT_DLL void nmod_mat_batch_clear(nmod_mat_batch_t B);
+
+NMOD_MAT_BATCH_INLINE
+void nmod_mat_batch_swap(nmod_mat_batch_t B1, nmod_mat_batch_t B2)
+{
+    nmod_mat_batch_struct t = *B1;
+    *B1 = *B2;
+    *B2 = t;
+}
+
+/* Basic properties and manipulation *****************************************/
+
+NMOD_MAT_BATCH_INLINE
+slong nmod_mat_batch_num(const nmod_mat_batch_t B)
+{
+    return B->num;
+}
+
+NMOD_MAT_BATCH_INLINE
+slong nmod_mat_batch_nrows(const nmod_mat_batch_t B)
+{
+    return B->r;
+}
+
+NMOD_MAT_BATCH_INLINE
+slong nmod_mat_batch_ncols(const nmod_mat_batch_t B)
+{
+    return B->c;
+}
+
+NMOD_MAT_BATCH_INLINE
+mp_limb_t nmod_mat_batch_get_entry(const nmod_mat_batch_t B,
+                                                     slong t, slong i, slong j)
+{
+    return nmod_mat_batch_entry(B, t, i, j);
+}
+
+NMOD_MAT_BATCH_INLINE
+void nmod_mat_batch_set_entry(nmod_mat_batch_t B,
+                                        slong t, slong i, slong j, mp_limb_t x)
+{
+    nmod_mat_batch_entry(B, t, i, j) = x;
+}
+
+FLINT_DLL void nmod_mat_batch_zero(nmod_mat_batch_t B);
+
+FLINT_DLL void nmod_mat_batch_one(nmod_mat_batch_t B);
+
+FLINT_DLL void nmod_mat_batch_set(nmod_mat_batch_t B,
+                                                    const nmod_mat_batch_t A);
+
+FLINT_DLL int nmod_mat_batch_equal(const nmod_mat_batch_t A,
+                                                    const nmod_mat_batch_t B);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL void nmod_mat_batch_get_nmod_mat(nmod_mat_t M,
+                                            const nmod_mat_batch_t B, slong t);
+
+FLINT_DLL void nmod_mat_batch_set_nmod_mat(nmod_mat_batch_t B, slong t,
+                                                           const nmod_mat_t M);
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void nmod_mat_batch_randtest(nmod_mat_batch_t B,
+                                                         flint_rand_t state);
+
+/* Arithmetic ****************************************************************/
+
+FLINT_DLL void nmod_mat_batch_mul(nmod_mat_batch_t C,
+                         const nmod_mat_batch_t A, const nmod_mat_batch_t B);
+
+/* Determinant, solving and inverse ******************************************/
+
+FLINT_DLL void nmod_mat_batch_det(mp_ptr det, const nmod_mat_batch_t A);
+
+FLINT_DLL int nmod_mat_batch_solve(nmod_mat_batch_t X,
+                         const nmod_mat_batch_t A, const nmod_mat_batch_t B);
+
+FLINT_DLL int nmod_mat_batch_inv(nmod_mat_batch_t B,
+                                                    const nmod_mat_batch_t A);
+
+/* Internal ******************************************************************/
+
+/*
+    When n < 2^32, every product of two reduced entries fits in a limb and
+    sums of limbs can be reduced modulo n lane by lane with 32 x 32 -> 64
+    bit multiplications only, which vectorise. The constants are
+    c = 2^32 mod n and the Shoup quotients floor(c 2^32 / n) and
+    floor(2^32 / n).
+*/
+typedef struct
+{
+    mp_limb_t n;
+    mp_limb_t c;
+    mp_limb_t c_shoup;
+    mp_limb_t one_shoup;
+}
+nmod_mat_batch_red_struct;
+
+NMOD_MAT_BATCH_INLINE
+int _nmod_mat_batch_red_init(nmod_mat_batch_red_struct * R, nmod_t mod)
+{
+#if FLINT_BITS == 64
+    if (mod.n > 1 && mod.n <= UWORD(0xffffffff))
+    {
+        R->n = mod.n;
+        R->c = (UWORD(1) << 32) % mod.n;
+        R->c_shoup = (R->c << 32) / mod.n;
+        R->one_shoup = (UWORD(1) << 32) / mod.n;
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+/*
+    r = s mod n for any limb s, given the constants of
+    _nmod_mat_batch_red_init. This is a macro rather than an inline
+    function so that it is compiled for the target of the caller.
+*/
+#if FLINT_BITS == 64
+#define NMOD_MAT_BATCH_RED(r, s, n, c, c_shoup, one_shoup)                  \
+    do                                                                      \
+    {                                                                       \
+        mp_limb_t __h = (s) >> 32, __l = (s) & UWORD(0xffffffff);           \
+        mp_limb_t __x, __y, __q;                                            \
+        /* h c mod n and l mod n, both in [0, 2n) */                        \
+        __q = NMOD_VEC_HALF_MUL(__h, (c_shoup)) >> 32;                      \
+        __x = NMOD_VEC_HALF_MUL(__h, (c)) - NMOD_VEC_HALF_MUL(__q, (n));    \
+        __q = NMOD_VEC_HALF_MUL(__l, (one_shoup)) >> 32;                    \
+        __y = __l - NMOD_VEC_HALF_MUL(__q, (n));                            \
+        __x += __y;                                                         \
+        __x -= (__x >= 2*(n)) ? 2*(n) : 0;                                  \
+        __x -= (__x >= (n)) ? (n) : 0;                                      \
+        (r) = __x;                                                          \
+    } while (0)
+#else
+#define NMOD_MAT_BATCH_RED(r, s, n, c, c_shoup, one_shoup)                  \
+    do                                                                      \
+    {                                                                       \
+        (r) = (s) % (n);                                                    \
+    } while (0)
+#endif
+
+FLINT_DLL int _nmod_mat_batch_gauss(mp_ptr W, slong n, slong cols,
+                 slong lanes, int jordan, mp_ptr det, int * ok, nmod_t mod);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,177 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+/*
+    Division free determinants of sizes 2, 3 and 4 over a whole block of
+    matrices, for n < 2^32. The size 4 case is the Laplace expansion
+    along the 2 x 2 minors of the first two and the last two rows. The
+    results go through a local array so that the loops need no runtime
+    alias checks to be vectorised.
+*/
+
+#define E(i, j, N) A[((i)*(N) + (j))*NMOD_MAT_BATCH_BLOCK + t]
+
+#define MULMOD(r, x, y) \
+    NMOD_MAT_BATCH_RED(r, NMOD_VEC_HALF_MUL(x, y), p, c, cs, os)
+
+#define ADDMOD(r, x, y) \
+    do { (r) = (x) + (y); (r) -= ((r) >= p) ? p : 0; } while (0)
+
+#define SUBMOD(r, x, y) \
+    do { (r) = (x) - (y) + (((x) < (y)) ? p : 0); } while (0)
+
+/* r = x1 y1 - x2 y2 */
+#define MINOR(r, x1, y1, x2, y2) \
+    do { mp_limb_t __u, __v; \
+         MULMOD(__u, x1, y1); MULMOD(__v, x2, y2); SUBMOD(r, __u, __v); \
+    } while (0)
+
+FLINT_TARGET_CLONES
+static void
+_det_2(mp_ptr d, mp_srcptr A, const nmod_mat_batch_red_struct * R)
+{
+    mp_limb_t p = R->n, c = R->c, cs = R->c_shoup, os = R->one_shoup;
+    mp_limb_t r[NMOD_MAT_BATCH_BLOCK];
+    slong t;
+
+    for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+        MINOR(r[t], E(0, 0, 2), E(1, 1, 2), E(0, 1, 2), E(1, 0, 2));
+
+    for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+        d[t] = r[t];
+}
+
+FLINT_TARGET_CLONES
+static void
+_det_3(mp_ptr d, mp_srcptr A, const nmod_mat_batch_red_struct * R)
+{
+    mp_limb_t p = R->n, c = R->c, cs = R->c_shoup, os = R->one_shoup;
+    mp_limb_t m0, m1, m2, x, y;
+    mp_limb_t r[NMOD_MAT_BATCH_BLOCK];
+    slong t;
+
+    for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+    {
+        MINOR(m0, E(1, 1, 3), E(2, 2, 3), E(1, 2, 3), E(2, 1, 3));
+        MINOR(m1, E(1, 0, 3), E(2, 2, 3), E(1, 2, 3), E(2, 0, 3));
+        MINOR(m2, E(1, 0, 3), E(2, 1, 3), E(1, 1, 3), E(2, 0, 3));
+
+        MINOR(x, E(0, 0, 3), m0, E(0, 1, 3), m1);
+        MULMOD(y, E(0, 2, 3), m2);
+        ADDMOD(r[t], x, y);
+    }
+
+    for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+        d[t] = r[t];
+}
+
+FLINT_TARGET_CLONES
+static void
+_det_4(mp_ptr d, mp_srcptr A, const nmod_mat_batch_red_struct * R)
+{
+    mp_limb_t p = R->n, c = R->c, cs = R->c_shoup, os = R->one_shoup;
+    mp_limb_t s01, s02, s03, s12, s13, s23, c01, c02, c03, c12, c13, c23;
+    mp_limb_t x, y, z;
+    mp_limb_t r[NMOD_MAT_BATCH_BLOCK];
+    slong t;
+
+    for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+    {
+        MINOR(s01, E(0, 0, 4), E(1, 1, 4), E(0, 1, 4), E(1, 0, 4));
+        MINOR(s02, E(0, 0, 4), E(1, 2, 4), E(0, 2, 4), E(1, 0, 4));
+        MINOR(s03, E(0, 0, 4), E(1, 3, 4), E(0, 3, 4), E(1, 0, 4));
+        MINOR(s12, E(0, 1, 4), E(1, 2, 4), E(0, 2, 4), E(1, 1, 4));
+        MINOR(s13, E(0, 1, 4), E(1, 3, 4), E(0, 3, 4), E(1, 1, 4));
+        MINOR(s23, E(0, 2, 4), E(1, 3, 4), E(0, 3, 4), E(1, 2, 4));
+
+        MINOR(c01, E(2, 0, 4), E(3, 1, 4), E(2, 1, 4), E(3, 0, 4));
+        MINOR(c02, E(2, 0, 4), E(3, 2, 4), E(2, 2, 4), E(3, 0, 4));
+        MINOR(c03, E(2, 0, 4), E(3, 3, 4), E(2, 3, 4), E(3, 0, 4));
+        MINOR(c12, E(2, 1, 4), E(3, 2, 4), E(2, 2, 4), E(3, 1, 4));
+        MINOR(c13, E(2, 1, 4), E(3, 3, 4), E(2, 3, 4), E(3, 1, 4));
+        MINOR(c23, E(2, 2, 4), E(3, 3, 4), E(2, 3, 4), E(3, 2, 4));
+
+        /* s01 c23 - s02 c13 + s03 c12 + s12 c03 - s13 c02 + s23 c01 */
+        MINOR(x, s01, c23, s02, c13);
+        MINOR(y, s03, c12, s13, c02);
+        ADDMOD(x, x, y);
+        MULMOD(y, s12, c03);
+        MULMOD(z, s23, c01);
+        ADDMOD(y, y, z);
+        ADDMOD(r[t], x, y);
+    }
+
+    for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+        d[t] = r[t];
+}
+
+void
+nmod_mat_batch_det(mp_ptr det, const nmod_mat_batch_t A)
+{
+    slong n = A->r, b, t, lanes;
+    int ok[NMOD_MAT_BATCH_BLOCK];
+    mp_limb_t d[NMOD_MAT_BATCH_BLOCK];
+    nmod_mat_batch_red_struct R[1];
+    int small;
+    mp_ptr W;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_mat_batch_det). Non-square matrix.\n");
+        flint_abort();
+    }
+
+    small = _nmod_mat_batch_red_init(R, A->mod);
+
+    if (n > NMOD_MAT_BATCH_GAUSS_CUTOFF || (!small && n <= 4))
+    {
+        nmod_mat_t M;
+
+        nmod_mat_init(M, n, n, A->mod.n);
+        for (t = 0; t < A->num; t++)
+        {
+            nmod_mat_batch_get_nmod_mat(M, A, t);
+            det[t] = nmod_mat_det(M);
+        }
+        nmod_mat_clear(M);
+
+        return;
+    }
+
+    W = _nmod_vec_init(n*n*NMOD_MAT_BATCH_BLOCK);
+
+    for (b = 0; b < _nmod_mat_batch_num_blocks(A); b++)
+    {
+        mp_srcptr Ab = _nmod_mat_batch_block(A, b);
+
+        t = b*NMOD_MAT_BATCH_BLOCK;
+        lanes = FLINT_MIN(NMOD_MAT_BATCH_BLOCK, A->num - t);
+
+        if (small && n >= 2 && n <= 4)
+        {
+            if (n == 2)
+                _det_2(d, Ab, R);
+            else if (n == 3)
+                _det_3(d, Ab, R);
+            else
+                _det_4(d, Ab, R);
+
+            _nmod_vec_set(det + t, d, lanes);
+        }
+        else
+        {
+            _nmod_vec_set(W, Ab, n*n*NMOD_MAT_BATCH_BLOCK);
+            _nmod_mat_batch_gauss(W, n, n, lanes, 0, det + t, ok, A->mod);
+        }
+    }
+
+    _nmod_vec_clear(W);
+}
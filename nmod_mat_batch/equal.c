@@ -0,0 +1,21 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+int
+nmod_mat_batch_equal(const nmod_mat_batch_t A, const nmod_mat_batch_t B)
+{
+    if (A->num != B->num || A->r != B->r || A->c != B->c)
+        return 0;
+
+    /* the padding is always zero */
+    return _nmod_vec_equal(A->entries, B->entries,
+           _nmod_mat_batch_num_blocks(A)*A->r*A->c*NMOD_MAT_BATCH_BLOCK);
+}
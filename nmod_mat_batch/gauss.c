@@ -0,0 +1,205 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+#define W_ENTRY(i, c) (W + ((i)*cols + (c))*NMOD_MAT_BATCH_BLOCK)
+
+/*
+    The row operations act on all the lanes of a block, the factors being
+    zero in the unused lanes. The results go through a local array so
+    that all loads of a row precede its stores, which lets the compiler
+    vectorise the loops without runtime alias checks.
+*/
+
+/* w[c][t] = w[c][t] f[t] for c < len, with n < 2^32 */
+FLINT_TARGET_CLONES
+static void
+_row_scale(mp_ptr w, mp_srcptr f, slong len,
+                                        const nmod_mat_batch_red_struct * R)
+{
+    mp_limb_t p = R->n, c = R->c, cs = R->c_shoup, os = R->one_shoup;
+    mp_limb_t x[NMOD_MAT_BATCH_BLOCK];
+    slong i, t;
+
+    for (i = 0; i < len; i++)
+    {
+        for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+            NMOD_MAT_BATCH_RED(x[t], NMOD_VEC_HALF_MUL(w[t], f[t]),
+                                                             p, c, cs, os);
+
+        for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+            w[t] = x[t];
+
+        w += NMOD_MAT_BATCH_BLOCK;
+    }
+}
+
+/* w[c][t] = w[c][t] + f[t] v[c][t] for c < len, with n < 2^32 */
+FLINT_TARGET_CLONES
+static void
+_row_addmul(mp_ptr w, mp_srcptr v, mp_srcptr f, slong len,
+                                        const nmod_mat_batch_red_struct * R)
+{
+    mp_limb_t p = R->n, c = R->c, cs = R->c_shoup, os = R->one_shoup;
+    mp_limb_t x[NMOD_MAT_BATCH_BLOCK];
+    slong i, t;
+
+    for (i = 0; i < len; i++)
+    {
+        for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+            NMOD_MAT_BATCH_RED(x[t], w[t] + NMOD_VEC_HALF_MUL(f[t], v[t]),
+                                                             p, c, cs, os);
+
+        for (t = 0; t < NMOD_MAT_BATCH_BLOCK; t++)
+            w[t] = x[t];
+
+        w += NMOD_MAT_BATCH_BLOCK;
+        v += NMOD_MAT_BATCH_BLOCK;
+    }
+}
+
+/*
+    Gaussian elimination with partial pivoting on lanes [0, lanes) of the
+    n x cols matrices in W, where entry (i, c) of lane t is
+    W[(i*cols + c)*NMOD_MAT_BATCH_BLOCK + t]. The other lanes of W must
+    be zero, and stay zero. The pivot search and the
+    row swaps differ between lanes and are done lane by lane, the pivots
+    of all lanes are inverted together with Montgomery's trick, and the
+    row operations, which carry the work, run across the lanes.
+
+    The pivot rows are scaled to make the pivots 1. If jordan is set,
+    the first n columns are reduced to the identity, so that the last
+    cols - n columns become A^(-1) B for W = [A | B]. Otherwise only the
+    rows below each pivot are cleared. If det is not
+    NULL, it is set to the determinants of the first n columns. The
+    lanes whose first n columns are singular have ok[t] = 0 and their
+    output is undefined. Returns 1 if all lanes are nonsingular. The
+    modulus must be prime.
+*/
+int
+_nmod_mat_batch_gauss(mp_ptr W, slong n, slong cols, slong lanes,
+                               int jordan, mp_ptr det, int * ok, nmod_t mod)
+{
+    mp_limb_t d[NMOD_MAT_BATCH_BLOCK], piv[NMOD_MAT_BATCH_BLOCK];
+    mp_limb_t inv[NMOD_MAT_BATCH_BLOCK], f[NMOD_MAT_BATCH_BLOCK];
+    mp_limb_t x, y;
+    nmod_mat_batch_red_struct R[1];
+    slong i, j, r, c, t;
+    int small, all_ok = 1;
+
+    small = _nmod_mat_batch_red_init(R, mod);
+
+    for (t = 0; t < lanes; t++)
+    {
+        d[t] = (mod.n != 1);
+        ok[t] = 1;
+    }
+
+    for (t = lanes; t < NMOD_MAT_BATCH_BLOCK; t++)
+        inv[t] = f[t] = 0;
+
+    /* every matrix over the zero ring is zero and invertible */
+    if (mod.n == 1)
+        n = 0;
+
+    for (j = 0; j < n; j++)
+    {
+        /* pivoting, lane by lane */
+        for (t = 0; t < lanes; t++)
+        {
+            piv[t] = 1;
+
+            if (!ok[t])
+                continue;
+
+            for (r = j; r < n && W_ENTRY(r, j)[t] == 0; r++) ;
+
+            if (r == n)
+            {
+                ok[t] = 0;
+                d[t] = 0;
+                all_ok = 0;
+                continue;
+            }
+
+            if (r != j)
+            {
+                for (c = j; c < cols; c++)
+                {
+                    x = W_ENTRY(r, c)[t];
+                    W_ENTRY(r, c)[t] = W_ENTRY(j, c)[t];
+                    W_ENTRY(j, c)[t] = x;
+                }
+
+                d[t] = nmod_neg(d[t], mod);
+            }
+
+            piv[t] = W_ENTRY(j, j)[t];
+            d[t] = nmod_mul(d[t], piv[t], mod);
+        }
+
+        /* inv[t] = 1/piv[t] with a single inversion */
+        inv[0] = piv[0];
+        for (t = 1; t < lanes; t++)
+            inv[t] = nmod_mul(inv[t - 1], piv[t], mod);
+
+        x = n_invmod(inv[lanes - 1], mod.n);
+
+        for (t = lanes - 1; t > 0; t--)
+        {
+            y = nmod_mul(x, inv[t - 1], mod);
+            x = nmod_mul(x, piv[t], mod);
+            inv[t] = y;
+        }
+
+        inv[0] = x;
+
+        /* scale the pivot row */
+        if (small)
+        {
+            _row_scale(W_ENTRY(j, j), inv, cols - j, R);
+        }
+        else
+        {
+            for (c = j; c < cols; c++)
+                for (t = 0; t < lanes; t++)
+                    W_ENTRY(j, c)[t] = nmod_mul(W_ENTRY(j, c)[t],
+                                                            inv[t], mod);
+        }
+
+        for (i = jordan ? 0 : j + 1; i < n; i++)
+        {
+            if (i == j)
+                continue;
+
+            /* row i += f row j, where f makes entry (i, j) zero */
+            for (t = 0; t < lanes; t++)
+                f[t] = nmod_neg(W_ENTRY(i, j)[t], mod);
+
+            if (small)
+            {
+                _row_addmul(W_ENTRY(i, j), W_ENTRY(j, j), f, cols - j, R);
+            }
+            else
+            {
+                for (c = j; c < cols; c++)
+                    for (t = 0; t < lanes; t++)
+                        W_ENTRY(i, c)[t] = nmod_addmul(W_ENTRY(i, c)[t],
+                                            f[t], W_ENTRY(j, c)[t], mod);
+            }
+        }
+    }
+
+    if (det != NULL)
+        for (t = 0; t < lanes; t++)
+            det[t] = d[t];
+
+    return all_ok;
+}
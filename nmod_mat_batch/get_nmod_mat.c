@@ -0,0 +1,20 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+void
+nmod_mat_batch_get_nmod_mat(nmod_mat_t M, const nmod_mat_batch_t B, slong t)
+{
+    slong i, j;
+
+    for (i = 0; i < B->r; i++)
+        for (j = 0; j < B->c; j++)
+            nmod_mat_entry(M, i, j) = nmod_mat_batch_entry(B, t, i, j);
+}
@@ -0,0 +1,34 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+void
+nmod_mat_batch_init(nmod_mat_batch_t B, slong num, slong rows, slong cols,
+                                                                 mp_limb_t n)
+{
+    slong blocks = (num + NMOD_MAT_BATCH_BLOCK - 1) / NMOD_MAT_BATCH_BLOCK;
+
+    if (num != 0 && rows != 0 && cols != 0)
+        B->entries = (mp_ptr) flint_calloc(blocks*rows*cols*
+                                  NMOD_MAT_BATCH_BLOCK, sizeof(mp_limb_t));
+    else
+        B->entries = NULL;
+
+    B->num = num;
+    B->r = rows;
+    B->c = cols;
+    nmod_init(&(B->mod), n);
+}
+
+void
+nmod_mat_batch_clear(nmod_mat_batch_t B)
+{
+    flint_free(B->entries);
+}
@@ -0,0 +1,31 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+int
+nmod_mat_batch_inv(nmod_mat_batch_t B, const nmod_mat_batch_t A)
+{
+    nmod_mat_batch_t I;
+    int result;
+
+    if (A->r != A->c || B->r != A->r || B->c != A->c || B->num != A->num)
+    {
+        flint_printf("Exception (nmod_mat_batch_inv). "
+                     "Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    nmod_mat_batch_init(I, A->num, A->r, A->r, A->mod.n);
+    nmod_mat_batch_one(I);
+    result = nmod_mat_batch_solve(B, A, I);
+    nmod_mat_batch_clear(I);
+
+    return result;
+}
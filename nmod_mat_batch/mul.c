@@ -0,0 +1,173 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+/* lanes handled together by the multiplication kernels */
+#define MUL_LANES 8
+
+/*
+    C = A B on MUL_LANES consecutive lanes of a block of matrices stored as
+    in nmod_mat_batch_t, starting at A, B and C, for n < 2^32. Sums of
+    products are reduced every KB terms, with n + KB (n - 1)^2 < 2^64.
+    The loops over the lanes have a constant length, so that the sums
+    stay in vector registers. The kernels for fixed sizes also fix the
+    dimensions and KB = K, so that the loops over the entries are
+    unrolled as well. The body is a macro so that every target clone
+    gets its own copy.
+*/
+#define MUL_KERNEL_BODY(M, K, N, KB)                                        \
+    mp_limb_t s[MUL_LANES];                                                 \
+    mp_limb_t p = R->n, c = R->c, cs = R->c_shoup, os = R->one_shoup;       \
+    slong i, j, l, l0, t;                                                   \
+                                                                            \
+    for (i = 0; i < (M); i++)                                               \
+    {                                                                       \
+        for (j = 0; j < (N); j++)                                           \
+        {                                                                   \
+            mp_ptr r = C + (i*(N) + j)*NMOD_MAT_BATCH_BLOCK;                \
+                                                                            \
+            for (t = 0; t < MUL_LANES; t++)                                 \
+                s[t] = 0;                                                   \
+                                                                            \
+            for (l0 = 0; l0 < (K); l0 += (KB))                              \
+            {                                                               \
+                if (l0 != 0)                                                \
+                    for (t = 0; t < MUL_LANES; t++)                         \
+                        NMOD_MAT_BATCH_RED(s[t], s[t], p, c, cs, os);       \
+                                                                            \
+                for (l = l0; l < FLINT_MIN((K), l0 + (KB)); l++)            \
+                {                                                           \
+                    mp_srcptr a = A + (i*(K) + l)*NMOD_MAT_BATCH_BLOCK;     \
+                    mp_srcptr b = B + (l*(N) + j)*NMOD_MAT_BATCH_BLOCK;     \
+                                                                            \
+                    for (t = 0; t < MUL_LANES; t++)                         \
+                        s[t] += NMOD_VEC_HALF_MUL(a[t], b[t]);              \
+                }                                                           \
+            }                                                               \
+                                                                            \
+            for (t = 0; t < MUL_LANES; t++)                                 \
+                NMOD_MAT_BATCH_RED(r[t], s[t], p, c, cs, os);               \
+        }                                                                   \
+    }
+
+#define MUL_KERNEL(name, M, K, N)                                           \
+FLINT_TARGET_CLONES                                                         \
+static void name(mp_ptr C, mp_srcptr A, mp_srcptr B,                        \
+                                      const nmod_mat_batch_red_struct * R)  \
+{                                                                           \
+    MUL_KERNEL_BODY(M, K, N, K)                                             \
+}
+
+MUL_KERNEL(_mul_kernel_2, 2, 2, 2)
+MUL_KERNEL(_mul_kernel_3, 3, 3, 3)
+MUL_KERNEL(_mul_kernel_4, 4, 4, 4)
+MUL_KERNEL(_mul_kernel_8, 8, 8, 8)
+
+FLINT_TARGET_CLONES
+static void
+_mul_kernel_any(mp_ptr C, mp_srcptr A, mp_srcptr B, slong m, slong k,
+                 slong n, slong kb, const nmod_mat_batch_red_struct * R)
+{
+    MUL_KERNEL_BODY(m, k, n, kb)
+}
+
+static void
+_nmod_mat_batch_mul(nmod_mat_batch_t C, const nmod_mat_batch_t A,
+                                                    const nmod_mat_batch_t B)
+{
+    slong m = A->r, k = A->c, n = B->c;
+    slong blocks = _nmod_mat_batch_num_blocks(A);
+    slong i, j, l, t, b, u;
+    nmod_mat_batch_red_struct R[1];
+
+    if (_nmod_mat_batch_red_init(R, A->mod))
+    {
+        mp_limb_t p = A->mod.n, kb;
+        int square;
+
+        /* number of products which can be added to a reduced sum */
+        kb = (~UWORD(0) - p) / ((p - 1)*(p - 1));
+        kb = FLINT_MIN(kb, (mp_limb_t) k);
+
+        square = (kb == k && m == k && k == n);
+
+        for (b = 0; b < blocks; b++)
+        {
+            for (u = 0; u < NMOD_MAT_BATCH_BLOCK; u += MUL_LANES)
+            {
+                mp_ptr Cb = _nmod_mat_batch_block(C, b) + u;
+                mp_srcptr Ab = _nmod_mat_batch_block(A, b) + u;
+                mp_srcptr Bb = _nmod_mat_batch_block(B, b) + u;
+
+                if (square && n == 2)
+                    _mul_kernel_2(Cb, Ab, Bb, R);
+                else if (square && n == 3)
+                    _mul_kernel_3(Cb, Ab, Bb, R);
+                else if (square && n == 4)
+                    _mul_kernel_4(Cb, Ab, Bb, R);
+                else if (square && n == 8)
+                    _mul_kernel_8(Cb, Ab, Bb, R);
+                else
+                    _mul_kernel_any(Cb, Ab, Bb, m, k, n, kb, R);
+            }
+        }
+    }
+    else
+    {
+        int nlimbs = _nmod_vec_dot_bound_limbs(k, A->mod);
+        mp_limb_t s;
+
+        for (t = 0; t < A->num; t++)
+        {
+            for (i = 0; i < m; i++)
+            {
+                for (j = 0; j < n; j++)
+                {
+                    NMOD_VEC_DOT(s, l, k, nmod_mat_batch_entry(A, t, i, l),
+                             nmod_mat_batch_entry(B, t, l, j), A->mod, nlimbs);
+                    nmod_mat_batch_entry(C, t, i, j) = s;
+                }
+            }
+        }
+    }
+}
+
+void
+nmod_mat_batch_mul(nmod_mat_batch_t C, const nmod_mat_batch_t A,
+                                                    const nmod_mat_batch_t B)
+{
+    if (A->num != B->num || C->num != A->num ||
+        A->c != B->r || C->r != A->r || C->c != B->c)
+    {
+        flint_printf("Exception (nmod_mat_batch_mul). "
+                     "Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (A->c == 0 || A->mod.n == 1)
+    {
+        nmod_mat_batch_zero(C);
+        return;
+    }
+
+    if (C == A || C == B)
+    {
+        nmod_mat_batch_t T;
+
+        nmod_mat_batch_init(T, C->num, C->r, C->c, C->mod.n);
+        _nmod_mat_batch_mul(T, A, B);
+        nmod_mat_batch_swap(C, T);
+        nmod_mat_batch_clear(T);
+    }
+    else
+    {
+        _nmod_mat_batch_mul(C, A, B);
+    }
+}
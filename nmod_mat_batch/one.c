@@ -0,0 +1,25 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+void
+nmod_mat_batch_one(nmod_mat_batch_t B)
+{
+    slong i, t;
+
+    nmod_mat_batch_zero(B);
+
+    if (B->mod.n == 1)
+        return;
+
+    for (i = 0; i < FLINT_MIN(B->r, B->c); i++)
+        for (t = 0; t < B->num; t++)
+            nmod_mat_batch_entry(B, t, i, i) = 1;
+}
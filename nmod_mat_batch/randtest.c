@@ -0,0 +1,27 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+void
+nmod_mat_batch_randtest(nmod_mat_batch_t B, flint_rand_t state)
+{
+    nmod_mat_t M;
+    slong t;
+
+    nmod_mat_init(M, B->r, B->c, B->mod.n);
+
+    for (t = 0; t < B->num; t++)
+    {
+        nmod_mat_randtest(M, state);
+        nmod_mat_batch_set_nmod_mat(B, t, M);
+    }
+
+    nmod_mat_clear(M);
+}
@@ -0,0 +1,93 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+int
+nmod_mat_batch_solve(nmod_mat_batch_t X, const nmod_mat_batch_t A,
+                                                    const nmod_mat_batch_t B)
+{
+    slong n = A->r, m = B->c, num = A->num, cols = n + m;
+    slong i, b, lanes;
+    int ok[NMOD_MAT_BATCH_BLOCK], result = 1;
+    mp_ptr W;
+
+    if (A->r != A->c || B->r != n || X->r != n || X->c != m ||
+        B->num != num || X->num != num)
+    {
+        flint_printf("Exception (nmod_mat_batch_solve). "
+                     "Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    if (n > NMOD_MAT_BATCH_GAUSS_CUTOFF)
+    {
+        nmod_mat_t M, R, Y;
+
+        nmod_mat_init(M, n, n, A->mod.n);
+        nmod_mat_init(R, n, m, A->mod.n);
+        nmod_mat_init(Y, n, m, A->mod.n);
+
+        for (b = 0; b < num; b++)
+        {
+            nmod_mat_batch_get_nmod_mat(M, A, b);
+            nmod_mat_batch_get_nmod_mat(R, B, b);
+
+            /* nmod_mat_solve does not look at A when B is empty */
+            if (m == 0)
+                result &= (nmod_mat_det(M) != 0);
+            else
+                result &= nmod_mat_solve(Y, M, R);
+
+            nmod_mat_batch_set_nmod_mat(X, b, Y);
+        }
+
+        nmod_mat_clear(M);
+        nmod_mat_clear(R);
+        nmod_mat_clear(Y);
+
+        return result;
+    }
+
+    W = _nmod_vec_init(n*cols*NMOD_MAT_BATCH_BLOCK);
+
+    for (b = 0; b < _nmod_mat_batch_num_blocks(A); b++)
+    {
+        mp_srcptr Ab = _nmod_mat_batch_block(A, b);
+        mp_srcptr Bb = _nmod_mat_batch_block(B, b);
+        mp_ptr Xb = _nmod_mat_batch_block(X, b);
+
+        lanes = FLINT_MIN(NMOD_MAT_BATCH_BLOCK,
+                                        num - b*NMOD_MAT_BATCH_BLOCK);
+
+        /* W = [A | B], read before X is written in case of aliasing */
+        for (i = 0; i < n; i++)
+        {
+            _nmod_vec_set(W + i*cols*NMOD_MAT_BATCH_BLOCK,
+                          Ab + i*n*NMOD_MAT_BATCH_BLOCK,
+                          n*NMOD_MAT_BATCH_BLOCK);
+            _nmod_vec_set(W + (i*cols + n)*NMOD_MAT_BATCH_BLOCK,
+                          Bb + i*m*NMOD_MAT_BATCH_BLOCK,
+                          m*NMOD_MAT_BATCH_BLOCK);
+        }
+
+        result &= _nmod_mat_batch_gauss(W, n, cols, lanes, 1,
+                                                          NULL, ok, A->mod);
+
+        /* the padding lanes of W are untouched, hence zero */
+        for (i = 0; i < n; i++)
+            _nmod_vec_set(Xb + i*m*NMOD_MAT_BATCH_BLOCK,
+                          W + (i*cols + n)*NMOD_MAT_BATCH_BLOCK,
+                          m*NMOD_MAT_BATCH_BLOCK);
+    }
+
+    _nmod_vec_clear(W);
+
+    return result;
+}
@@ -0,0 +1,68 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_mat_batch.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong rep;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("det....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 1000 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_batch_t A;
+        nmod_mat_t a;
+        mp_ptr det;
+        slong num, n, t;
+        mp_limb_t mod;
+
+        num = n_randint(state, 100);
+        n = n_randint(state, (rep % 8 == 0) ? 32 : 10);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_mat_batch_init(A, num, n, n, mod);
+        nmod_mat_init(a, n, n, mod);
+        det = _nmod_vec_init(num);
+
+        nmod_mat_batch_randtest(A, state);
+
+        nmod_mat_batch_det(det, A);
+
+        for (t = 0; t < num; t++)
+        {
+            nmod_mat_batch_get_nmod_mat(a, A, t);
+
+            if (det[t] != nmod_mat_det(a))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("num = %wd, n = %wd, mod = %wu, t = %wd\n",
+                                                            num, n, mod, t);
+                nmod_mat_print_pretty(a);
+                flint_printf("det = %wu, expected %wu\n", det[t], nmod_mat_det(a));
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_mat_batch_clear(A);
+        nmod_mat_clear(a);
+        _nmod_vec_clear(det);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_mat_batch.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong rep;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("inv....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 1000 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_batch_t A, B, C;
+        nmod_mat_t a, b;
+        slong num, n, t;
+        mp_limb_t mod;
+        int result, expected;
+
+        num = n_randint(state, 100);
+        n = n_randint(state, (rep % 8 == 0) ? 32 : 10);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_mat_batch_init(A, num, n, n, mod);
+        nmod_mat_batch_init(B, num, n, n, mod);
+        nmod_mat_batch_init(C, num, n, n, mod);
+        nmod_mat_init(a, n, n, mod);
+        nmod_mat_init(b, n, n, mod);
+
+        nmod_mat_batch_randtest(A, state);
+
+        result = nmod_mat_batch_inv(B, A);
+
+        expected = 1;
+        for (t = 0; t < num; t++)
+        {
+            nmod_mat_batch_get_nmod_mat(a, A, t);
+            expected &= nmod_mat_inv(a, a);
+
+            if (result)
+            {
+                nmod_mat_batch_get_nmod_mat(b, B, t);
+
+                if (!nmod_mat_equal(a, b))
+                {
+                    flint_printf("FAIL (wrong inverse):\n");
+                    flint_printf("num = %wd, n = %wd, mod = %wu, t = %wd\n",
+                                                            num, n, mod, t);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        if (result != expected)
+        {
+            flint_printf("FAIL (singularity):\n");
+            flint_printf("num = %wd, n = %wd, mod = %wu\n", num, n, mod);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* aliasing */
+        if (result)
+        {
+            nmod_mat_batch_set(C, A);
+            nmod_mat_batch_inv(C, C);
+
+            if (!nmod_mat_batch_equal(B, C))
+            {
+                flint_printf("FAIL (aliasing):\n");
+                flint_printf("num = %wd, n = %wd, mod = %wu\n", num, n, mod);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_mat_batch_clear(A);
+        nmod_mat_batch_clear(B);
+        nmod_mat_batch_clear(C);
+        nmod_mat_clear(a);
+        nmod_mat_clear(b);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_mat_batch.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong rep;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 1000 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_batch_t A, B, C;
+        nmod_mat_t a, b, c, d;
+        slong num, m, k, n, t;
+        mp_limb_t mod;
+
+        num = n_randint(state, 100);
+
+        if (n_randint(state, 2))
+        {
+            m = k = n = 2 + n_randint(state, 7);
+        }
+        else
+        {
+            m = n_randint(state, 12);
+            k = n_randint(state, 12);
+            n = n_randint(state, 12);
+        }
+
+        mod = n_randtest_not_zero(state);
+
+        nmod_mat_batch_init(A, num, m, k, mod);
+        nmod_mat_batch_init(B, num, k, n, mod);
+        nmod_mat_batch_init(C, num, m, n, mod);
+        nmod_mat_init(a, m, k, mod);
+        nmod_mat_init(b, k, n, mod);
+        nmod_mat_init(c, m, n, mod);
+        nmod_mat_init(d, m, n, mod);
+
+        nmod_mat_batch_randtest(A, state);
+        nmod_mat_batch_randtest(B, state);
+        nmod_mat_batch_randtest(C, state);
+
+        nmod_mat_batch_mul(C, A, B);
+
+        for (t = 0; t < num; t++)
+        {
+            nmod_mat_batch_get_nmod_mat(a, A, t);
+            nmod_mat_batch_get_nmod_mat(b, B, t);
+            nmod_mat_batch_get_nmod_mat(c, C, t);
+            nmod_mat_mul_classical(d, a, b);
+
+            if (!nmod_mat_equal(c, d))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("num = %wd, m = %wd, k = %wd, n = %wd, "
+                             "mod = %wu, t = %wd\n", num, m, k, n, mod, t);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        /* aliasing */
+        if (m == k && k == n)
+        {
+            nmod_mat_batch_t D;
+
+            nmod_mat_batch_init(D, num, m, n, mod);
+            nmod_mat_batch_set(D, A);
+            nmod_mat_batch_mul(D, D, B);
+
+            if (!nmod_mat_batch_equal(C, D))
+            {
+                flint_printf("FAIL (aliasing):\n");
+                flint_printf("num = %wd, n = %wd, mod = %wu\n", num, n, mod);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            nmod_mat_batch_clear(D);
+        }
+
+        nmod_mat_batch_clear(A);
+        nmod_mat_batch_clear(B);
+        nmod_mat_batch_clear(C);
+        nmod_mat_clear(a);
+        nmod_mat_clear(b);
+        nmod_mat_clear(c);
+        nmod_mat_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_mat_batch.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong rep;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 1000 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_batch_t A, B, X, AX;
+        mp_ptr det;
+        slong num, n, m, t;
+        mp_limb_t mod;
+        int result, expected;
+
+        num = n_randint(state, 100);
+        n = n_randint(state, (rep % 8 == 0) ? 32 : 10);
+        m = n_randint(state, 10);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_mat_batch_init(A, num, n, n, mod);
+        nmod_mat_batch_init(B, num, n, m, mod);
+        nmod_mat_batch_init(X, num, n, m, mod);
+        nmod_mat_batch_init(AX, num, n, m, mod);
+        det = _nmod_vec_init(num);
+
+        nmod_mat_batch_randtest(A, state);
+        nmod_mat_batch_randtest(B, state);
+
+        nmod_mat_batch_det(det, A);
+        expected = 1;
+        for (t = 0; t < num; t++)
+            expected &= (det[t] != 0);
+
+        if (n_randint(state, 2))
+        {
+            result = nmod_mat_batch_solve(X, A, B);
+        }
+        else
+        {
+            nmod_mat_batch_set(X, B);
+            result = nmod_mat_batch_solve(X, A, X);
+        }
+
+        if (result != expected)
+        {
+            flint_printf("FAIL (singularity):\n");
+            flint_printf("num = %wd, n = %wd, m = %wd, mod = %wu\n",
+                                                            num, n, m, mod);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (result)
+        {
+            nmod_mat_batch_mul(AX, A, X);
+
+            if (!nmod_mat_batch_equal(AX, B))
+            {
+                flint_printf("FAIL (AX != B):\n");
+                flint_printf("num = %wd, n = %wd, m = %wd, mod = %wu\n",
+                                                            num, n, m, mod);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_mat_batch_clear(A);
+        nmod_mat_batch_clear(B);
+        nmod_mat_batch_clear(X);
+        nmod_mat_batch_clear(AX);
+        _nmod_vec_clear(det);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
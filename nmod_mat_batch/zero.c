@@ -0,0 +1,17 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mat_batch.h"
+
+void
+nmod_mat_batch_zero(nmod_mat_batch_t B)
+{
+    _nmod_vec_zero(B->entries, _nmod_mat_batch_num_blocks(B)*B->r*B->c*
+                                                 NMOD_MAT_BATCH_BLOCK);
+}
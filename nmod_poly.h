@@ -34,6 +34,7 @@
 #include "nmod_mat.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "mpn_extras.h"
 #include "thread_support.h"
 
 #ifdef __cplusplus
@@ -44,6 +45,7 @@
 #define NMOD_DIV_DIVCONQUER_CUTOFF     300 /* Must be <= NMOD_DIVREM_DIVCONQUER_CUTOFF */
 
 #define NMOD_POLY_HGCD_CUTOFF  100      /* HGCD: Basecase -> Recursion      */
+#define NMOD_POLY_HGCD_THREAD_CUTOFF 1000 /* HGCD: threaded products        */
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
@@ -594,6 +596,33 @@ FLINT_DLL void _nmod_poly_mullow(mp_ptr res, mp_srcptr poly1, slong len1,
 FLINT_DLL void nmod_poly_mullow(nmod_poly_t res, const nmod_poly_t poly1, 
                                           const nmod_poly_t poly2, slong trunc);
 
+/* Truncated multiplication by a fixed polynomial  ***************************/
+
+/* transforms are cached when the packed operands have between these
+   numbers of limbs, outside this range they do not pay for themselves */
+#define NMOD_POLY_MUL_PRECACHE_CUTOFF 6000
+#define NMOD_POLY_MUL_PRECACHE_LIMIT 32000
+
+typedef struct
+{
+    mp_srcptr poly;
+    slong len;
+    slong maxlen;          /* maximum length of the other operand */
+    nmod_t mod;
+    flint_bitcnt_t bits;   /* Kronecker substitution bits, 0 if no cache */
+    flint_mpn_mul_precache_t pre;
+} nmod_poly_mul_precache_struct;
+
+typedef nmod_poly_mul_precache_struct nmod_poly_mul_precache_t[1];
+
+FLINT_DLL void _nmod_poly_mul_precache_init(nmod_poly_mul_precache_t P,
+                      mp_srcptr poly, slong len, slong maxlen, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_mul_precache_clear(nmod_poly_mul_precache_t P);
+
+FLINT_DLL void _nmod_poly_mullow_precache(mp_ptr res, mp_srcptr poly,
+                         slong len, slong n, const nmod_poly_mul_precache_t P);
+
 FLINT_DLL void _nmod_poly_mulhigh(mp_ptr res, mp_srcptr poly1, slong len1, 
                                mp_srcptr poly2, slong len2, slong n, nmod_t mod);
 
@@ -702,6 +731,38 @@ FLINT_DLL void _nmod_poly_powmod_x_fmpz_preinv (mp_ptr res, fmpz_t e, mp_srcptr
 
 FLINT_DLL void nmod_poly_powmod_x_fmpz_preinv(nmod_poly_t res, fmpz_t e, const nmod_poly_t f,                             const nmod_poly_t finv);
 
+/* Powering modulo a fixed polynomial  **************************************/
+
+#define NMOD_POLY_POWMOD_PRECOMP_CUTOFF 4000 /* limbs of packed f from which
+                                                transforms are cached */
+
+typedef struct
+{
+    nmod_poly_t f;
+    nmod_poly_t finv;
+    flint_bitcnt_t bits;   /* Kronecker substitution bits, 0 if no cache */
+    flint_mpn_mul_precache_t fpre;
+    flint_mpn_mul_precache_t finvpre;
+    slong transforms_saved;
+} nmod_poly_powmod_precomp_struct;
+
+typedef nmod_poly_powmod_precomp_struct nmod_poly_powmod_precomp_t[1];
+
+FLINT_DLL void _nmod_poly_powmod_precomp_init(nmod_poly_powmod_precomp_t P,
+                               mp_srcptr f, slong lenf, mp_srcptr finv,
+                                                 slong lenfinv, nmod_t mod);
+
+FLINT_DLL void nmod_poly_powmod_precomp_init(nmod_poly_powmod_precomp_t P,
+                                const nmod_poly_t f, const nmod_poly_t finv);
+
+FLINT_DLL void nmod_poly_powmod_precomp_clear(nmod_poly_powmod_precomp_t P);
+
+FLINT_DLL void _nmod_poly_powmod_x_fmpz_precomp(mp_ptr res, const fmpz_t e,
+                                               nmod_poly_powmod_precomp_t P);
+
+FLINT_DLL void nmod_poly_powmod_x_fmpz_precomp(nmod_poly_t res,
+                              const fmpz_t e, nmod_poly_powmod_precomp_t P);
+
 FLINT_DLL void _nmod_poly_powers_mod_preinv_naive(mp_ptr * res, mp_srcptr f,
 		 slong flen, slong n, mp_srcptr g, slong glen, mp_srcptr ginv,
 		                              slong ginvlen, const nmod_t mod);
@@ -943,6 +1004,9 @@ void nmod_poly_evaluate_mat(nmod_mat_t dest,
 
 /* Subproduct tree  **********************************************************/
 
+/* minimum number of points per thread when working on a subproduct tree */
+#define NMOD_POLY_TREE_THREAD_CUTOFF 512
+
 FLINT_DLL mp_ptr * _nmod_poly_tree_alloc(slong len);
 
 FLINT_DLL void _nmod_poly_tree_free(mp_ptr * tree, slong len);
@@ -982,6 +1046,99 @@ FLINT_DLL void _nmod_poly_interpolate_nmod_vec_fast_precomp(mp_ptr poly, mp_srcp
 FLINT_DLL void _nmod_poly_interpolation_weights(mp_ptr w, const mp_ptr * tree,
     slong len, nmod_t mod);
 
+/* Multipoint evaluation plans  *********************************************/
+
+/* nodes of degree at least this get a precomputed inverse */
+#define NMOD_POLY_EVAL_PLAN_INV_CUTOFF 64
+
+typedef struct
+{
+    mp_ptr * tree;      /* subproduct tree of the points */
+    mp_ptr * tinv;      /* tinv[i] + k*2^i: inverse of the reversed node k
+                           of level i, or tinv[i] = NULL below the cutoff */
+    mp_ptr weights;     /* interpolation weights */
+    slong len;
+    nmod_t mod;
+} nmod_poly_eval_plan_struct;
+
+typedef nmod_poly_eval_plan_struct nmod_poly_eval_plan_t[1];
+
+FLINT_DLL void nmod_poly_eval_plan_init(nmod_poly_eval_plan_t P,
+                                       mp_srcptr xs, slong len, nmod_t mod);
+
+FLINT_DLL void nmod_poly_eval_plan_clear(nmod_poly_eval_plan_t P);
+
+FLINT_DLL void _nmod_poly_eval_plan_evaluate(mp_ptr ys, mp_srcptr poly,
+         slong plen, const nmod_poly_eval_plan_t P, slong thread_limit);
+
+FLINT_DLL void nmod_poly_eval_plan_evaluate(mp_ptr ys,
+                       const nmod_poly_t poly, const nmod_poly_eval_plan_t P);
+
+FLINT_DLL void nmod_poly_eval_plan_evaluate_vec(mp_ptr * ys,
+  const nmod_poly_struct * polys, slong num, const nmod_poly_eval_plan_t P);
+
+FLINT_DLL void _nmod_poly_eval_plan_interpolate(mp_ptr poly, mp_srcptr ys,
+                     const nmod_poly_eval_plan_t P, slong thread_limit);
+
+FLINT_DLL void nmod_poly_eval_plan_interpolate(nmod_poly_t poly,
+                            mp_srcptr ys, const nmod_poly_eval_plan_t P);
+
+FLINT_DLL void nmod_poly_eval_plan_interpolate_vec(nmod_poly_struct * polys,
+     const mp_srcptr * ys, slong num, const nmod_poly_eval_plan_t P);
+
+/* Batches of small polynomials  ********************************************/
+
+/* number of polynomials of a batch processed together */
+#define NMOD_POLY_BATCH_BLOCK 64
+
+typedef struct
+{
+    mp_ptr coeffs;      /* coefficient i of polynomial j at i*num + j */
+    slong num;
+    slong length;       /* common padded length */
+    slong alloc;
+    nmod_t mod;
+} nmod_poly_batch_struct;
+
+typedef nmod_poly_batch_struct nmod_poly_batch_t[1];
+
+FLINT_DLL void nmod_poly_batch_init(nmod_poly_batch_t A, slong num,
+                                                                mp_limb_t n);
+
+FLINT_DLL void nmod_poly_batch_clear(nmod_poly_batch_t A);
+
+FLINT_DLL void nmod_poly_batch_fit_length(nmod_poly_batch_t A, slong len);
+
+FLINT_DLL void _nmod_poly_batch_normalise(nmod_poly_batch_t A);
+
+NMOD_POLY_INLINE
+void nmod_poly_batch_zero(nmod_poly_batch_t A)
+{
+    A->length = 0;
+}
+
+FLINT_DLL void nmod_poly_batch_set_nmod_poly(nmod_poly_batch_t A, slong j,
+                                                       const nmod_poly_t poly);
+
+FLINT_DLL void nmod_poly_batch_get_nmod_poly(nmod_poly_t poly,
+                                          const nmod_poly_batch_t A, slong j);
+
+FLINT_DLL void nmod_poly_batch_mul(nmod_poly_batch_t res,
+                       const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_rem(nmod_poly_batch_t R,
+                       const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_mulmod(nmod_poly_batch_t res,
+                       const nmod_poly_batch_t A, const nmod_poly_batch_t B,
+                                                   const nmod_poly_batch_t F);
+
+FLINT_DLL void nmod_poly_batch_gcd(nmod_poly_batch_t G,
+                       const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_evaluate_nmod(mp_ptr ys,
+                                  const nmod_poly_batch_t A, mp_srcptr xs);
+
 /* Composition  **************************************************************/
 
 FLINT_DLL void _nmod_poly_compose_horner(mp_ptr res, mp_srcptr poly1, 
@@ -1021,6 +1178,9 @@ FLINT_DLL void nmod_poly_taylor_shift(nmod_poly_t g, const nmod_poly_t f, mp_lim
 
 /* Modular composition  ******************************************************/
 
+/* moduli of at least this degree compose using several threads */
+#define NMOD_POLY_COMPOSE_MOD_THREAD_CUTOFF 2000
+
 FLINT_DLL void _nmod_poly_compose_mod_brent_kung(mp_ptr res, mp_srcptr f, slong lenf,
                             mp_srcptr g, mp_srcptr h, slong lenh, nmod_t mod);
 
@@ -1300,6 +1460,31 @@ FLINT_DLL void _nmod_poly_power_sums(mp_ptr res, mp_srcptr poly, slong len, slon
 
 FLINT_DLL void nmod_poly_power_sums(nmod_poly_t res, const nmod_poly_t poly, slong n);
 
+FLINT_DLL void _nmod_poly_power_sums_extend(mp_ptr res, slong m, slong n, mp_srcptr rev, mp_srcptr inv, slong len, nmod_t mod);
+
+typedef struct
+{
+    mp_ptr rev;     /* reverse of the monic polynomial */
+    mp_ptr inv;     /* inverse of rev modulo x^(len - 1) */
+    mp_ptr sums;    /* power sums computed so far */
+    slong len;
+    slong n;        /* number of power sums in sums */
+    slong alloc;
+    nmod_t mod;
+} nmod_poly_power_sums_ctx_struct;
+
+typedef nmod_poly_power_sums_ctx_struct nmod_poly_power_sums_ctx_t[1];
+
+FLINT_DLL void nmod_poly_power_sums_ctx_init(nmod_poly_power_sums_ctx_t ctx, const nmod_poly_t poly);
+
+FLINT_DLL void nmod_poly_power_sums_ctx_clear(nmod_poly_power_sums_ctx_t ctx);
+
+FLINT_DLL void nmod_poly_power_sums_ctx_fit_length(nmod_poly_power_sums_ctx_t ctx, slong n);
+
+FLINT_DLL void nmod_poly_power_sums_precomp(nmod_poly_t res, slong n, nmod_poly_power_sums_ctx_t ctx);
+
+FLINT_DLL mp_limb_t nmod_poly_power_sums_trace(const nmod_poly_t g, nmod_poly_power_sums_ctx_t ctx);
+
 FLINT_DLL void _nmod_poly_power_sums_to_poly_naive(mp_ptr res, mp_srcptr poly, slong len, nmod_t mod);
 
 FLINT_DLL void nmod_poly_power_sums_to_poly_naive(nmod_poly_t res, const nmod_poly_t Q);
@@ -1375,12 +1560,21 @@ FLINT_DLL void _nmod_poly_split_rabin(nmod_poly_t a, nmod_poly_t b,
                            const nmod_poly_t f, nmod_poly_t t, nmod_poly_t t2,
                                                        flint_rand_t randstate);
 
+/* root splitting uses threads from this degree on */
+#define NMOD_POLY_SPLIT_THREAD_CUTOFF 100
+
+FLINT_DLL void _nmod_poly_split_rabin_roots(mp_ptr roots, nmod_poly_t a,
+                                       nmod_poly_t b, flint_rand_t randstate);
+
 FLINT_DLL int nmod_poly_find_distinct_nonzero_roots(mp_limb_t * roots,
                                                           const nmod_poly_t P);
 
 
 /* CRT ***********************************************************************/
 
+#define NMOD_POLY_MULTI_CRT_THREAD_CUTOFF 1000 /* subtrees of a combination
+                                  with a modulus this long run in parallel */
+
 /* instructions do A = B + I*(C - B) mod M */
 typedef struct
 {
@@ -1435,6 +1629,9 @@ FLINT_DLL void _nmod_poly_multi_crt_run(nmod_poly_struct * outputs,
 FLINT_DLL void _nmod_poly_multi_crt_run_p(nmod_poly_struct * outputs,
      const nmod_poly_multi_crt_t CRT, const nmod_poly_struct * const * inputs);
 
+FLINT_DLL void _nmod_poly_multi_crt_run_p_threaded(nmod_poly_struct * outputs,
+     const nmod_poly_multi_crt_t CRT, const nmod_poly_struct * const * inputs);
+
 /* Inflation and deflation ***************************************************/
 
 FLINT_DLL ulong nmod_poly_deflation(const nmod_poly_t input);
@@ -1452,11 +1649,19 @@ FLINT_DLL void nmod_mat_charpoly_berkowitz(nmod_poly_t p, const nmod_mat_t M);
 FLINT_DLL void nmod_mat_charpoly_danilevsky(nmod_poly_t p, const nmod_mat_t M);
 FLINT_DLL void nmod_mat_charpoly(nmod_poly_t p, const nmod_mat_t M);
 
+FLINT_DLL void _nmod_mat_charpoly_krylov(nmod_poly_t p,
+                                               const nmod_mat_t C, slong s);
+FLINT_DLL int nmod_mat_charpoly_krylov(nmod_poly_t p, const nmod_mat_t M,
+                                                         flint_rand_t state);
+
 FLINT_DLL void nmod_mat_minpoly_with_gens(nmod_poly_t p, 
                                                 const nmod_mat_t X, ulong * P);
 
 FLINT_DLL void nmod_mat_minpoly(nmod_poly_t p, const nmod_mat_t M);
 
+FLINT_DLL int nmod_mat_minpoly_krylov(nmod_poly_t p, const nmod_mat_t M,
+                                                         flint_rand_t state);
+
 /* Berlekamp-Massey Algorithm - see nmod_poly/berlekamp_massey.c for more info ************/
 typedef struct {
     slong npoints;
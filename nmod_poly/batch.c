@@ -0,0 +1,87 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_poly.h"
+
+void nmod_poly_batch_init(nmod_poly_batch_t A, slong num, mp_limb_t n)
+{
+    A->coeffs = NULL;
+    A->num = num;
+    A->length = 0;
+    A->alloc = 0;
+    nmod_init(&A->mod, n);
+}
+
+void nmod_poly_batch_clear(nmod_poly_batch_t A)
+{
+    if (A->coeffs != NULL)
+        flint_free(A->coeffs);
+}
+
+void nmod_poly_batch_fit_length(nmod_poly_batch_t A, slong len)
+{
+    if (len > A->alloc)
+    {
+        len = FLINT_MAX(len, 2*A->alloc);
+        A->coeffs = (mp_ptr) flint_realloc(A->coeffs,
+                                          len*A->num*sizeof(mp_limb_t));
+        A->alloc = len;
+    }
+}
+
+void _nmod_poly_batch_normalise(nmod_poly_batch_t A)
+{
+    const slong num = A->num;
+
+    while (A->length > 0 &&
+           _nmod_vec_is_zero(A->coeffs + (A->length - 1)*num, num))
+    {
+        A->length--;
+    }
+}
+
+void nmod_poly_batch_set_nmod_poly(nmod_poly_batch_t A, slong j,
+                                                        const nmod_poly_t poly)
+{
+    const slong num = A->num;
+    slong i;
+
+    if (poly->length > A->length)
+    {
+        nmod_poly_batch_fit_length(A, poly->length);
+        _nmod_vec_zero(A->coeffs + A->length*num,
+                                              (poly->length - A->length)*num);
+        A->length = poly->length;
+    }
+
+    for (i = 0; i < poly->length; i++)
+        A->coeffs[i*num + j] = poly->coeffs[i];
+
+    for ( ; i < A->length; i++)
+        A->coeffs[i*num + j] = 0;
+
+    _nmod_poly_batch_normalise(A);
+}
+
+void nmod_poly_batch_get_nmod_poly(nmod_poly_t poly,
+                                           const nmod_poly_batch_t A, slong j)
+{
+    const slong num = A->num;
+    slong i, len = A->length;
+
+    while (len > 0 && A->coeffs[(len - 1)*num + j] == 0)
+        len--;
+
+    nmod_poly_fit_length(poly, len);
+
+    for (i = 0; i < len; i++)
+        poly->coeffs[i] = A->coeffs[i*num + j];
+
+    poly->length = len;
+}
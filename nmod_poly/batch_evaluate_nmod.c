@@ -0,0 +1,56 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_poly.h"
+
+/* Horner's rule across the batch, one row of coefficients at a time */
+void nmod_poly_batch_evaluate_nmod(mp_ptr ys,
+                                    const nmod_poly_batch_t A, mp_srcptr xs)
+{
+    const slong num = A->num;
+    const nmod_t mod = A->mod;
+    slong i, j;
+
+    if (A->length == 0)
+    {
+        _nmod_vec_zero(ys, num);
+        return;
+    }
+
+    _nmod_vec_set(ys, A->coeffs + (A->length - 1)*num, num);
+
+    if (NMOD_CAN_USE_SHOUP(mod))
+    {
+        mp_ptr xp = _nmod_vec_init(num);
+
+        for (j = 0; j < num; j++)
+            xp[j] = n_mulmod_precomp_shoup(xs[j], mod.n);
+
+        for (i = A->length - 2; i >= 0; i--)
+        {
+            mp_srcptr c = A->coeffs + i*num;
+
+            for (j = 0; j < num; j++)
+                ys[j] = nmod_add(n_mulmod_shoup(xs[j], ys[j], xp[j], mod.n),
+                                                               c[j], mod);
+        }
+
+        _nmod_vec_clear(xp);
+    }
+    else
+    {
+        for (i = A->length - 2; i >= 0; i--)
+        {
+            mp_srcptr c = A->coeffs + i*num;
+
+            for (j = 0; j < num; j++)
+                ys[j] = nmod_add(nmod_mul(ys[j], xs[j], mod), c[j], mod);
+        }
+    }
+}
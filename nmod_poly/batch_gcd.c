@@ -0,0 +1,228 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_poly.h"
+
+/* Euclidean algorithm in place; the gcd ends up in *g */
+static slong
+_gcd_euclidean(mp_ptr * g, mp_ptr a, slong alen,
+                                       mp_ptr b, slong blen, nmod_t mod)
+{
+    slong i, k;
+
+    while (blen > 0)
+    {
+        mp_limb_t q, inv = nmod_inv(b[blen - 1], mod);
+
+        for (i = alen - 1; i >= blen - 1; i--)
+        {
+            q = nmod_neg(nmod_mul(a[i], inv, mod), mod);
+            for (k = 0; k < blen - 1; k++)
+                a[i - blen + 1 + k] = nmod_addmul(a[i - blen + 1 + k],
+                                                            q, b[k], mod);
+        }
+
+        alen = FLINT_MIN(alen, blen - 1);
+        while (alen > 0 && a[alen - 1] == 0)
+            alen--;
+
+        MP_PTR_SWAP(a, b);
+        SLONG_SWAP(alen, blen);
+    }
+
+    *g = a;
+    return alen;
+}
+
+static void
+_gcd_store(mp_ptr G, slong num, mp_srcptr g, slong glen, nmod_t mod)
+{
+    slong i;
+    mp_limb_t inv;
+
+    if (glen > 0)
+    {
+        inv = nmod_inv(g[glen - 1], mod);
+        for (i = 0; i < glen - 1; i++)
+            G[i*num] = nmod_mul(g[i], inv, mod);
+        G[(glen - 1)*num] = 1;
+    }
+}
+
+/*
+    For random input almost all remainder sequences are normal, i.e. every
+    remainder has exactly one coefficient less than its predecessor. The
+    Euclidean algorithm is run in lockstep on the columns (with stride bs)
+    of a and b as long as they have the same degrees; a column that leaves
+    the common remainder sequence is finished on its own.
+*/
+static void
+_nmod_poly_batch_gcd_block(mp_ptr G, slong num, mp_ptr a, slong alen,
+                      mp_ptr b, slong blen, slong bs, mp_ptr W, nmod_t mod)
+{
+    slong i, j, k, len, clen, dlen, nactive;
+    mp_ptr inv = W, q = inv + bs, c = q + bs, d = c + alen;
+    char * active = (char *) (d + alen);
+    int half = (mod.n <= (UWORD(1) << (FLINT_BITS / 2)));
+    mp_ptr g;
+
+    nactive = 0;
+
+    for (j = 0; j < bs; j++)
+    {
+        for (clen = alen; clen > 0 && a[(clen - 1)*bs + j] == 0; clen--) ;
+        for (dlen = blen; dlen > 0 && b[(dlen - 1)*bs + j] == 0; dlen--) ;
+
+        active[j] = (clen == alen && dlen == blen && blen > 0);
+
+        if (active[j])
+        {
+            nactive++;
+        }
+        else
+        {
+            for (i = 0; i < clen; i++)
+                c[i] = a[i*bs + j];
+            for (i = 0; i < dlen; i++)
+                d[i] = b[i*bs + j];
+
+            len = _gcd_euclidean(&g, c, clen, d, dlen, mod);
+            _gcd_store(G + j, num, g, len, mod);
+        }
+    }
+
+    while (nactive > 0)
+    {
+        mp_ptr lead = b + (blen - 1)*bs;
+
+        if (blen == 1)
+        {
+            for (j = 0; j < bs; j++)
+                if (active[j])
+                    G[j] = 1;
+            break;
+        }
+
+        for (j = 0; j < bs; j++)
+            if (!active[j])
+                lead[j] = 1;
+
+        _nmod_vec_inv(inv, lead, bs, mod);
+
+        /* a <- a mod b */
+        for (i = alen - 1; i >= blen - 1; i--)
+        {
+            mp_ptr w = a + (i - blen + 1)*bs;
+
+            for (j = 0; j < bs; j++)
+                q[j] = nmod_neg(nmod_mul(a[i*bs + j], inv[j], mod), mod);
+
+            for (k = 0; k < blen - 1; k++)
+            {
+                mp_ptr r = w + k*bs;
+                mp_srcptr s = b + k*bs;
+
+                if (half)
+                {
+                    for (j = 0; j < bs; j++)
+                        NMOD_RED(r[j], r[j] + q[j]*s[j], mod);
+                }
+                else
+                {
+                    for (j = 0; j < bs; j++)
+                        r[j] = nmod_addmul(r[j], q[j], s[j], mod);
+                }
+            }
+        }
+
+        for (j = 0; j < bs; j++)
+        {
+            if (active[j] && a[(blen - 2)*bs + j] == 0)
+            {
+                active[j] = 0;
+                nactive--;
+
+                for (i = 0; i < blen; i++)
+                    c[i] = b[i*bs + j];
+                for (i = 0; i < blen - 1; i++)
+                    d[i] = a[i*bs + j];
+                for (dlen = blen - 1; dlen > 0 && d[dlen - 1] == 0; dlen--) ;
+
+                len = _gcd_euclidean(&g, c, blen, d, dlen, mod);
+                _gcd_store(G + j, num, g, len, mod);
+            }
+        }
+
+        MP_PTR_SWAP(a, b);
+        alen = blen;
+        blen = blen - 1;
+    }
+}
+
+void nmod_poly_batch_gcd(nmod_poly_batch_t G,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B)
+{
+    const slong num = A->num;
+    slong i, j, j0, bs, alen, blen, len;
+    mp_ptr T, a, b, W;
+    mp_srcptr Ac, Bc;
+
+    FLINT_ASSERT(B->num == num && G->num == num);
+
+    alen = A->length;
+    blen = B->length;
+    Ac = A->coeffs;
+    Bc = B->coeffs;
+
+    if (alen < blen)
+    {
+        SLONG_SWAP(alen, blen);
+        Ac = B->coeffs;
+        Bc = A->coeffs;
+    }
+
+    len = alen;
+
+    if (len == 0)
+    {
+        nmod_poly_batch_zero(G);
+        return;
+    }
+
+    T = _nmod_vec_init(num*len + 2*len*NMOD_POLY_BATCH_BLOCK
+                     + 2*NMOD_POLY_BATCH_BLOCK + 2*len + NMOD_POLY_BATCH_BLOCK);
+    a = T + num*len;
+    b = a + len*NMOD_POLY_BATCH_BLOCK;
+    W = b + len*NMOD_POLY_BATCH_BLOCK;
+
+    _nmod_vec_zero(T, num*len);
+
+    for (j0 = 0; j0 < num; j0 += NMOD_POLY_BATCH_BLOCK)
+    {
+        bs = FLINT_MIN(NMOD_POLY_BATCH_BLOCK, num - j0);
+
+        for (i = 0; i < alen; i++)
+            for (j = 0; j < bs; j++)
+                a[i*bs + j] = Ac[i*num + j0 + j];
+
+        for (i = 0; i < blen; i++)
+            for (j = 0; j < bs; j++)
+                b[i*bs + j] = Bc[i*num + j0 + j];
+
+        _nmod_poly_batch_gcd_block(T + j0, num, a, alen, b, blen, bs, W,
+                                                                    A->mod);
+    }
+
+    nmod_poly_batch_fit_length(G, len);
+    _nmod_vec_set(G->coeffs, T, len*num);
+    G->length = len;
+    _nmod_poly_batch_normalise(G);
+
+    _nmod_vec_clear(T);
+}
@@ -0,0 +1,152 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_poly.h"
+
+/*
+    The loops over j run across the polynomials of the batch with the same
+    instruction sequence for every entry, so that the compiler is free to
+    vectorise them. The polynomials are processed in blocks of
+    NMOD_POLY_BATCH_BLOCK so that the rows being worked on stay in cache.
+*/
+static void
+_nmod_poly_batch_mul_block(mp_ptr R, mp_srcptr A, slong Alen,
+                      mp_srcptr B, slong Blen, slong num, slong bs,
+                      mp_ptr lo, int nlimbs, nmod_t mod)
+{
+    slong i, j, k, c, len = Alen + Blen - 1;
+
+    if (nlimbs <= 1)
+    {
+        for (c = 0; c < len; c++)
+            _nmod_vec_zero(R + c*num, bs);
+
+        for (i = 0; i < Alen; i++)
+        {
+            for (k = 0; k < Blen; k++)
+            {
+                mp_ptr r = R + (i + k)*num;
+                mp_srcptr a = A + i*num;
+                mp_srcptr b = B + k*num;
+
+                for (j = 0; j < bs; j++)
+                    r[j] += a[j]*b[j];
+            }
+        }
+
+        for (c = 0; c < len; c++)
+            _nmod_vec_reduce(R + c*num, R + c*num, bs, mod);
+    }
+    else
+    {
+        mp_ptr hi = lo + bs, top = hi + bs;
+
+        for (c = 0; c < len; c++)
+        {
+            slong start = FLINT_MAX(0, c - Blen + 1);
+            slong stop = FLINT_MIN(c, Alen - 1);
+
+            _nmod_vec_zero(lo, 3*bs);
+
+            for (i = start; i <= stop; i++)
+            {
+                mp_srcptr a = A + i*num;
+                mp_srcptr b = B + (c - i)*num;
+
+                if (nlimbs == 2)
+                {
+                    for (j = 0; j < bs; j++)
+                    {
+                        mp_limb_t p1, p0;
+                        umul_ppmm(p1, p0, a[j], b[j]);
+                        add_ssaaaa(hi[j], lo[j], hi[j], lo[j], p1, p0);
+                    }
+                }
+                else
+                {
+                    for (j = 0; j < bs; j++)
+                    {
+                        mp_limb_t p1, p0;
+                        umul_ppmm(p1, p0, a[j], b[j]);
+                        add_sssaaaaaa(top[j], hi[j], lo[j],
+                                      top[j], hi[j], lo[j], 0, p1, p0);
+                    }
+                }
+            }
+
+            if (nlimbs == 2)
+            {
+                for (j = 0; j < bs; j++)
+                    NMOD2_RED2(R[c*num + j], hi[j], lo[j], mod);
+            }
+            else
+            {
+                for (j = 0; j < bs; j++)
+                {
+                    NMOD_RED(top[j], top[j], mod);
+                    NMOD_RED3(R[c*num + j], top[j], hi[j], lo[j], mod);
+                }
+            }
+        }
+    }
+}
+
+static void
+_nmod_poly_batch_mul(mp_ptr R, mp_srcptr A, slong Alen,
+                           mp_srcptr B, slong Blen, slong num, nmod_t mod)
+{
+    int nlimbs = _nmod_vec_dot_bound_limbs(FLINT_MIN(Alen, Blen), mod);
+    mp_ptr lo = _nmod_vec_init(3*NMOD_POLY_BATCH_BLOCK);
+    slong j;
+
+    for (j = 0; j < num; j += NMOD_POLY_BATCH_BLOCK)
+    {
+        _nmod_poly_batch_mul_block(R + j, A + j, Alen, B + j, Blen, num,
+                   FLINT_MIN(NMOD_POLY_BATCH_BLOCK, num - j), lo, nlimbs, mod);
+    }
+
+    _nmod_vec_clear(lo);
+}
+
+void nmod_poly_batch_mul(nmod_poly_batch_t res,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B)
+{
+    slong len;
+
+    FLINT_ASSERT(A->num == B->num && res->num == A->num);
+
+    if (A->length == 0 || B->length == 0)
+    {
+        nmod_poly_batch_zero(res);
+        return;
+    }
+
+    len = A->length + B->length - 1;
+
+    if (res == A || res == B)
+    {
+        nmod_poly_batch_t t;
+        nmod_poly_batch_init(t, res->num, res->mod.n);
+        nmod_poly_batch_fit_length(t, len);
+        _nmod_poly_batch_mul(t->coeffs, A->coeffs, A->length,
+                             B->coeffs, B->length, A->num, A->mod);
+        MP_PTR_SWAP(res->coeffs, t->coeffs);
+        SLONG_SWAP(res->alloc, t->alloc);
+        nmod_poly_batch_clear(t);
+    }
+    else
+    {
+        nmod_poly_batch_fit_length(res, len);
+        _nmod_poly_batch_mul(res->coeffs, A->coeffs, A->length,
+                             B->coeffs, B->length, A->num, A->mod);
+    }
+
+    res->length = len;
+    _nmod_poly_batch_normalise(res);
+}
@@ -0,0 +1,28 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_poly.h"
+
+void nmod_poly_batch_mulmod(nmod_poly_batch_t res,
+                         const nmod_poly_batch_t A, const nmod_poly_batch_t B,
+                                                    const nmod_poly_batch_t F)
+{
+    nmod_poly_batch_t t;
+
+    if (F->length == 0)
+    {
+        flint_printf("Exception (nmod_poly_batch_mulmod). Division by zero.\n");
+        flint_abort();
+    }
+
+    nmod_poly_batch_init(t, A->num, A->mod.n);
+    nmod_poly_batch_mul(t, A, B);
+    nmod_poly_batch_rem(res, t, F);
+    nmod_poly_batch_clear(t);
+}
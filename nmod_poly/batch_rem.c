@@ -0,0 +1,114 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_poly.h"
+
+/*
+    Schoolbook division performed in lockstep on all polynomials of the
+    batch. Every divisor has length Blen, so each step is the same for
+    every entry and the inner loops run across the batch. The leading
+    coefficients are inverted simultaneously.
+*/
+void nmod_poly_batch_rem(nmod_poly_batch_t R,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B)
+{
+    const slong num = A->num;
+    const slong Alen = A->length, Blen = B->length;
+    const nmod_t mod = A->mod;
+    slong i, j, j0, k;
+    mp_ptr W, inv, q;
+    int lazy;
+
+    FLINT_ASSERT(B->num == num && R->num == num);
+
+    if (Blen == 0)
+    {
+        flint_printf("Exception (nmod_poly_batch_rem). Division by zero.\n");
+        flint_abort();
+    }
+
+    if (Alen < Blen)
+    {
+        if (R != A)
+        {
+            nmod_poly_batch_fit_length(R, Alen);
+            _nmod_vec_set(R->coeffs, A->coeffs, Alen*num);
+            R->length = Alen;
+        }
+        return;
+    }
+
+    W = _nmod_vec_init((Alen + 1)*num + NMOD_POLY_BATCH_BLOCK);
+    inv = W + Alen*num;
+    q = inv + num;
+
+    /*
+        if no entry can exceed one limb before it is used, the reductions
+        are delayed
+    */
+    lazy = _nmod_vec_dot_bound_limbs(
+                 FLINT_MIN(Blen - 1, Alen - Blen + 1) + 1, mod) <= 1;
+
+    _nmod_vec_set(W, A->coeffs, Alen*num);
+    _nmod_vec_inv(inv, B->coeffs + (Blen - 1)*num, num, mod);
+
+    for (j0 = 0; j0 < num; j0 += NMOD_POLY_BATCH_BLOCK)
+    {
+        slong bs = FLINT_MIN(NMOD_POLY_BATCH_BLOCK, num - j0);
+
+        for (i = Alen - 1; i >= Blen - 1; i--)
+        {
+            mp_ptr w = W + (i - Blen + 1)*num + j0;
+            mp_srcptr c = W + i*num + j0;
+
+            if (lazy)
+            {
+                for (j = 0; j < bs; j++)
+                {
+                    mp_limb_t t;
+                    NMOD_RED(t, c[j], mod);
+                    q[j] = nmod_neg(nmod_mul(t, inv[j0 + j], mod), mod);
+                }
+
+                for (k = 0; k < Blen - 1; k++)
+                {
+                    mp_ptr r = w + k*num;
+                    mp_srcptr b = B->coeffs + k*num + j0;
+
+                    for (j = 0; j < bs; j++)
+                        r[j] += q[j]*b[j];
+                }
+            }
+            else
+            {
+                for (j = 0; j < bs; j++)
+                    q[j] = nmod_neg(nmod_mul(c[j], inv[j0 + j], mod), mod);
+
+                for (k = 0; k < Blen - 1; k++)
+                {
+                    mp_ptr r = w + k*num;
+                    mp_srcptr b = B->coeffs + k*num + j0;
+
+                    for (j = 0; j < bs; j++)
+                        r[j] = nmod_addmul(r[j], q[j], b[j], mod);
+                }
+            }
+        }
+    }
+
+    if (lazy)
+        _nmod_vec_reduce(W, W, (Blen - 1)*num, mod);
+
+    nmod_poly_batch_fit_length(R, Blen - 1);
+    _nmod_vec_set(R->coeffs, W, (Blen - 1)*num);
+    R->length = Blen - 1;
+    _nmod_poly_batch_normalise(R);
+
+    _nmod_vec_clear(W);
+}
@@ -21,11 +21,7 @@ _nmod_poly_compose_mod_brent_kung(mp_ptr res, mp_srcptr poly1, slong len1,
                             mp_srcptr poly2,
                             mp_srcptr poly3, slong len3, nmod_t mod)
 {
-    nmod_mat_t A, B, C;
-    mp_ptr t, h;
-    slong i, n, m;
-
-    n = len3 - 1;
+    mp_ptr poly3inv, poly3rev;
 
     if (len3 == 1)
         return;
@@ -42,46 +38,16 @@ _nmod_poly_compose_mod_brent_kung(mp_ptr res, mp_srcptr poly1, slong len1,
         return;
     }
 
-    m = n_sqrt(n) + 1;
-
-    nmod_mat_init(A, m, n, mod.n);
-    nmod_mat_init(B, m, m, mod.n);
-    nmod_mat_init(C, m, n, mod.n);
-
-    h = _nmod_vec_init(n);
-    t = _nmod_vec_init(n);
-
-    /* Set rows of B to the segments of poly1 */
-    for (i = 0; i < len1 / m; i++)
-        _nmod_vec_set(B->rows[i], poly1 + i*m, m);
-
-    _nmod_vec_set(B->rows[i], poly1 + i*m, len1 % m);
-
-    /* Set rows of A to powers of poly2 */
-    A->rows[0][0] = UWORD(1);
-    _nmod_vec_set(A->rows[1], poly2, n);
-    for (i = 2; i < m; i++)
-        _nmod_poly_mulmod(A->rows[i], A->rows[i-1],
-            n, poly2, n, poly3, len3, mod);
-
-    nmod_mat_mul(C, B, A);
-
-    /* Evaluate block composition using the Horner scheme */
-    _nmod_vec_set(res, C->rows[m - 1], n);
-    _nmod_poly_mulmod(h, A->rows[m - 1], n, poly2, n, poly3, len3, mod);
-
-    for (i = m - 2; i >= 0; i--)
-    {
-        _nmod_poly_mulmod(t, res, n, h, n, poly3, len3, mod);
-        _nmod_poly_add(res, t, n, C->rows[i], n, mod);
-    }
+    /* all reductions modulo poly3 share one precomputed inverse */
+    poly3inv = _nmod_vec_init(2*len3);
+    poly3rev = poly3inv + len3;
+    _nmod_poly_reverse(poly3rev, poly3, len3, len3);
+    _nmod_poly_inv_series(poly3inv, poly3rev, len3, len3, mod);
 
-    _nmod_vec_clear(h);
-    _nmod_vec_clear(t);
+    _nmod_poly_compose_mod_brent_kung_preinv(res, poly1, len1, poly2,
+                                       poly3, len3, poly3inv, len3, mod);
 
-    nmod_mat_clear(A);
-    nmod_mat_clear(B);
-    nmod_mat_clear(C);
+    _nmod_vec_clear(poly3inv);
 }
 
 void
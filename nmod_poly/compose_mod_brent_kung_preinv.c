@@ -17,6 +17,58 @@
 #include "nmod_poly.h"
 #include "nmod_mat.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    mp_ptr * P;
+    mp_ptr T;
+    mp_ptr * C;
+    mp_srcptr h;
+    mp_ptr hs;
+    slong m;
+    slong s;
+    slong nblocks;
+    slong n;
+    mp_srcptr poly3;
+    slong len3;
+    mp_srcptr poly3inv;
+    slong len3inv;
+    nmod_t mod;
+}
+_giant_arg_t;
+
+/*
+    Job b < nblocks evaluates the rows b*s, ..., b*s + s - 1 of C at h
+    using the Horner scheme, job nblocks computes h^s.
+*/
+static void
+_giant_worker(slong b, _giant_arg_t * arg)
+{
+    slong i, start, stop, n = arg->n;
+    mp_ptr r, t;
+
+    if (b == arg->nblocks)
+    {
+        _nmod_poly_powmod_ui_binexp_preinv(arg->hs, arg->h, arg->s,
+               arg->poly3, arg->len3, arg->poly3inv, arg->len3inv, arg->mod);
+        return;
+    }
+
+    start = b*arg->s;
+    stop = FLINT_MIN(start + arg->s, arg->m);
+    r = arg->P[b];
+    t = arg->T + b*n;
+
+    _nmod_vec_set(r, arg->C[stop - 1], n);
+
+    for (i = stop - 2; i >= start; i--)
+    {
+        _nmod_poly_mulmod_preinv(t, r, n, arg->h, n, arg->poly3, arg->len3,
+                                        arg->poly3inv, arg->len3inv, arg->mod);
+        _nmod_poly_add(r, t, n, arg->C[i], n, arg->mod);
+    }
+}
 
 void
 _nmod_poly_compose_mod_brent_kung_preinv(mp_ptr res, mp_srcptr poly1,
@@ -25,7 +77,7 @@ _nmod_poly_compose_mod_brent_kung_preinv(mp_ptr res, mp_srcptr poly1,
 {
     nmod_mat_t A, B, C;
     mp_ptr t, h;
-    slong i, n, m;
+    slong i, n, m, nblocks;
 
     n = len3 - 1;
 
@@ -46,6 +98,11 @@ _nmod_poly_compose_mod_brent_kung_preinv(mp_ptr res, mp_srcptr poly1,
 
     m = n_sqrt(n) + 1;
 
+    if (n < NMOD_POLY_COMPOSE_MOD_THREAD_CUTOFF)
+        nblocks = 1;
+    else
+        nblocks = FLINT_MIN(flint_get_num_threads(), m / 2);
+
     nmod_mat_init(A, m, n, mod.n);
     nmod_mat_init(B, m, m, mod.n);
     nmod_mat_init(C, m, n, mod.n);
@@ -60,21 +117,73 @@ _nmod_poly_compose_mod_brent_kung_preinv(mp_ptr res, mp_srcptr poly1,
     _nmod_vec_set(B->rows[i], poly1 + i*m, len1%m);
 
     /* Set rows of A to powers of poly2 */
-    _nmod_poly_powers_mod_preinv_naive(A->rows, poly2, n,
+    if (nblocks > 1)
+        _nmod_poly_powers_mod_preinv_threaded(A->rows, poly2, n,
+                                       m, poly3, len3, poly3inv, len3inv, mod);
+    else
+        _nmod_poly_powers_mod_preinv_naive(A->rows, poly2, n,
                                        m, poly3, len3, poly3inv, len3inv, mod);
 
     nmod_mat_mul(C, B, A);
 
-    /* Evaluate block composition using the Horner scheme */
-    _nmod_vec_set(res, C->rows[m - 1], n);
     _nmod_poly_mulmod_preinv(h, A->rows[m - 1], n, poly2, n,
                                            poly3, len3, poly3inv, len3inv,mod);
 
-    for (i = m - 2; i >= 0; i--)
+    if (nblocks > 1)
+    {
+        /*
+            Split the Horner scheme into nblocks independent ones in h,
+            combined by a final Horner scheme in h^s.
+        */
+        _giant_arg_t arg;
+        mp_ptr W;
+
+        arg.s = (m + nblocks - 1) / nblocks;
+        nblocks = (m + arg.s - 1) / arg.s;
+
+        W = _nmod_vec_init((2*nblocks + 1)*n);
+        arg.P = flint_malloc(nblocks*sizeof(mp_ptr));
+        for (i = 0; i < nblocks; i++)
+            arg.P[i] = W + i*n;
+        arg.T = W + nblocks*n;
+        arg.hs = W + 2*nblocks*n;
+        arg.C = C->rows;
+        arg.h = h;
+        arg.m = m;
+        arg.nblocks = nblocks;
+        arg.n = n;
+        arg.poly3 = poly3;
+        arg.len3 = len3;
+        arg.poly3inv = poly3inv;
+        arg.len3inv = len3inv;
+        arg.mod = mod;
+
+        flint_parallel_do((do_func_t) _giant_worker, &arg, nblocks + 1,
+                                         nblocks + 1, FLINT_PARALLEL_UNIFORM);
+
+        _nmod_vec_set(res, arg.P[nblocks - 1], n);
+
+        for (i = nblocks - 2; i >= 0; i--)
+        {
+            _nmod_poly_mulmod_preinv(t, res, n, arg.hs, n, poly3, len3,
+                                                       poly3inv, len3inv, mod);
+            _nmod_poly_add(res, t, n, arg.P[i], n, mod);
+        }
+
+        flint_free(arg.P);
+        _nmod_vec_clear(W);
+    }
+    else
     {
-        _nmod_poly_mulmod_preinv(t, res, n, h, n, poly3, len3,
+        /* Evaluate block composition using the Horner scheme */
+        _nmod_vec_set(res, C->rows[m - 1], n);
+
+        for (i = m - 2; i >= 0; i--)
+        {
+            _nmod_poly_mulmod_preinv(t, res, n, h, n, poly3, len3,
                                                        poly3inv, len3inv, mod);
-        _nmod_poly_add(res, t, n, C->rows[i], n, mod);
+            _nmod_poly_add(res, t, n, C->rows[i], n, mod);
+        }
     }
 
     _nmod_vec_clear(h);
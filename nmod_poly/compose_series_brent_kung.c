@@ -21,6 +21,7 @@ _nmod_poly_compose_series_brent_kung(mp_ptr res, mp_srcptr poly1, slong len1,
                             mp_srcptr poly2, slong len2, slong n, nmod_t mod)
 {
     nmod_mat_t A, B, C;
+    nmod_poly_mul_precache_t P;
     mp_ptr t, h;
     slong i, m;
 
@@ -47,20 +48,24 @@ _nmod_poly_compose_series_brent_kung(mp_ptr res, mp_srcptr poly1, slong len1,
     /* Set rows of A to powers of poly2 */
     A->rows[0][0] = UWORD(1);
     _nmod_vec_set(A->rows[1], poly2, len2);
+    _nmod_poly_mul_precache_init(P, poly2, len2, n, mod);
     for (i = 2; i < m; i++)
-        _nmod_poly_mullow(A->rows[i], A->rows[i-1], n, poly2, len2, n, mod);
+        _nmod_poly_mullow_precache(A->rows[i], A->rows[i-1], n, n, P);
 
     nmod_mat_mul(C, B, A);
 
     /* Evaluate block composition using the Horner scheme */
     _nmod_vec_set(res, C->rows[m - 1], n);
-    _nmod_poly_mullow(h, A->rows[m - 1], n, poly2, len2, n, mod);
+    _nmod_poly_mullow_precache(h, A->rows[m - 1], n, n, P);
+    _nmod_poly_mul_precache_clear(P);
 
+    _nmod_poly_mul_precache_init(P, h, n, n, mod);
     for (i = m - 2; i >= 0; i--)
     {
-        _nmod_poly_mullow(t, res, n, h, n, n, mod);
+        _nmod_poly_mullow_precache(t, res, n, n, P);
         _nmod_poly_add(res, t, n, C->rows[i], n, mod);
     }
+    _nmod_poly_mul_precache_clear(P);
 
     _nmod_vec_clear(h);
     _nmod_vec_clear(t);
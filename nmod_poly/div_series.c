@@ -17,6 +17,12 @@
 #include "nmod_poly.h"
 #include "ulong_extras.h"
 
+#define MULLOW(z, x, xn, y, yn, nn, mod) \
+    if ((xn) >= (yn)) \
+        _nmod_poly_mullow(z, x, xn, y, yn, nn, mod); \
+    else \
+        _nmod_poly_mullow(z, y, yn, x, xn, nn, mod); \
+
 void
 _nmod_poly_div_series(mp_ptr Q, mp_srcptr A, slong Alen,
                                 mp_srcptr B, slong Blen, slong n, nmod_t mod)
@@ -29,12 +35,45 @@ _nmod_poly_div_series(mp_ptr Q, mp_srcptr A, slong Alen,
     }
     else
     {
-        mp_ptr Binv = _nmod_vec_init(n);
+        /*
+            Karp-Markstein: the final Newton step of the inversion is
+            merged with the multiplication by A, so that B^{-1} is only
+            needed to precision m = ceil(n/2).
+        */
+        slong i, m, Qlen, Tlen;
+        nmod_poly_mul_precache_t P;
+        mp_ptr Binv, T;
+
+        m = (n + 1) / 2;
+        Alen = FLINT_MIN(Alen, n);
+
+        Binv = _nmod_vec_init(m);
+        T = _nmod_vec_init(n);
+
+        _nmod_poly_inv_series(Binv, B, Blen, m, mod);
+
+        /* Q = A / B mod x^m */
+        Qlen = FLINT_MIN(Alen, m);
+        _nmod_poly_mul_precache_init(P, Binv, m, FLINT_MAX(Qlen, n - m), mod);
+        _nmod_poly_mullow_precache(Q, A, Qlen, m, P);
+
+        /* T = (A - B Q) / x^m mod x^(n - m) */
+        Tlen = FLINT_MIN(Blen + m - 1, n);
+        MULLOW(T, B, Blen, Q, m, Tlen, mod);
+
+        for (i = m; i < n; i++)
+        {
+            mp_limb_t a = (i < Alen) ? A[i] : 0;
+            mp_limb_t b = (i < Tlen) ? T[i] : 0;
+            T[i - m] = nmod_sub(a, b, mod);
+        }
 
-        _nmod_poly_inv_series(Binv, B, Blen, n, mod);
-        _nmod_poly_mullow(Q, Binv, n, A, FLINT_MIN(n, Alen), n, mod);
+        /* Q += x^m B^{-1} T mod x^n */
+        _nmod_poly_mullow_precache(Q + m, T, n - m, n - m, P);
+        _nmod_poly_mul_precache_clear(P);
 
         _nmod_vec_clear(Binv);
+        _nmod_vec_clear(T);
     }
 }
 
@@ -0,0 +1,121 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    mp_ptr inv;
+    mp_srcptr nodes;
+    slong pow;
+    nmod_t mod;
+}
+inv_level_arg_t;
+
+static void
+_inv_level_worker(slong k, inv_level_arg_t * arg)
+{
+    slong pow = arg->pow;
+    mp_ptr rev = _nmod_vec_init(pow + 1);
+
+    _nmod_poly_reverse(rev, arg->nodes + k * (pow + 1), pow + 1, pow + 1);
+    _nmod_poly_inv_series(arg->inv + k * pow, rev, pow + 1, pow, arg->mod);
+
+    _nmod_vec_clear(rev);
+}
+
+void
+nmod_poly_eval_plan_init(nmod_poly_eval_plan_t P, mp_srcptr xs, slong len,
+                                                                 nmod_t mod)
+{
+    slong i, height, n, thread_limit;
+    inv_level_arg_t arg;
+    mp_ptr tmp;
+
+    P->len = len;
+    P->mod = mod;
+    P->tree = NULL;
+    P->tinv = NULL;
+    P->weights = NULL;
+
+    if (len == 0)
+        return;
+
+    height = FLINT_CLOG2(len);
+
+    P->tree = _nmod_poly_tree_alloc(len);
+    _nmod_poly_tree_build(P->tree, xs, len, mod);
+
+    thread_limit = FLINT_MIN(flint_get_num_threads(),
+                                     len / NMOD_POLY_TREE_THREAD_CUTOFF + 1);
+
+    /* inverses of the full nodes of the levels used for division */
+    P->tinv = flint_malloc((height + 1) * sizeof(mp_ptr));
+    arg.mod = mod;
+
+    for (i = 0; i <= height; i++)
+    {
+        arg.pow = WORD(1) << i;
+
+        if (i == height || arg.pow < NMOD_POLY_EVAL_PLAN_INV_CUTOFF)
+        {
+            P->tinv[i] = NULL;
+            continue;
+        }
+
+        P->tinv[i] = _nmod_vec_init(len);
+        arg.inv = P->tinv[i];
+        arg.nodes = P->tree[i];
+
+        flint_parallel_do((do_func_t) _inv_level_worker, &arg,
+                         len / arg.pow, thread_limit, FLINT_PARALLEL_UNIFORM);
+    }
+
+    /* weights 1/prod_{j != i} (x_i - x_j) = 1/f'(x_i), f = prod (x - x_j) */
+    P->weights = _nmod_vec_init(len);
+
+    if (len == 1)
+    {
+        P->weights[0] = 1;
+        return;
+    }
+
+    tmp = _nmod_vec_init(len + 1);
+    n = WORD(1) << (height - 1);
+
+    _nmod_poly_mul(tmp, P->tree[height - 1], n + 1,
+                        P->tree[height - 1] + (n + 1), (len - n + 1), mod);
+
+    _nmod_poly_derivative(tmp, tmp, len + 1, mod);
+    _nmod_poly_eval_plan_evaluate(P->weights, tmp, len, P, thread_limit);
+    _nmod_vec_inv(P->weights, P->weights, len, mod);
+
+    _nmod_vec_clear(tmp);
+}
+
+void
+nmod_poly_eval_plan_clear(nmod_poly_eval_plan_t P)
+{
+    slong i;
+
+    if (P->len == 0)
+        return;
+
+    for (i = 0; i <= FLINT_CLOG2(P->len); i++)
+        if (P->tinv[i] != NULL)
+            _nmod_vec_clear(P->tinv[i]);
+
+    flint_free(P->tinv);
+    _nmod_vec_clear(P->weights);
+    _nmod_poly_tree_free(P->tree, P->len);
+}
@@ -0,0 +1,172 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    mp_srcptr poly;     /* dividends, each of length 2*pow, or the input */
+    slong plen;         /* length of the input, or 0 below the top level */
+    mp_ptr res;         /* remainders, each of length pow */
+    mp_srcptr nodes;
+    mp_srcptr inv;
+    slong pow;
+    slong len;
+    nmod_t mod;
+}
+eval_level_arg_t;
+
+/* reduce the parent of node k of the current level modulo node k */
+static void
+_eval_level_worker(slong k, eval_level_arg_t * arg)
+{
+    slong pow = arg->pow;
+    slong start = k * pow;
+    slong nlen = FLINT_MIN(pow, arg->len - start);
+    mp_srcptr B = arg->nodes + k * (pow + 1);
+    mp_srcptr A;
+    slong alen;
+    mp_ptr Q;
+
+    if (arg->plen != 0)
+    {
+        A = arg->poly;
+        alen = arg->plen;
+    }
+    else
+    {
+        A = arg->poly + 2 * pow * (k / 2);
+        alen = FLINT_MIN(2 * pow, arg->len - 2 * pow * (k / 2));
+    }
+
+    if (alen <= nlen)
+    {
+        _nmod_vec_set(arg->res + start, A, alen);
+    }
+    else if (alen == 2 && nlen == 1)
+    {
+        arg->res[start] = nmod_sub(A[0], nmod_mul(A[1], B[0], arg->mod),
+                                                                 arg->mod);
+    }
+    else if (arg->inv != NULL && nlen == pow && alen <= 2 * pow)
+    {
+        Q = _nmod_vec_init(alen - pow);
+        _nmod_poly_divrem_newton_n_preinv(Q, arg->res + start, A, alen,
+                              B, pow + 1, arg->inv + start, pow, arg->mod);
+        _nmod_vec_clear(Q);
+    }
+    else
+    {
+        _nmod_poly_rem(arg->res + start, A, alen, B, nlen + 1, arg->mod);
+    }
+}
+
+void
+_nmod_poly_eval_plan_evaluate(mp_ptr ys, mp_srcptr poly, slong plen,
+                            const nmod_poly_eval_plan_t P, slong thread_limit)
+{
+    slong i, len = P->len, height, tree_height;
+    eval_level_arg_t arg;
+    mp_ptr t, u, swap;
+
+    if (len < 2 || plen < 2)
+    {
+        if (len == 1)
+            ys[0] = _nmod_poly_evaluate_nmod(poly, plen,
+                                   nmod_neg(P->tree[0][0], P->mod), P->mod);
+        else if (len != 0 && plen == 0)
+            _nmod_vec_zero(ys, len);
+        else if (len != 0 && plen == 1)
+            for (i = 0; i < len; i++)
+                ys[i] = poly[0];
+        return;
+    }
+
+    thread_limit = FLINT_MIN(thread_limit,
+                                     len / NMOD_POLY_TREE_THREAD_CUTOFF + 1);
+
+    t = _nmod_vec_init(len);
+    u = _nmod_vec_init(len);
+
+    /* initial reduction, at the level with nodes shorter than poly */
+    height = FLINT_BIT_COUNT(plen - 1) - 1;
+    tree_height = FLINT_CLOG2(len);
+    while (height >= tree_height)
+        height--;
+
+    arg.len = len;
+    arg.mod = P->mod;
+    arg.poly = poly;
+    arg.plen = plen;
+
+    for (i = height; i >= 0; i--)
+    {
+        arg.res = t;
+        arg.nodes = P->tree[i];
+        arg.inv = P->tinv[i];
+        arg.pow = WORD(1) << i;
+
+        flint_parallel_do((do_func_t) _eval_level_worker, &arg,
+             (len + arg.pow - 1) / arg.pow, thread_limit, FLINT_PARALLEL_UNIFORM);
+
+        swap = t;
+        t = u;
+        u = swap;
+
+        arg.poly = u;
+        arg.plen = 0;
+    }
+
+    _nmod_vec_set(ys, u, len);
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
+}
+
+void
+nmod_poly_eval_plan_evaluate(mp_ptr ys, const nmod_poly_t poly,
+                                             const nmod_poly_eval_plan_t P)
+{
+    _nmod_poly_eval_plan_evaluate(ys, poly->coeffs, poly->length, P,
+                                                  flint_get_num_threads());
+}
+
+typedef struct
+{
+    mp_ptr * ys;
+    const nmod_poly_struct * polys;
+    const nmod_poly_eval_plan_struct * P;
+}
+eval_vec_arg_t;
+
+static void
+_eval_vec_worker(slong j, eval_vec_arg_t * arg)
+{
+    /* the tree levels themselves use any threads left over */
+    _nmod_poly_eval_plan_evaluate(arg->ys[j], arg->polys[j].coeffs,
+            arg->polys[j].length, arg->P, flint_get_num_threads());
+}
+
+void
+nmod_poly_eval_plan_evaluate_vec(mp_ptr * ys, const nmod_poly_struct * polys,
+                                  slong num, const nmod_poly_eval_plan_t P)
+{
+    eval_vec_arg_t arg;
+
+    arg.ys = ys;
+    arg.polys = polys;
+    arg.P = P;
+
+    flint_parallel_do((do_func_t) _eval_vec_worker, &arg, num,
+                              flint_get_num_threads(), FLINT_PARALLEL_UNIFORM);
+}
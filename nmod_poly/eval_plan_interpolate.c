@@ -0,0 +1,154 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    mp_ptr poly;
+    mp_ptr t;
+    mp_ptr u;
+    mp_srcptr nodes;
+    slong pow;
+    slong len;
+    nmod_t mod;
+}
+interp_level_arg_t;
+
+/* combine the pair k of the current level into a node of the next level */
+static void
+_interp_level_worker(slong k, interp_level_arg_t * arg)
+{
+    slong pow = arg->pow;
+    slong start = 2 * pow * k;
+    slong left = arg->len - start;
+    mp_srcptr pa = arg->nodes + k * (2 * pow + 2);
+    mp_ptr pb = arg->poly + start;
+    mp_ptr t = arg->t + start;
+    mp_ptr u = arg->u + start;
+
+    if (left >= 2 * pow)
+    {
+        _nmod_poly_mul(t, pa, pow + 1, pb + pow, pow, arg->mod);
+        _nmod_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, arg->mod);
+        _nmod_vec_add(pb, t, u, 2 * pow, arg->mod);
+    }
+    else if (left > pow)
+    {
+        _nmod_poly_mul(t, pa, pow + 1, pb + pow, left - pow, arg->mod);
+        _nmod_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, arg->mod);
+        _nmod_vec_add(pb, t, u, left, arg->mod);
+    }
+}
+
+void
+_nmod_poly_eval_plan_interpolate(mp_ptr poly, mp_srcptr ys,
+                            const nmod_poly_eval_plan_t P, slong thread_limit)
+{
+    slong i, len = P->len;
+    interp_level_arg_t arg;
+
+    if (len == 0)
+        return;
+
+    thread_limit = FLINT_MIN(thread_limit,
+                                     len / NMOD_POLY_TREE_THREAD_CUTOFF + 1);
+
+    for (i = 0; i < len; i++)
+        poly[i] = nmod_mul(P->weights[i], ys[i], P->mod);
+
+    arg.poly = poly;
+    arg.t = _nmod_vec_init(len);
+    arg.u = _nmod_vec_init(len);
+    arg.len = len;
+    arg.mod = P->mod;
+
+    for (i = 0; i < FLINT_CLOG2(len); i++)
+    {
+        arg.nodes = P->tree[i];
+        arg.pow = WORD(1) << i;
+
+        flint_parallel_do((do_func_t) _interp_level_worker, &arg,
+                (len + 2 * arg.pow - 1) / (2 * arg.pow), thread_limit,
+                                                     FLINT_PARALLEL_UNIFORM);
+    }
+
+    _nmod_vec_clear(arg.t);
+    _nmod_vec_clear(arg.u);
+}
+
+void
+nmod_poly_eval_plan_interpolate(nmod_poly_t poly, mp_srcptr ys,
+                                             const nmod_poly_eval_plan_t P)
+{
+    if (P->len == 0)
+    {
+        nmod_poly_zero(poly);
+    }
+    else
+    {
+        nmod_poly_fit_length(poly, P->len);
+        poly->length = P->len;
+        _nmod_poly_eval_plan_interpolate(poly->coeffs, ys, P,
+                                                  flint_get_num_threads());
+        _nmod_poly_normalise(poly);
+    }
+}
+
+typedef struct
+{
+    nmod_poly_struct * polys;
+    const mp_srcptr * ys;
+    const nmod_poly_eval_plan_struct * P;
+}
+interp_vec_arg_t;
+
+static void
+_interp_vec_worker(slong j, interp_vec_arg_t * arg)
+{
+    nmod_poly_struct * poly = arg->polys + j;
+
+    _nmod_poly_eval_plan_interpolate(poly->coeffs, arg->ys[j], arg->P,
+                                                  flint_get_num_threads());
+}
+
+void
+nmod_poly_eval_plan_interpolate_vec(nmod_poly_struct * polys,
+        const mp_srcptr * ys, slong num, const nmod_poly_eval_plan_t P)
+{
+    interp_vec_arg_t arg;
+    slong j;
+
+    if (P->len == 0)
+    {
+        for (j = 0; j < num; j++)
+            nmod_poly_zero(polys + j);
+        return;
+    }
+
+    for (j = 0; j < num; j++)
+    {
+        nmod_poly_fit_length(polys + j, P->len);
+        polys[j].length = P->len;
+    }
+
+    arg.polys = polys;
+    arg.ys = ys;
+    arg.P = P;
+
+    flint_parallel_do((do_func_t) _interp_vec_worker, &arg, num,
+                              flint_get_num_threads(), FLINT_PARALLEL_UNIFORM);
+
+    for (j = 0; j < num; j++)
+        _nmod_poly_normalise(polys + j);
+}
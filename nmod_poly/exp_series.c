@@ -48,6 +48,7 @@ _nmod_poly_exp_series_newton(mp_ptr f, mp_ptr g,
 {
     slong a[FLINT_BITS];
     slong i, m, l, r;
+    nmod_poly_mul_precache_t P;
     mp_ptr t, hprime;
     int inverse;
 
@@ -85,16 +86,28 @@ _nmod_poly_exp_series_newton(mp_ptr f, mp_ptr g,
             _nmod_poly_mullow(t, hprime, l, f, m, r, mod);
         else
             _nmod_poly_mullow(t, f, m, hprime, l, r, mod);
-        _nmod_poly_mullow(g + m, g, n - m, t + m - 1, r + 1 - m, n - m, mod);
-        _nmod_poly_integral_offset(g + m, g + m, n - m, m, mod);
-        _nmod_poly_mullow(f + m, f, n - m, g + m, n - m, n - m, mod);
 
         /* g := exp(-h) + O(x^n); not needed if we only want exp(x) */
         if (i != 0 || inverse)
         {
-            _nmod_poly_mullow(t, f, n, g, m, n, mod);
-            _nmod_poly_mullow(g + m, g, m, t + m, n - m, n - m, mod);
+            /* the low m terms of g enter three products of this step */
+            _nmod_poly_mul_precache_init(P, g, m, n, mod);
+
+            _nmod_poly_mullow_precache(g + m, t + m - 1, r + 1 - m, n - m, P);
+            _nmod_poly_integral_offset(g + m, g + m, n - m, m, mod);
+            _nmod_poly_mullow(f + m, f, n - m, g + m, n - m, n - m, mod);
+
+            _nmod_poly_mullow_precache(t, f, n, n, P);
+            _nmod_poly_mullow_precache(g + m, t + m, n - m, n - m, P);
             _nmod_vec_neg(g + m, g + m, n - m, mod);
+
+            _nmod_poly_mul_precache_clear(P);
+        }
+        else
+        {
+            _nmod_poly_mullow(g + m, g, n - m, t + m - 1, r + 1 - m, n - m, mod);
+            _nmod_poly_integral_offset(g + m, g + m, n - m, m, mod);
+            _nmod_poly_mullow(f + m, f, n - m, g + m, n - m, n - m, mod);
         }
     }
 
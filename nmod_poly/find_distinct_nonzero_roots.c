@@ -11,6 +11,7 @@
 
 #include "nmod_poly.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
 
 /* split f assuming that f has degree(f) distinct nonzero roots in Fp */
 void _nmod_poly_split_rabin(
@@ -51,6 +52,157 @@ try_again:
     return;
 }
 
+typedef struct
+{
+    mp_ptr roots;
+    nmod_poly_struct * f;
+    flint_rand_s * randstate;
+}
+_split_arg_t;
+
+static void _split_roots(mp_ptr roots, nmod_poly_t f, flint_rand_t randstate);
+
+static void _split_worker(void * arg_ptr)
+{
+    _split_arg_t * arg = (_split_arg_t *) arg_ptr;
+
+    _split_roots(arg->roots, arg->f, arg->randstate);
+}
+
+/*
+    Write the roots of f to roots[0], ..., roots[deg(f) - 1], assuming that
+    f is monic and has deg(f) distinct nonzero roots. f is clobbered.
+*/
+static void _split_roots(mp_ptr roots, nmod_poly_t f, flint_rand_t randstate)
+{
+    slong i, sp, roots_idx;
+    nmod_poly_t a, b, t, t2;
+    nmod_poly_struct stack[FLINT_BITS + 1];
+
+    if (nmod_poly_degree(f) <= 0)
+        return;
+
+    if (nmod_poly_degree(f) == 1)
+    {
+        roots[0] = nmod_neg(f->coeffs[0], f->mod);
+        return;
+    }
+
+    nmod_poly_init_mod(t, f->mod);
+    nmod_poly_init_mod(t2, f->mod);
+
+    if (nmod_poly_degree(f) >= NMOD_POLY_SPLIT_THREAD_CUTOFF &&
+        flint_get_num_threads() > 1)
+    {
+        /* split once and hand both halves to the tree */
+        nmod_poly_init_mod(a, f->mod);
+        nmod_poly_init_mod(b, f->mod);
+
+        _nmod_poly_split_rabin(a, b, f, t, t2, randstate);
+
+        nmod_poly_clear(t);
+        nmod_poly_clear(t2);
+
+        _nmod_poly_split_rabin_roots(roots, a, b, randstate);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+
+        return;
+    }
+
+    for (i = 0; i <= FLINT_BITS; i++)
+        nmod_poly_init_mod(stack + i, f->mod);
+
+    roots_idx = 0;
+    nmod_poly_swap(stack + 0, f);
+
+    sp = 1;
+    while (sp > 0)
+    {
+        FLINT_ASSERT(sp < FLINT_BITS);
+        sp--;
+        nmod_poly_swap(f, stack + sp);
+
+        FLINT_ASSERT(nmod_poly_degree(f) > 0);
+        if (nmod_poly_degree(f) == 1)
+        {
+            FLINT_ASSERT(f->coeffs[0] != 0);
+            FLINT_ASSERT(f->coeffs[1] == 1);
+            roots[roots_idx] = nmod_neg(f->coeffs[0], f->mod);
+            roots_idx++;
+        }
+        else
+        {
+            _nmod_poly_split_rabin(stack + sp + 0, stack + sp + 1, f, t, t2, randstate);
+            FLINT_ASSERT(FLINT_BIT_COUNT(nmod_poly_degree(stack + sp + 1)) <= FLINT_BITS - sp - 1);
+            sp += 2;
+        }
+    }
+
+    for (i = 0; i <= FLINT_BITS; i++)
+        nmod_poly_clear(stack + i);
+
+    nmod_poly_clear(t);
+    nmod_poly_clear(t2);
+}
+
+/*
+    Write the roots of a to roots[0], ..., roots[deg(a) - 1] and those of b
+    to the following deg(b) entries, assuming that a and b are monic and
+    have distinct nonzero roots. The splitting tree is processed in
+    parallel: the two subtrees of a node are independent and one of them
+    is handed to a worker together with half of the available threads.
+    a and b are clobbered.
+*/
+void _nmod_poly_split_rabin_roots(mp_ptr roots, nmod_poly_t a,
+                                        nmod_poly_t b, flint_rand_t randstate)
+{
+    slong da = FLINT_MAX(nmod_poly_degree(a), 0);
+    slong nt, nw = 0, nw_save;
+    thread_pool_handle * threads = NULL;
+
+    nt = flint_get_num_threads();
+
+    if (nmod_poly_degree(b) > 1 && nt > 1 &&
+        nmod_poly_degree(a) + nmod_poly_degree(b) >= NMOD_POLY_SPLIT_THREAD_CUTOFF)
+    {
+        nw = flint_request_threads(&threads, FLINT_MIN(nt, 2));
+    }
+
+    if (nw > 0)
+    {
+        _split_arg_t arg;
+        flint_rand_t state2;
+
+        flint_randinit(state2);
+        flint_randseed(state2, n_randlimb(randstate), n_randlimb(randstate));
+
+        arg.roots = roots + da;
+        arg.f = b;
+        arg.randstate = state2;
+
+        nw_save = flint_set_num_workers(nt - nt / 2 - 1);
+
+        thread_pool_wake(global_thread_pool, threads[0], nt / 2 - 1,
+                                                          _split_worker, &arg);
+
+        _split_roots(roots, a, randstate);
+
+        flint_reset_num_workers(nw_save);
+        thread_pool_wait(global_thread_pool, threads[0]);
+
+        flint_randclear(state2);
+    }
+    else
+    {
+        _split_roots(roots, a, randstate);
+        _split_roots(roots + da, b, randstate);
+    }
+
+    flint_give_back_threads(threads, nw);
+}
+
 /*
     If P has deg(P) distinct nonzero roots of P, fill them in and return 1.
     Otherwise return 0. Function is undefined for zero P.
@@ -62,10 +214,7 @@ int nmod_poly_find_distinct_nonzero_roots(
 {
     mp_limb_t a0, a1;
     int success;
-    slong i, roots_idx, sp;
-    nmod_poly_struct * a , * b;
-    nmod_poly_t f, t, t2;
-    nmod_poly_struct stack[FLINT_BITS + 1];
+    nmod_poly_t a, b, f, t, t2;
     flint_rand_t randstate;
     slong d = nmod_poly_degree(P);
 
@@ -94,23 +243,19 @@ int nmod_poly_find_distinct_nonzero_roots(
     nmod_poly_init_mod(t, P->mod);
     nmod_poly_init_mod(t2, P->mod);
     nmod_poly_init_mod(f, P->mod);
-    for (i = 0; i <= FLINT_BITS; i++)
-        nmod_poly_init_mod(stack + i, P->mod);
-
-    roots_idx = 0;
+    nmod_poly_init_mod(a, P->mod);
+    nmod_poly_init_mod(b, P->mod);
 
     nmod_poly_make_monic(f, P);
     nmod_poly_reverse(t, f, f->length);
     nmod_poly_inv_series_newton(t2, t, t->length);
 
-    a = stack + 0;
     nmod_poly_zero(a);
     nmod_poly_set_coeff_ui(a, 1, 1);
     nmod_poly_powmod_ui_binexp_preinv(t, a, (P->mod.n - 1)/2, f, t2);
     nmod_poly_sub_ui(t, t, 1);
     nmod_poly_gcd(a, t, f);
 
-    b = stack + 1;
     nmod_poly_add_ui(t, t, 2);
     nmod_poly_gcd(b, t, f);
 
@@ -120,36 +265,7 @@ int nmod_poly_find_distinct_nonzero_roots(
         goto cleanup;
     }
 
-    /* deg a >= deg b */
-    if (nmod_poly_degree(a) < nmod_poly_degree(b))
-    {
-        nmod_poly_swap(a, b);
-    }
-
-    sp = nmod_poly_degree(b) > 0 ? 2 : 1;
-    while (sp > 0)
-    {
-        FLINT_ASSERT(sp < FLINT_BITS);
-        sp--;
-        nmod_poly_swap(f, stack + sp);
-
-        FLINT_ASSERT(nmod_poly_degree(f) > 0);
-        if (nmod_poly_degree(f) == 1)
-        {
-            a0 = nmod_poly_get_coeff_ui(f, 0);
-            a1 = nmod_poly_get_coeff_ui(f, 1);
-            FLINT_ASSERT(a0 != 0);
-            FLINT_ASSERT(a1 == 1);
-            roots[roots_idx] = P->mod.n - a0;
-            roots_idx++;
-        }
-        else
-        {
-            _nmod_poly_split_rabin(stack + sp + 0, stack + sp + 1, f, t, t2, randstate);
-            FLINT_ASSERT(FLINT_BIT_COUNT(nmod_poly_degree(stack + sp + 1)) <= FLINT_BITS - sp - 1);
-            sp += 2;
-        }
-    }
+    _nmod_poly_split_rabin_roots(roots, a, b, randstate);
 
     success = 1;
 
@@ -159,10 +275,8 @@ cleanup:
     nmod_poly_clear(t);
     nmod_poly_clear(t2);
     nmod_poly_clear(f);
-    for (i = 0; i <= FLINT_BITS; i++)
-        nmod_poly_clear(stack + i);
-
-    FLINT_ASSERT((!success) || roots_idx == d);
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
 
     return success;
 }
@@ -18,6 +18,7 @@
 #include "nmod_poly.h"
 #include "nmod_poly_mat.h"
 #include "mpn_extras.h"
+#include "thread_support.h"
 
 /*
     We define a whole bunch of macros here which essentially provide 
@@ -93,6 +94,60 @@ do {                                                                \
     }                                                               \
 } while (0)
 
+/*
+    The products in a 2x2 matrix product, or in the application of a
+    matrix to a vector, are independent. For long enough polynomials
+    they are distributed over the thread pool.
+ */
+
+typedef struct
+{
+    mp_ptr C;
+    slong lenC;
+    mp_srcptr A;
+    slong lenA;
+    mp_srcptr B;
+    slong lenB;
+}
+__mul_arg_t;
+
+typedef struct
+{
+    __mul_arg_t * args;
+    nmod_t mod;
+}
+__mul_many_arg_t;
+
+static __inline__ void __mul_arg(__mul_arg_t * x, mp_ptr C, 
+    mp_srcptr A, slong lenA, mp_srcptr B, slong lenB)
+{
+    x->C = C;
+    x->A = A;
+    x->lenA = lenA;
+    x->B = B;
+    x->lenB = lenB;
+}
+
+static void __mul_worker(slong i, __mul_many_arg_t * arg)
+{
+    __mul_arg_t * x = arg->args + i;
+    nmod_t mod = arg->mod;
+
+    __mul(x->C, x->lenC, x->A, x->lenA, x->B, x->lenB);
+}
+
+static void __mul_many(__mul_arg_t * args, slong n, slong len, nmod_t mod)
+{
+    __mul_many_arg_t arg;
+
+    arg.args = args;
+    arg.mod = mod;
+
+    flint_parallel_do((do_func_t) __mul_worker, &arg, n,
+                   (len < NMOD_POLY_HGCD_THREAD_CUTOFF) ? 1 : n,
+                                                     FLINT_PARALLEL_UNIFORM);
+}
+
 static __inline__ void __mat_one(mp_ptr *M, slong *lenM)
 {
     M[0][0] = WORD(1);
@@ -182,6 +237,55 @@ static void __mat_mul_strassen(mp_ptr *C, slong *lenC,
     __add(C[0], lenC[0], C[0], lenC[0], T0, lenT0);
 }
 
+/*
+    Computes the matrix product C of the two 2x2 matrices A and B, 
+    using classical multiplication with all eight polynomial products 
+    performed in parallel.
+
+    Does not support aliasing.
+
+    Expects T0, T1 to be temporary space sufficient for any of the 
+    polynomial products involved.
+ */
+
+static void __mat_mul_threaded(mp_ptr *C, slong *lenC, 
+    mp_ptr *A, slong *lenA, mp_ptr *B, slong *lenB, mp_ptr T0, mp_ptr T1, 
+    slong min, nmod_t mod)
+{
+    __mul_arg_t args[8];
+    mp_ptr T[4];
+    slong i, lenT = 0;
+
+    for (i = 0; i < 4; i++)
+        lenT = FLINT_MAX(lenT, lenA[i]);
+    lenT += FLINT_MAX(FLINT_MAX(lenB[0], lenB[1]), FLINT_MAX(lenB[2], lenB[3]));
+
+    T[0] = T0;
+    T[1] = T1;
+    T[2] = _nmod_vec_init(lenT);
+    T[3] = _nmod_vec_init(lenT);
+
+    /* C[i] = A[i & 2] B[i & 1] + A[(i & 2) + 1] B[(i & 1) + 2] */
+    for (i = 0; i < 4; i++)
+    {
+        __mul_arg(args + i, C[i], A[i & 2], lenA[i & 2],
+                                  B[i & 1], lenB[i & 1]);
+        __mul_arg(args + 4 + i, T[i], A[(i & 2) + 1], lenA[(i & 2) + 1],
+                                      B[(i & 1) + 2], lenB[(i & 1) + 2]);
+    }
+
+    __mul_many(args, 8, min, mod);
+
+    for (i = 0; i < 4; i++)
+    {
+        lenC[i] = args[i].lenC;
+        __add(C[i], lenC[i], C[i], lenC[i], T[i], args[4 + i].lenC);
+    }
+
+    _nmod_vec_clear(T[2]);
+    _nmod_vec_clear(T[3]);
+}
+
 /*
     Computs the matrix product C of the two 2x2 matrices A and B, 
     using either classical or Strassen multiplication depending 
@@ -211,6 +315,10 @@ static void __mat_mul(mp_ptr *C, slong *lenC,
     {
         __mat_mul_classical(C, lenC, A, lenA, B, lenB, T0, mod);
     }
+    else if (min >= NMOD_POLY_HGCD_THREAD_CUTOFF && flint_get_num_threads() > 1)
+    {
+        __mat_mul_threaded(C, lenC, A, lenA, B, lenB, T0, T1, min, mod);
+    }
     else
     {
         __mat_mul_strassen(C, lenC, A, lenA, B, lenB, T0, T1, mod);
@@ -353,6 +461,8 @@ slong _nmod_poly_hgcd_recursive(mp_ptr *M, slong *lenM,
         slong lenR[4], lenS[4];
         slong sgnR, sgnS;
 
+        __mul_arg_t args[4];
+
         a2 = P;
         b2 = a2 + lena;
         a3 = b2 + lena;
@@ -403,8 +513,16 @@ slong _nmod_poly_hgcd_recursive(mp_ptr *M, slong *lenM,
         __attach_truncate(s, lens, (mp_ptr) a, lena, m);
         __attach_truncate(t, lent, (mp_ptr) b, lenb, m);
 
-        __mul(b2, lenb2, R[2], lenR[2], s, lens);
-        __mul(T0, lenT0, R[0], lenR[0], t, lent);
+        /* d is free until the division below */
+        __mul_arg(args + 0, b2, R[2], lenR[2], s, lens);
+        __mul_arg(args + 1, T0, R[0], lenR[0], t, lent);
+        __mul_arg(args + 2, a2, R[3], lenR[3], s, lens);
+        __mul_arg(args + 3, d, R[1], lenR[1], t, lent);
+        __mul_many(args, 4, lena0, mod);
+        lenb2 = args[0].lenC;
+        lenT0 = args[1].lenC;
+        lena2 = args[2].lenC;
+        lend = args[3].lenC;
 
         if (sgnR < 0)
             __sub(b2, lenb2, b2, lenb2, T0, lenT0);
@@ -418,13 +536,10 @@ slong _nmod_poly_hgcd_recursive(mp_ptr *M, slong *lenM,
         lenb2 = FLINT_MAX(m + lenb3, lenb2);
         MPN_NORM(b2, lenb2);
 
-        __mul(a2, lena2, R[3], lenR[3], s, lens);
-        __mul(T0, lenT0, R[1], lenR[1], t, lent);
-
         if (sgnR < 0)
-            __sub(a2, lena2, T0, lenT0, a2, lena2);
+            __sub(a2, lena2, d, lend, a2, lena2);
         else
-            __sub(a2, lena2, a2, lena2, T0, lenT0);
+            __sub(a2, lena2, a2, lena2, d, lend);
 
         flint_mpn_zero(a2 + lena2, m + lena3 - lena2);
         __attach_shift(a4, lena4, a2, lena2, m);
@@ -532,8 +647,16 @@ slong _nmod_poly_hgcd_recursive(mp_ptr *M, slong *lenM,
             __attach_truncate(s, lens, b2, lenb2, k);
             __attach_truncate(t, lent, d, lend, k);
 
-            __mul(B, *lenB, S[2], lenS[2], s, lens);
-            __mul(T0, lenT0, S[0], lenS[0], t, lent);
+            /* a2 is free from here on */
+            __mul_arg(args + 0, B, S[2], lenS[2], s, lens);
+            __mul_arg(args + 1, T0, S[0], lenS[0], t, lent);
+            __mul_arg(args + 2, A, S[3], lenS[3], s, lens);
+            __mul_arg(args + 3, a2, S[1], lenS[1], t, lent);
+            __mul_many(args, 4, lenc0, mod);
+            *lenB = args[0].lenC;
+            lenT0 = args[1].lenC;
+            *lenA = args[2].lenC;
+            lena2 = args[3].lenC;
 
             if (sgnS < 0)
                 __sub(B, *lenB, B, *lenB, T0, lenT0);
@@ -546,13 +669,10 @@ slong _nmod_poly_hgcd_recursive(mp_ptr *M, slong *lenM,
             *lenB = FLINT_MAX(k + lenb3, *lenB);
             MPN_NORM(B, *lenB);
 
-            __mul(A, *lenA, S[3], lenS[3], s, lens);
-            __mul(T0, lenT0, S[1], lenS[1], t, lent);
-
             if (sgnS < 0)
-                __sub(A, *lenA, T0, lenT0, A, *lenA);
+                __sub(A, *lenA, a2, lena2, A, *lenA);
             else
-                __sub(A, *lenA, A, *lenA, T0, lenT0);
+                __sub(A, *lenA, A, *lenA, a2, lena2);
 
             flint_mpn_zero(A + *lenA, k + lena3 - *lenA);
             __attach_shift(a4, lena4, A, *lenA, k);
@@ -19,7 +19,7 @@ void
 _nmod_poly_interpolation_weights(mp_ptr w, const mp_ptr * tree, slong len, nmod_t mod)
 {
     mp_ptr tmp;
-    slong i, n, height;
+    slong n, height;
 
     if (len == 0)
         return;
@@ -40,8 +40,7 @@ _nmod_poly_interpolation_weights(mp_ptr w, const mp_ptr * tree, slong len, nmod_
     _nmod_poly_derivative(tmp, tmp, len + 1, mod);
     _nmod_poly_evaluate_nmod_vec_fast_precomp(w, tmp, len, tree, len, mod);
 
-    for (i = 0; i < len; i++)
-        w[i] = n_invmod(w[i], mod.n);
+    _nmod_vec_inv(w, w, len, mod);
 
     _nmod_vec_clear(tmp);
 }
@@ -18,12 +18,6 @@
 #include "nmod_poly.h"
 #include "ulong_extras.h"
 
-#define MULLOW(z, x, xn, y, yn, nn, mod) \
-    if ((xn) >= (yn)) \
-        _nmod_poly_mullow(z, x, xn, y, yn, nn, mod); \
-    else \
-        _nmod_poly_mullow(z, y, yn, x, xn, nn, mod); \
-
 void
 _nmod_poly_inv_series_newton(mp_ptr Qinv, mp_srcptr Q, slong Qlen, slong n, nmod_t mod)
 {
@@ -43,6 +37,7 @@ _nmod_poly_inv_series_newton(mp_ptr Qinv, mp_srcptr Q, slong Qlen, slong n, nmod
     else
     {
         slong *a, i, m, Qnlen, Wlen, W2len;
+        nmod_poly_mul_precache_t P;
         mp_ptr W;
 
         for (i = 1; (WORD(1) << i) < n; i++) ;
@@ -64,8 +59,13 @@ _nmod_poly_inv_series_newton(mp_ptr Qinv, mp_srcptr Q, slong Qlen, slong n, nmod
             Qnlen = FLINT_MIN(Qlen, n);
             Wlen = FLINT_MIN(Qnlen + m - 1, n);
             W2len = Wlen - m;
-            MULLOW(W, Q, Qnlen, Qinv, m, Wlen, mod);
-            MULLOW(Qinv + m, Qinv, m, W + m, W2len, n - m, mod);
+
+            /* both products are by Qinv, so transform it once */
+            _nmod_poly_mul_precache_init(P, Qinv, m, Qnlen, mod);
+            _nmod_poly_mullow_precache(W, Q, Qnlen, Wlen, P);
+            _nmod_poly_mullow_precache(Qinv + m, W + m, W2len, n - m, P);
+            _nmod_poly_mul_precache_clear(P);
+
             _nmod_vec_neg(Qinv + m, Qinv + m, n - m, mod);
         }
 
@@ -37,17 +37,16 @@ __nmod_poly_invsqrt_series_prealloc(mp_ptr g,
 
     __nmod_poly_invsqrt_series_prealloc(g, h, t, u, m, mod);
 
-    _nmod_vec_zero(g + m, n - m);
-
+    /*
+        g <- g - g (h g^2 - 1) / 2, where h g^2 - 1 = O(x^m), so only
+        its coefficients m, ..., n - 1 are needed
+    */
     _nmod_poly_mul(t, g, m, g, m, mod);
-    if (2*m - 1 < n)
-        t[n-1] = UWORD(0);
-
-    _nmod_poly_mullow(u, t, n, g, n, n, mod);
-    _nmod_poly_mullow(t, u, n, h, n, n, mod);
+    _nmod_poly_mullow(u, h, n, t, 2*m - 1, n, mod);
+    _nmod_poly_mullow(t, g, m, u + m, n - m, n - m, mod);
 
     c = n_invmod(mod.n - 2, mod.n);
-    _nmod_vec_scalar_mul_nmod(g + m, t + m, n - m, c, mod);
+    _nmod_vec_scalar_mul_nmod(g + m, t, n - m, c, mod);
 
     if (alloc)
     {
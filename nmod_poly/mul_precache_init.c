@@ -0,0 +1,46 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "nmod_poly.h"
+
+void
+_nmod_poly_mul_precache_init(nmod_poly_mul_precache_t P,
+                       mp_srcptr poly, slong len, slong maxlen, nmod_t mod)
+{
+    flint_bitcnt_t bits;
+    slong limbs, maxlimbs;
+    mp_ptr t;
+
+    P->poly = poly;
+    P->len = len;
+    P->maxlen = maxlen;
+    P->mod = mod;
+    P->bits = 0;
+
+    if (len < 2 || maxlen < 2)
+        return;
+
+    bits = 2*(FLINT_BITS - mod.norm) + FLINT_BIT_COUNT(FLINT_MIN(len, maxlen));
+    limbs = (len*bits - 1)/FLINT_BITS + 1;
+    maxlimbs = (maxlen*bits - 1)/FLINT_BITS + 1;
+
+    if (FLINT_MIN(limbs, maxlimbs) < NMOD_POLY_MUL_PRECACHE_CUTOFF ||
+        limbs > NMOD_POLY_MUL_PRECACHE_LIMIT)
+        return;
+
+    t = flint_malloc(limbs*sizeof(mp_limb_t));
+    _nmod_poly_bit_pack(t, poly, len, bits);
+    flint_mpn_mul_precache_init(P->pre, t, limbs, maxlimbs);
+    flint_free(t);
+
+    P->bits = bits;
+}
@@ -0,0 +1,48 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "nmod_poly.h"
+
+void
+_nmod_poly_mullow_precache(mp_ptr res, mp_srcptr poly, slong len, slong n,
+                                           const nmod_poly_mul_precache_t P)
+{
+    flint_bitcnt_t bits = P->bits;
+    slong limbs1, limbs2;
+    mp_ptr t1, t2;
+
+    FLINT_ASSERT(len <= P->maxlen);
+    FLINT_ASSERT(n <= len + P->len - 1);
+
+    limbs1 = (len*bits - 1)/FLINT_BITS + 1;
+
+    /* a short operand is not worth a transform of the full cached size */
+    if (bits == 0 || len < 2 || 4*limbs1 < P->pre->n1)
+    {
+        if (len >= P->len)
+            _nmod_poly_mullow(res, poly, len, P->poly, P->len, n, P->mod);
+        else
+            _nmod_poly_mullow(res, P->poly, P->len, poly, len, n, P->mod);
+        return;
+    }
+
+    limbs2 = P->pre->n2;
+
+    t1 = flint_malloc((2*limbs1 + limbs2)*sizeof(mp_limb_t));
+    t2 = t1 + limbs1;
+
+    _nmod_poly_bit_pack(t1, poly, len, bits);
+    flint_mpn_mul_precache(t2, t1, limbs1, P->pre);
+    _nmod_poly_bit_unpack(res, n, t2, bits, P->mod);
+
+    flint_free(t1);
+}
@@ -10,6 +10,7 @@
 */
 
 #include "nmod_poly.h"
+#include "thread_support.h"
 
 void nmod_poly_multi_crt_init(nmod_poly_multi_crt_t P)
 {
@@ -299,6 +300,7 @@ void nmod_poly_multi_crt_precomp(
 {
     slong i;
     nmod_poly_struct * out;
+    const nmod_poly_struct ** in;
     TMP_INIT;
 
     TMP_START;
@@ -310,7 +312,21 @@ void nmod_poly_multi_crt_precomp(
     }
 
     nmod_poly_swap(out + 0, output);
-    _nmod_poly_multi_crt_run(out, P, inputs);
+    if (flint_get_num_threads() > 1)
+    {
+        /* a program of length l combines at most l + 1 inputs */
+        in = (const nmod_poly_struct **) TMP_ALLOC((P->length + 1)
+                                                 *sizeof(nmod_poly_struct *));
+        for (i = 0; i <= P->length; i++)
+            in[i] = inputs + i;
+
+        _nmod_poly_multi_crt_run_p_threaded(out, P,
+                                        (const nmod_poly_struct * const *) in);
+    }
+    else
+    {
+        _nmod_poly_multi_crt_run(out, P, inputs);
+    }
     nmod_poly_swap(out + 0, output);
 
     for (i = 0; i < P->localsize; i++)
@@ -339,7 +355,7 @@ void nmod_poly_multi_crt_precomp_p(
     }
 
     nmod_poly_swap(out + 0, output);
-    _nmod_poly_multi_crt_run_p(out, P, inputs);
+    _nmod_poly_multi_crt_run_p_threaded(out, P, inputs);
     nmod_poly_swap(out + 0, output);
 
     for (i = 0; i < P->localsize; i++)
@@ -357,38 +373,15 @@ int nmod_poly_multi_crt(
     slong len)
 {
     int success;
-    slong i;
     nmod_poly_multi_crt_t P;
-    nmod_poly_struct * out;
-    TMP_INIT;
 
     FLINT_ASSERT(len > 0);
 
-    TMP_START;
-
     nmod_poly_multi_crt_init(P);
     success = nmod_poly_multi_crt_precompute(P, moduli, len);
-
-    out = (nmod_poly_struct *) TMP_ALLOC(P->localsize
-                                                    *sizeof(nmod_poly_struct));
-    for (i = 0; i < P->localsize; i++)
-    {
-        nmod_poly_init_mod(out + i, values[0].mod);
-    }
-
-    nmod_poly_swap(out + 0, output);
-    _nmod_poly_multi_crt_run(out, P, values);
-    nmod_poly_swap(out + 0, output);
-
-    for (i = 0; i < P->localsize; i++)
-    {
-        nmod_poly_clear(out + i);
-    }
-
+    nmod_poly_multi_crt_precomp(output, P, values);
     nmod_poly_multi_crt_clear(P);
 
-    TMP_END;
-
     return success;
 }
 
@@ -451,10 +444,13 @@ void _nmod_poly_multi_crt_run(
     }
 }
 
-void _nmod_poly_multi_crt_run_p(
+/* run the instructions [start, stop) of P */
+static void _nmod_poly_multi_crt_run_range(
     nmod_poly_struct * outputs,
     const nmod_poly_multi_crt_t P,
-    const nmod_poly_struct * const * inputs)
+    const nmod_poly_struct * const * inputs,
+    slong start,
+    slong stop)
 {
     slong i;
     slong a, b, c;
@@ -464,7 +460,7 @@ void _nmod_poly_multi_crt_run_p(
     t1 = outputs + P->temp1loc;
     t2 = outputs + P->temp2loc;
 
-    for (i = 0; i < P->length; i++)
+    for (i = start; i < stop; i++)
     {
         a = P->prog[i].a_idx;
         b = P->prog[i].b_idx;
@@ -491,11 +487,149 @@ void _nmod_poly_multi_crt_run_p(
         {
             nmod_poly_rem(A, t1, P->prog[i].modulus);
         }
+    }
+}
 
-        /* last calculation should write answer to outputs[0] */
-        if (i + 1 >= P->length)
-        {
-            FLINT_ASSERT(A == outputs + 0);
-        }
+void _nmod_poly_multi_crt_run_p(
+    nmod_poly_struct * outputs,
+    const nmod_poly_multi_crt_t P,
+    const nmod_poly_struct * const * inputs)
+{
+    _nmod_poly_multi_crt_run_range(outputs, P, inputs, 0, P->length);
+
+    /* last calculation should write answer to outputs[0] */
+    FLINT_ASSERT(P->length < 1 || P->prog[P->length - 1].a_idx == 0);
+}
+
+typedef struct
+{
+    nmod_poly_struct * outputs;
+    const nmod_poly_multi_crt_struct * P;
+    const nmod_poly_struct * const * inputs;
+    const slong * start;
+    slong root;
+}
+_multi_crt_arg_t;
+
+static void _nmod_poly_multi_crt_run_tree(nmod_poly_struct * outputs,
+        const nmod_poly_multi_crt_t P, const nmod_poly_struct * const * inputs,
+                                               const slong * start, slong i);
+
+static void _multi_crt_worker(void * arg_ptr)
+{
+    _multi_crt_arg_t * arg = (_multi_crt_arg_t *) arg_ptr;
+
+    _nmod_poly_multi_crt_run_tree(arg->outputs, arg->P, arg->inputs,
+                                                       arg->start, arg->root);
+}
+
+/*
+    Run the subtree of the program whose root is instruction i, the
+    instructions of which are start[i], ..., i. The subtrees computing B
+    and C are independent. If they are large enough the one for B is given
+    to a worker with its own workspace, together with half of the threads.
+*/
+static void _nmod_poly_multi_crt_run_tree(
+    nmod_poly_struct * outputs,
+    const nmod_poly_multi_crt_t P,
+    const nmod_poly_struct * const * inputs,
+    const slong * start,
+    slong i)
+{
+    slong j, b, c;
+    slong nt, nw = 0, nw_save;
+    thread_pool_handle * threads = NULL;
+
+    b = P->prog[i].b_idx;
+    c = P->prog[i].c_idx;
+
+    if (P->prog[i].modulus->length < NMOD_POLY_MULTI_CRT_THREAD_CUTOFF)
+    {
+        _nmod_poly_multi_crt_run_range(outputs, P, inputs, start[i], i + 1);
+        return;
+    }
+
+    nt = flint_get_num_threads();
+
+    if (b >= 0 && c >= 0 && nt > 1)
+        nw = flint_request_threads(&threads, FLINT_MIN(nt, 2));
+
+    if (nw > 0)
+    {
+        _multi_crt_arg_t arg;
+        nmod_poly_struct * W;
+
+        W = (nmod_poly_struct *) flint_malloc(P->localsize
+                                                    *sizeof(nmod_poly_struct));
+        for (j = 0; j < P->localsize; j++)
+            nmod_poly_init_mod(W + j, P->prog[i].modulus->mod);
+
+        /* C is computed by instruction i - 1, B just before its subtree */
+        arg.outputs = W;
+        arg.P = P;
+        arg.inputs = inputs;
+        arg.start = start;
+        arg.root = start[i - 1] - 1;
+
+        nw_save = flint_set_num_workers(nt - nt / 2 - 1);
+
+        thread_pool_wake(global_thread_pool, threads[0], nt / 2 - 1,
+                                                     _multi_crt_worker, &arg);
+
+        _nmod_poly_multi_crt_run_tree(outputs, P, inputs, start, i - 1);
+
+        flint_reset_num_workers(nw_save);
+        thread_pool_wait(global_thread_pool, threads[0]);
+
+        nmod_poly_swap(outputs + b, W + b);
+
+        for (j = 0; j < P->localsize; j++)
+            nmod_poly_clear(W + j);
+        flint_free(W);
+    }
+    else
+    {
+        /* B before C, as in the straight line program */
+        if (b >= 0)
+            _nmod_poly_multi_crt_run_tree(outputs, P, inputs, start,
+                                      c >= 0 ? start[i - 1] - 1 : i - 1);
+        if (c >= 0)
+            _nmod_poly_multi_crt_run_tree(outputs, P, inputs, start, i - 1);
+    }
+
+    flint_give_back_threads(threads, nw);
+
+    _nmod_poly_multi_crt_run_range(outputs, P, inputs, i, i + 1);
+}
+
+void _nmod_poly_multi_crt_run_p_threaded(
+    nmod_poly_struct * outputs,
+    const nmod_poly_multi_crt_t P,
+    const nmod_poly_struct * const * inputs)
+{
+    slong i, j;
+    slong * start;
+
+    if (P->length < 3 || flint_get_num_threads() < 2 ||
+        P->prog[P->length - 1].modulus->length < NMOD_POLY_MULTI_CRT_THREAD_CUTOFF)
+    {
+        _nmod_poly_multi_crt_run_p(outputs, P, inputs);
+        return;
     }
+
+    /* start[i] is the first instruction of the subtree rooted at i */
+    start = (slong *) flint_malloc(P->length*sizeof(slong));
+    for (i = 0; i < P->length; i++)
+    {
+        j = i;
+        if (P->prog[i].c_idx >= 0)
+            j = start[j - 1];
+        if (P->prog[i].b_idx >= 0)
+            j = start[j - 1];
+        start[i] = j;
+    }
+
+    _nmod_poly_multi_crt_run_tree(outputs, P, inputs, start, P->length - 1);
+
+    flint_free(start);
 }
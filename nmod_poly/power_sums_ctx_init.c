@@ -0,0 +1,70 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_power_sums_ctx_init(nmod_poly_power_sums_ctx_t ctx,
+                                                      const nmod_poly_t poly)
+{
+    slong j, len = poly->length, d = len - 1;
+    mp_ptr b;
+
+    if (len == 0)
+    {
+        flint_printf
+            ("Exception (nmod_poly_power_sums_ctx_init). Zero polynomial.\n");
+        flint_abort();
+    }
+
+    ctx->mod = poly->mod;
+    ctx->len = len;
+    ctx->n = 0;
+    ctx->alloc = FLINT_MAX(d, 1);
+    ctx->sums = _nmod_vec_init(ctx->alloc);
+    ctx->rev = _nmod_vec_init(len);
+    ctx->inv = NULL;
+
+    if (poly->coeffs[d] != 1)
+        _nmod_vec_scalar_mul_nmod(ctx->rev, poly->coeffs, len,
+                             nmod_inv(poly->coeffs[d], ctx->mod), ctx->mod);
+    else
+        _nmod_vec_set(ctx->rev, poly->coeffs, len);
+
+    _nmod_poly_reverse(ctx->rev, ctx->rev, len, len);
+
+    if (d == 0)
+        return;
+
+    ctx->inv = _nmod_vec_init(d);
+    _nmod_poly_inv_series(ctx->inv, ctx->rev, len, d, ctx->mod);
+
+    /* reverse of the derivative */
+    b = _nmod_vec_init(d);
+    for (j = 0; j < d; j++)
+        b[j] = nmod_mul(ctx->rev[j], (d - j) % ctx->mod.n, ctx->mod);
+
+    _nmod_poly_mullow(ctx->sums, ctx->inv, d, b, d, d, ctx->mod);
+    ctx->n = d;
+
+    _nmod_vec_clear(b);
+}
+
+void
+nmod_poly_power_sums_ctx_clear(nmod_poly_power_sums_ctx_t ctx)
+{
+    _nmod_vec_clear(ctx->sums);
+    _nmod_vec_clear(ctx->rev);
+
+    if (ctx->inv != NULL)
+        _nmod_vec_clear(ctx->inv);
+}
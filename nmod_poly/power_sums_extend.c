@@ -0,0 +1,45 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    The power sums are the coefficients of rev(f') / rev(f), and the
+    product rev(f) * (res, m) vanishes in degrees m to n - 1. Each block of
+    up to len - 1 new terms is thus the middle product of rev(f) with the
+    last len - 1 known terms, multiplied by -inv.
+*/
+void
+_nmod_poly_power_sums_extend(mp_ptr res, slong m, slong n, mp_srcptr rev,
+                                      mp_srcptr inv, slong len, nmod_t mod)
+{
+    slong d = len - 1, k;
+    mp_ptr t;
+
+    FLINT_ASSERT(d >= 1);
+    FLINT_ASSERT(m >= d);
+
+    t = _nmod_vec_init(len + d - 1);
+
+    while (m < n)
+    {
+        k = FLINT_MIN(d, n - m);
+
+        _nmod_poly_mulhigh(t, rev, len, res + m - d, d, d, mod);
+        _nmod_poly_mullow(res + m, inv, k, t + d, k, k, mod);
+        _nmod_vec_neg(res + m, res + m, k, mod);
+
+        m += k;
+    }
+
+    _nmod_vec_clear(t);
+}
@@ -0,0 +1,68 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_power_sums_ctx_fit_length(nmod_poly_power_sums_ctx_t ctx, slong n)
+{
+    if (n <= ctx->n)
+        return;
+
+    if (n > ctx->alloc)
+    {
+        ctx->alloc = FLINT_MAX(n, 2*ctx->alloc);
+        ctx->sums = (mp_ptr) flint_realloc(ctx->sums,
+                                             ctx->alloc*sizeof(mp_limb_t));
+    }
+
+    if (ctx->len == 1)
+        _nmod_vec_zero(ctx->sums + ctx->n, n - ctx->n);
+    else
+        _nmod_poly_power_sums_extend(ctx->sums, ctx->n, n, ctx->rev,
+                                           ctx->inv, ctx->len, ctx->mod);
+
+    ctx->n = n;
+}
+
+void
+nmod_poly_power_sums_precomp(nmod_poly_t res, slong n,
+                                            nmod_poly_power_sums_ctx_t ctx)
+{
+    if (n <= 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    nmod_poly_power_sums_ctx_fit_length(ctx, n);
+
+    nmod_poly_fit_length(res, n);
+    _nmod_vec_set(res->coeffs, ctx->sums, n);
+    _nmod_poly_set_length(res, n);
+    _nmod_poly_normalise(res);
+}
+
+mp_limb_t
+nmod_poly_power_sums_trace(const nmod_poly_t g,
+                                            nmod_poly_power_sums_ctx_t ctx)
+{
+    slong len = g->length;
+
+    if (len == 0)
+        return 0;
+
+    nmod_poly_power_sums_ctx_fit_length(ctx, len);
+
+    return _nmod_vec_dot(g->coeffs, ctx->sums, len, ctx->mod,
+                                   _nmod_vec_dot_bound_limbs(len, ctx->mod));
+}
@@ -0,0 +1,26 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_powmod_precomp_clear(nmod_poly_powmod_precomp_t P)
+{
+    if (P->bits != 0)
+    {
+        flint_mpn_mul_precache_clear(P->finvpre);
+        flint_mpn_mul_precache_clear(P->fpre);
+    }
+
+    nmod_poly_clear(P->f);
+    nmod_poly_clear(P->finv);
+}
@@ -0,0 +1,77 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+_nmod_poly_powmod_precomp_init(nmod_poly_powmod_precomp_t P,
+                               mp_srcptr f, slong lenf, mp_srcptr finv,
+                                                  slong lenfinv, nmod_t mod)
+{
+    /* quotients have at most lenf - 2 terms when reducing a square */
+    slong lenQ = lenf - 2;
+    flint_bitcnt_t bits;
+    slong limbs, lenI;
+    mp_ptr t;
+
+    nmod_poly_init2_preinv(P->f, mod.n, mod.ninv, lenf);
+    _nmod_vec_set(P->f->coeffs, f, lenf);
+    P->f->length = lenf;
+
+    nmod_poly_init2_preinv(P->finv, mod.n, mod.ninv, lenfinv);
+    _nmod_vec_set(P->finv->coeffs, finv, lenfinv);
+    P->finv->length = lenfinv;
+
+    P->bits = 0;
+    P->transforms_saved = 0;
+
+    if (lenQ < 2)
+        return;
+
+    bits = 2*(FLINT_BITS - mod.norm) + FLINT_BIT_COUNT(lenf);
+    limbs = (lenQ*bits - 1)/FLINT_BITS + 1;
+
+    if (limbs < NMOD_POLY_POWMOD_PRECOMP_CUTOFF)
+        return;
+
+    t = flint_malloc((((lenf - 1)*bits - 1)/FLINT_BITS + 1)*sizeof(mp_limb_t));
+
+    /* only the low lenQ terms of finv are ever used */
+    lenI = FLINT_MIN(lenfinv, lenQ);
+    _nmod_poly_bit_pack(t, finv, lenI, bits);
+    flint_mpn_mul_precache_init(P->finvpre, t,
+                                  (lenI*bits - 1)/FLINT_BITS + 1, limbs);
+
+    /* and only the low lenf - 1 terms of f matter for the remainder */
+    _nmod_poly_bit_pack(t, f, lenf - 1, bits);
+    flint_mpn_mul_precache_init(P->fpre, t,
+                             ((lenf - 1)*bits - 1)/FLINT_BITS + 1, limbs);
+
+    P->bits = bits;
+
+    flint_free(t);
+}
+
+void
+nmod_poly_powmod_precomp_init(nmod_poly_powmod_precomp_t P,
+                                 const nmod_poly_t f, const nmod_poly_t finv)
+{
+    if (f->length == 0)
+    {
+        flint_printf("Exception (nmod_poly_powmod_precomp_init). Divide by zero.\n");
+        flint_abort();
+    }
+
+    _nmod_poly_powmod_precomp_init(P, f->coeffs, f->length,
+                                         finv->coeffs, finv->length, f->mod);
+}
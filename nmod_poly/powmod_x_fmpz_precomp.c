@@ -0,0 +1,169 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+/*
+   Sets (R, lenf - 1) to (A, lenA) reduced modulo f. When the transforms
+   of f and finv are cached the quotient and the remainder are each
+   obtained with a single forward transform; short quotients, as produced
+   by the multiplications by a power of x, are left to the Newton division.
+*/
+static void
+_nmod_poly_powmod_precomp_rem(mp_ptr R, mp_ptr Q, mp_srcptr A, slong lenA,
+                         nmod_poly_powmod_precomp_t P, mp_ptr t1, mp_ptr t2)
+{
+    mp_srcptr f = P->f->coeffs;
+    slong lenf = P->f->length;
+    slong lenQ = lenA - lenf + 1;
+    nmod_t mod = P->f->mod;
+    flint_bitcnt_t bits = P->bits;
+    slong limbs;
+
+    if (bits == 0 || 2*lenQ < lenf)
+    {
+        _nmod_poly_divrem_newton_n_preinv(Q, R, A, lenA, f, lenf,
+                                   P->finv->coeffs, P->finv->length, mod);
+        return;
+    }
+
+    limbs = (lenQ*bits - 1)/FLINT_BITS + 1;
+
+    /* Q = rev(rev(A) * finv mod x^lenQ) */
+    _nmod_poly_reverse(Q, A + lenf - 1, lenQ, lenQ);
+    _nmod_poly_bit_pack(t1, Q, lenQ, bits);
+    flint_mpn_mul_precache(t2, t1, limbs, P->finvpre);
+    _nmod_poly_bit_unpack(Q, lenQ, t2, bits, mod);
+    _nmod_poly_reverse(Q, Q, lenQ, lenQ);
+
+    /* R = A - Q*f mod x^(lenf - 1) */
+    _nmod_poly_bit_pack(t1, Q, lenQ, bits);
+    flint_mpn_mul_precache(t2, t1, limbs, P->fpre);
+    _nmod_poly_bit_unpack(R, lenf - 1, t2, bits, mod);
+    _nmod_vec_sub(R, A, R, lenf - 1, mod);
+
+    P->transforms_saved += 2;
+}
+
+void
+_nmod_poly_powmod_x_fmpz_precomp(mp_ptr res, const fmpz_t e,
+                                                nmod_poly_powmod_precomp_t P)
+{
+    slong lenf = P->f->length;
+    nmod_t mod = P->f->mod;
+    mp_ptr T, Q, t1 = NULL, t2 = NULL;
+    slong lenT, lenQ, window;
+    slong i, l, c;
+
+    lenT = 2*lenf - 3;
+    lenQ = FLINT_MAX(lenT - lenf + 1, 1);
+
+    T = _nmod_vec_init(lenT + lenQ);
+    Q = T + lenT;
+
+    if (P->bits != 0)
+    {
+        slong limbs = (lenQ*P->bits - 1)/FLINT_BITS + 1;
+
+        t1 = flint_malloc((limbs + P->fpre->n2 + limbs
+                             + P->finvpre->n2)*sizeof(mp_limb_t));
+        t2 = t1 + limbs;
+    }
+
+    flint_mpn_zero(res, lenf - 1);
+    res[0] = 1;
+
+    l = z_sizeinbase(lenf - 1, 2) - 2;
+    window = (WORD(1) << l);
+    c = l;
+    i = fmpz_sizeinbase(e, 2) - 2;
+
+    if (i <= l)
+    {
+        window = (WORD(1) << i);
+        c = i;
+        l = i;
+    }
+
+    if (c == 0)
+    {
+        _nmod_poly_shift_left(T, res, lenf - 1, window);
+
+        _nmod_poly_powmod_precomp_rem(res, Q, T, lenf - 1 + window,
+                                                               P, t1, t2);
+
+        c = l + 1;
+        window = 0;
+    }
+
+    for (; i >= 0; i--)
+    {
+        _nmod_poly_mul(T, res, lenf - 1, res, lenf - 1, mod);
+
+        _nmod_poly_powmod_precomp_rem(res, Q, T, 2*lenf - 3, P, t1, t2);
+
+        c--;
+
+        if (fmpz_tstbit(e, i))
+        {
+            if (window == 0 && i <= l - 1)
+                c = i;
+
+            if (c >= 0)
+              window = window | (WORD(1) << c);
+        } else if (window == 0)
+            c = l + 1;
+
+        if (c == 0)
+        {
+            /* multiplying by x^window is only a shift */
+            _nmod_poly_shift_left(T, res, lenf - 1, window);
+
+            _nmod_poly_powmod_precomp_rem(res, Q, T, lenf - 1 + window,
+                                                               P, t1, t2);
+
+            c = l + 1;
+            window = 0;
+        }
+    }
+
+    _nmod_vec_clear(T);
+    flint_free(t1);
+}
+
+void
+nmod_poly_powmod_x_fmpz_precomp(nmod_poly_t res, const fmpz_t e,
+                                                nmod_poly_powmod_precomp_t P)
+{
+    slong lenf = P->f->length;
+    slong trunc = lenf - 1;
+
+    if (lenf <= 2 || fmpz_cmp_ui(e, 2) <= 0)
+    {
+        fmpz_t e2;
+
+        fmpz_init_set(e2, e);
+        nmod_poly_powmod_x_fmpz_preinv(res, e2, P->f, P->finv);
+        fmpz_clear(e2);
+
+        return;
+    }
+
+    nmod_poly_fit_length(res, trunc);
+    _nmod_poly_powmod_x_fmpz_precomp(res->coeffs, e, P);
+
+    res->length = trunc;
+    _nmod_poly_normalise(res);
+}
@@ -38,6 +38,18 @@ _nmod_poly_powmod_x_fmpz_preinv (mp_ptr res, fmpz_t e, mp_srcptr f, slong lenf,
     slong lenT, lenQ, window;
     slong i, l, c;
 
+    if ((lenf - 2)*(2*(FLINT_BITS - mod.norm) + FLINT_BIT_COUNT(lenf))
+                        >= NMOD_POLY_POWMOD_PRECOMP_CUTOFF*FLINT_BITS)
+    {
+        nmod_poly_powmod_precomp_t P;
+
+        _nmod_poly_powmod_precomp_init(P, f, lenf, finv, lenfinv, mod);
+        _nmod_poly_powmod_x_fmpz_precomp(res, e, P);
+        nmod_poly_powmod_precomp_clear(P);
+
+        return;
+    }
+
     lenT = 2*lenf - 3;
     lenQ = FLINT_MAX(lenT - lenf + 1, 1);
 
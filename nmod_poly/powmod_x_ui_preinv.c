@@ -37,6 +37,21 @@ _nmod_poly_powmod_x_ui_preinv(mp_ptr res, ulong e, mp_srcptr f, slong lenf,
     slong lenT, lenQ, window;
     int i, l, c;
 
+    if ((lenf - 2)*(2*(FLINT_BITS - mod.norm) + FLINT_BIT_COUNT(lenf))
+                        >= NMOD_POLY_POWMOD_PRECOMP_CUTOFF*FLINT_BITS)
+    {
+        nmod_poly_powmod_precomp_t P;
+        fmpz_t exp;
+
+        fmpz_init_set_ui(exp, e);
+        _nmod_poly_powmod_precomp_init(P, f, lenf, finv, lenfinv, mod);
+        _nmod_poly_powmod_x_fmpz_precomp(res, exp, P);
+        nmod_poly_powmod_precomp_clear(P);
+        fmpz_clear(exp);
+
+        return;
+    }
+
     lenT = 2 * lenf - 3;
     lenQ = FLINT_MAX(lenT - lenf + 1, 1);
 
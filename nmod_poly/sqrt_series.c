@@ -21,10 +21,44 @@
 void
 _nmod_poly_sqrt_series(mp_ptr g, mp_srcptr h, slong n, nmod_t mod)
 {
-    mp_ptr t = _nmod_vec_init(n);
-    _nmod_poly_invsqrt_series(t, h, n, mod);
-    _nmod_poly_mullow(g, t, n, h, n, n, mod);
+    slong m;
+    nmod_poly_mul_precache_t P;
+    mp_ptr t, u;
+    mp_limb_t c;
+
+    if (n == 1)
+    {
+        g[0] = UWORD(1);
+        return;
+    }
+
+    /*
+        With t = h^{-1/2} and g = h t correct to precision m = ceil(n/2),
+        the last Newton step g <- g + t (h - g^2) / 2 only needs t to
+        precision m, so the final inverse square root step is skipped.
+    */
+    m = (n + 1) / 2;
+
+    t = _nmod_vec_init(n);
+    u = _nmod_vec_init(n);
+
+    _nmod_poly_invsqrt_series(t, h, m, mod);
+    _nmod_poly_mul_precache_init(P, t, m, m, mod);
+    _nmod_poly_mullow_precache(g, h, m, m, P);
+
+    _nmod_poly_mul(u, g, m, g, m, mod);
+    if (2*m - 1 < n)
+        u[n - 1] = UWORD(0);
+    _nmod_vec_sub(u + m, h + m, u + m, n - m, mod);
+
+    _nmod_poly_mullow_precache(g + m, u + m, n - m, n - m, P);
+    _nmod_poly_mul_precache_clear(P);
+
+    c = n_invmod(2, mod.n);
+    _nmod_vec_scalar_mul_nmod(g + m, g + m, n - m, c, mod);
+
     _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
 }
 
 void
@@ -0,0 +1,199 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+static void
+_check(const nmod_poly_batch_t R, const nmod_poly_struct * S, slong num,
+                                                             const char * op)
+{
+    slong j;
+    nmod_poly_t t;
+
+    nmod_poly_init_mod(t, R->mod);
+
+    for (j = 0; j < num; j++)
+    {
+        nmod_poly_batch_get_nmod_poly(t, R, j);
+
+        if (!nmod_poly_equal(t, S + j))
+        {
+            flint_printf("FAIL (%s):\n", op);
+            flint_printf("mod=%wu, num=%wd, j=%wd\n\n", R->mod.n, num, j);
+            nmod_poly_print(t), flint_printf("\n\n");
+            nmod_poly_print(S + j), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+    }
+
+    nmod_poly_clear(t);
+}
+
+int
+main(void)
+{
+    int i, full;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("batch....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_batch_t A, B, F, R;
+        nmod_poly_struct * P, * Q, * M, * S;
+        mp_ptr x, y;
+        mp_limb_t mod;
+        slong j, num, lenP, lenQ, lenM;
+
+        mod = n_randtest_prime(state, 0);
+        num = n_randint(state, 40) + 1;
+        lenP = n_randint(state, 32);
+        lenQ = n_randint(state, 32);
+        lenM = n_randint(state, 16) + 1;
+        full = n_randint(state, 2);
+
+        P = flint_malloc(4*num*sizeof(nmod_poly_struct));
+        Q = P + num;
+        M = Q + num;
+        S = M + num;
+
+        nmod_poly_batch_init(A, num, mod);
+        nmod_poly_batch_init(B, num, mod);
+        nmod_poly_batch_init(F, num, mod);
+        nmod_poly_batch_init(R, num, mod);
+
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_init(P + j, mod);
+            nmod_poly_init(Q + j, mod);
+            nmod_poly_init(M + j, mod);
+            nmod_poly_init(S + j, mod);
+
+            /* full lengths make the remainder sequences run in lockstep */
+            if (full)
+            {
+                nmod_poly_randtest(P + j, state, lenP);
+                nmod_poly_randtest(Q + j, state, lenQ);
+            }
+            else
+            {
+                nmod_poly_randtest(P + j, state, n_randint(state, lenP + 1));
+                nmod_poly_randtest(Q + j, state, n_randint(state, lenQ + 1));
+            }
+
+            /* the moduli all have length lenM */
+            nmod_poly_randtest(M + j, state, lenM);
+            nmod_poly_set_coeff_ui(M + j, lenM - 1,
+                                             n_randint(state, mod - 1) + 1);
+
+            nmod_poly_batch_set_nmod_poly(A, j, P + j);
+            nmod_poly_batch_set_nmod_poly(B, j, Q + j);
+            nmod_poly_batch_set_nmod_poly(F, j, M + j);
+        }
+
+        _check(A, P, num, "set/get");
+
+        /* multiplication */
+        nmod_poly_batch_mul(R, A, B);
+        for (j = 0; j < num; j++)
+            nmod_poly_mul(S + j, P + j, Q + j);
+        _check(R, S, num, "mul");
+
+        nmod_poly_batch_mul(B, A, B);
+        _check(B, S, num, "mul aliasing");
+
+        /* remainder */
+        nmod_poly_batch_rem(R, B, F);
+        for (j = 0; j < num; j++)
+            nmod_poly_rem(S + j, S + j, M + j);
+        _check(R, S, num, "rem");
+
+        nmod_poly_batch_rem(B, B, F);
+        _check(B, S, num, "rem aliasing");
+
+        /* modular multiplication */
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_batch_set_nmod_poly(B, j, Q + j);
+            nmod_poly_mul(S + j, P + j, Q + j);
+            nmod_poly_rem(S + j, S + j, M + j);
+        }
+        nmod_poly_batch_mulmod(R, A, B, F);
+        _check(R, S, num, "mulmod");
+
+        /* gcd */
+        for (j = 0; j < num; j++)
+            nmod_poly_gcd(S + j, P + j, Q + j);
+        nmod_poly_batch_gcd(R, A, B);
+        _check(R, S, num, "gcd");
+
+        /* gcd, with a common factor */
+        nmod_poly_batch_mul(A, A, F);
+        nmod_poly_batch_mul(B, B, F);
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_mul(P + j, P + j, M + j);
+            nmod_poly_mul(Q + j, Q + j, M + j);
+            nmod_poly_gcd(S + j, P + j, Q + j);
+        }
+        nmod_poly_batch_gcd(R, A, B);
+        _check(R, S, num, "gcd common factor");
+
+        nmod_poly_batch_gcd(A, A, B);
+        _check(A, S, num, "gcd aliasing");
+
+        /* evaluation */
+        x = _nmod_vec_init(num);
+        y = _nmod_vec_init(num);
+        for (j = 0; j < num; j++)
+            x[j] = n_randint(state, mod);
+
+        nmod_poly_batch_evaluate_nmod(y, B, x);
+        for (j = 0; j < num; j++)
+        {
+            if (y[j] != nmod_poly_evaluate_nmod(Q + j, x[j]))
+            {
+                flint_printf("FAIL (evaluate):\n");
+                flint_printf("mod=%wu, num=%wd, j=%wd\n\n", mod, num, j);
+                nmod_poly_print(Q + j), flint_printf("\n\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_clear(P + j);
+            nmod_poly_clear(Q + j);
+            nmod_poly_clear(M + j);
+            nmod_poly_clear(S + j);
+        }
+        flint_free(P);
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_batch_clear(B);
+        nmod_poly_batch_clear(F);
+        nmod_poly_batch_clear(R);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("compose_mod_brent_kung_preinv_threaded....");
+    fflush(stdout);
+
+    /* check (a1 a2)(b) = a1(b) a2(b) mod c and against one thread */
+    for (i = 0; i < 4 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a1, a2, a, b, c, cinv, d1, d2, d, e;
+        mp_limb_t m = n_randtest_prime(state, 0);
+        slong len;
+
+        nmod_poly_init(a1, m);
+        nmod_poly_init(a2, m);
+        nmod_poly_init(a, m);
+        nmod_poly_init(b, m);
+        nmod_poly_init(c, m);
+        nmod_poly_init(cinv, m);
+        nmod_poly_init(d1, m);
+        nmod_poly_init(d2, m);
+        nmod_poly_init(d, m);
+        nmod_poly_init(e, m);
+
+        len = n_randint(state, 4) == 0 ?
+                 NMOD_POLY_COMPOSE_MOD_THREAD_CUTOFF + n_randint(state, 1000)
+                 : 1 + n_randint(state, 200);
+
+        /* a1 a2 need no reduction modulo c */
+        nmod_poly_randtest(a1, state, n_randint(state, len/2 + 1));
+        nmod_poly_randtest(a2, state, n_randint(state, len/2 + 1));
+        nmod_poly_randtest(b, state, 1 + n_randint(state, len));
+        do nmod_poly_randtest(c, state, len);
+        while (c->length != len);
+
+        nmod_poly_mul(a, a1, a2);
+        nmod_poly_reverse(cinv, c, c->length);
+        nmod_poly_inv_series(cinv, cinv, c->length);
+
+        flint_set_num_threads(1);
+        nmod_poly_compose_mod_brent_kung_preinv(e, a, b, c, cinv);
+
+        flint_set_num_threads(n_randint(state, 5) + 2);
+        nmod_poly_compose_mod_brent_kung_preinv(d, a, b, c, cinv);
+        nmod_poly_compose_mod_brent_kung_preinv(d1, a1, b, c, cinv);
+        nmod_poly_compose_mod_brent_kung_preinv(d2, a2, b, c, cinv);
+        nmod_poly_mulmod(d1, d1, d2, c);
+
+        if (!nmod_poly_equal(d, e) || !nmod_poly_equal(d, d1))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wu, len = %wd, threads = %wd\n",
+                                             m, len, flint_get_num_threads());
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_poly_clear(a1);
+        nmod_poly_clear(a2);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(cinv);
+        nmod_poly_clear(d1);
+        nmod_poly_clear(d2);
+        nmod_poly_clear(d);
+        nmod_poly_clear(e);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -139,6 +139,42 @@ main(void)
         nmod_poly_clear(t);
     }
 
+    /* Compare with divconquer at lengths where 60-bit moduli use
+       cached transforms */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        nmod_poly_t f, g, h, s;
+        mp_limb_t m;
+        slong n;
+
+        m = n_randprime(state, FLINT_BITS - 4, 1);
+        nmod_poly_init(f, m);
+        nmod_poly_init(g, m);
+        nmod_poly_init(h, m);
+        nmod_poly_init(s, m);
+        n = 3000 + n_randint(state, 1000);
+        nmod_poly_randtest(g, state, n);
+        nmod_poly_randtest(h, state, n);
+        nmod_poly_set_coeff_ui(h, 0, 0);
+
+        nmod_poly_compose_series_divconquer(s, g, h, n);
+        nmod_poly_compose_series_brent_kung(f, g, h, n);
+
+        result = (nmod_poly_equal(f, s));
+        if (!result)
+        {
+            flint_printf("FAIL (large):\n");
+            flint_printf("n = %wd, m = %wu\n", n, m);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+        nmod_poly_clear(h);
+        nmod_poly_clear(s);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -150,6 +150,45 @@ main(void)
         nmod_poly_clear(b);
     }
 
+    /* Check A/B * B = A at lengths where 60-bit moduli use Newton
+       iteration and cached transforms */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        nmod_poly_t q, a, b, prod;
+        slong m;
+
+        mp_limb_t n = n_randprime(state, FLINT_BITS - 4, 1);
+
+        nmod_poly_init(prod, n);
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(q, n);
+
+        nmod_poly_randtest(a, state, 6000 + n_randint(state, 6000));
+        do nmod_poly_randtest(b, state, 4000 + n_randint(state, 8000));
+        while (b->length == 0 || b->coeffs[0] == 0);
+
+        m = 6000 + n_randint(state, 6000);
+
+        nmod_poly_div_series(q, a, b, m);
+        nmod_poly_mullow(prod, q, b, m);
+        nmod_poly_truncate(a, m);
+
+        result = (nmod_poly_equal(a, prod));
+        if (!result)
+        {
+            flint_printf("FAIL (large):\n");
+            flint_printf("m = %wd, n = %wu\n", m, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_poly_clear(q);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(prod);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
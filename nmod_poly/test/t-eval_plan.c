@@ -0,0 +1,128 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result = 1;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("eval_plan....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_eval_plan_t E;
+        nmod_poly_struct P[3], Q[3];
+        mp_ptr x, y[3], z;
+        mp_limb_t mod, a;
+        slong j, k, n, npoints;
+        nmod_t modn;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        mod = n_randtest_prime(state, 0);
+        n = n_randint(state, 10) == 0 ? 1500 : 300;
+        npoints = n_randint(state, FLINT_MIN(n, mod));
+        nmod_init(&modn, mod);
+
+        x = _nmod_vec_init(npoints);
+        z = _nmod_vec_init(npoints);
+        for (k = 0; k < 3; k++)
+        {
+            nmod_poly_init(P + k, mod);
+            nmod_poly_init(Q + k, mod);
+            y[k] = _nmod_vec_init(npoints);
+        }
+
+        a = n_randint(state, mod);
+        for (j = 0; j < npoints; j++)
+            x[j] = nmod_add(a, j, modn);
+
+        nmod_poly_eval_plan_init(E, x, npoints, modn);
+
+        /* evaluation of polynomials of any length */
+        for (k = 0; k < 3; k++)
+        {
+            n = n_randint(state, 3 * npoints + 2);
+            nmod_poly_randtest(P + k, state, n);
+        }
+
+        nmod_poly_eval_plan_evaluate_vec(y, P, 3, E);
+
+        for (k = 0; k < 3; k++)
+        {
+            nmod_poly_evaluate_nmod_vec_iter(z, P + k, x, npoints);
+            result = _nmod_vec_equal(y[k], z, npoints);
+
+            nmod_poly_eval_plan_evaluate(z, P + k, E);
+            result = result && _nmod_vec_equal(y[k], z, npoints);
+
+            if (!result)
+            {
+                flint_printf("FAIL (evaluate):\n");
+                flint_printf("mod=%wu, npoints=%wd\n\n", mod, npoints);
+                nmod_poly_print(P + k), flint_printf("\n\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        /* interpolation recovers polynomials of length at most npoints */
+        for (k = 0; k < 3; k++)
+        {
+            n = n_randint(state, npoints + 1);
+            nmod_poly_randtest(P + k, state, n);
+            nmod_poly_evaluate_nmod_vec_iter(y[k], P + k, x, npoints);
+        }
+
+        nmod_poly_eval_plan_interpolate_vec(Q, (const mp_srcptr *) y, 3, E);
+
+        for (k = 0; k < 3; k++)
+        {
+            result = nmod_poly_equal(P + k, Q + k);
+
+            nmod_poly_eval_plan_interpolate(Q + k, y[k], E);
+            result = result && nmod_poly_equal(P + k, Q + k);
+
+            if (!result)
+            {
+                flint_printf("FAIL (interpolate):\n");
+                flint_printf("mod=%wu, npoints=%wd\n\n", mod, npoints);
+                nmod_poly_print(P + k), flint_printf("\n\n");
+                nmod_poly_print(Q + k), flint_printf("\n\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_poly_eval_plan_clear(E);
+
+        for (k = 0; k < 3; k++)
+        {
+            nmod_poly_clear(P + k);
+            nmod_poly_clear(Q + k);
+            _nmod_vec_clear(y[k]);
+        }
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
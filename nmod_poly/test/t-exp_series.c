@@ -133,6 +133,55 @@ main(void)
         nmod_poly_clear(B);
     }
 
+    /* Check exp(A+B) = exp(A) * exp(B) at lengths where 60-bit moduli
+       use cached transforms in the Newton steps */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        nmod_poly_t A, B, AB, expA, expB, expAB, S;
+        slong n;
+        mp_limb_t mod;
+
+        mod = n_randprime(state, FLINT_BITS - 4, 1);
+        n = 12000 + n_randint(state, 6000);
+
+        nmod_poly_init(A, mod);
+        nmod_poly_init(B, mod);
+        nmod_poly_init(AB, mod);
+        nmod_poly_init(expA, mod);
+        nmod_poly_init(expB, mod);
+        nmod_poly_init(expAB, mod);
+        nmod_poly_init(S, mod);
+
+        nmod_poly_randtest(A, state, n);
+        nmod_poly_set_coeff_ui(A, 0, UWORD(0));
+        nmod_poly_randtest(B, state, n);
+        nmod_poly_set_coeff_ui(B, 0, UWORD(0));
+
+        nmod_poly_exp_series(expA, A, n);
+        nmod_poly_exp_series(expB, B, n);
+        nmod_poly_add(AB, A, B);
+        nmod_poly_exp_series(expAB, AB, n);
+        nmod_poly_mullow(S, expA, expB, n);
+
+        result = nmod_poly_equal(S, expAB);
+
+        if (!result)
+        {
+            flint_printf("FAIL (large):\n");
+            flint_printf("n = %wd, mod = %wu\n", n, mod);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_poly_clear(A);
+        nmod_poly_clear(B);
+        nmod_poly_clear(AB);
+        nmod_poly_clear(expA);
+        nmod_poly_clear(expB);
+        nmod_poly_clear(expAB);
+        nmod_poly_clear(S);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
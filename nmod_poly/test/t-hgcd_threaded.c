@@ -0,0 +1,96 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("hgcd_threaded....");
+    fflush(stdout);
+
+    /*
+       Compare gcd, xgcd and resultant with the Euclidean versions for
+       inputs long enough for the matrix products to be threaded
+    */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c, g1, g2, s, t, sum, temp;
+        mp_limb_t n, r1, r2;
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        n = n_randtest_prime(state, 0);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(g1, n);
+        nmod_poly_init(g2, n);
+        nmod_poly_init(s, n);
+        nmod_poly_init(t, n);
+        nmod_poly_init(sum, n);
+        nmod_poly_init(temp, n);
+
+        nmod_poly_randtest(a, state, n_randint(state, 4000) + 1000);
+        nmod_poly_randtest(b, state, n_randint(state, 4000) + 1000);
+        nmod_poly_randtest(c, state, n_randint(state, 100));
+
+        r1 = nmod_poly_resultant_euclidean(a, b);
+        r2 = nmod_poly_resultant_hgcd(a, b);
+
+        nmod_poly_mul(a, a, c);
+        nmod_poly_mul(b, b, c);
+
+        nmod_poly_gcd_euclidean(g1, a, b);
+        nmod_poly_gcd_hgcd(g2, a, b);
+
+        result = (r1 == r2 && nmod_poly_equal(g1, g2));
+
+        nmod_poly_xgcd_hgcd(g2, s, t, a, b);
+        nmod_poly_mul(sum, s, a);
+        nmod_poly_mul(temp, t, b);
+        nmod_poly_add(sum, sum, temp);
+
+        result = result && nmod_poly_equal(g1, g2) && nmod_poly_equal(g1, sum);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            nmod_poly_print(g1), flint_printf("\n\n");
+            nmod_poly_print(g2), flint_printf("\n\n");
+            flint_printf("r1 = %wu, r2 = %wu\n", r1, r2);
+            flint_printf("n = %wu\n", n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(g1);
+        nmod_poly_clear(g2);
+        nmod_poly_clear(s);
+        nmod_poly_clear(t);
+        nmod_poly_clear(sum);
+        nmod_poly_clear(temp);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
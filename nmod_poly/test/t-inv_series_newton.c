@@ -103,6 +103,42 @@ main(void)
         nmod_poly_clear(qinv);
     }
 
+    /* Check Q * Qinv = 1 mod x^n at lengths where 60-bit moduli use
+       cached transforms */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        nmod_poly_t q, qinv, prod;
+        slong m;
+
+        mp_limb_t n = n_randprime(state, FLINT_BITS - 4, 1);
+
+        nmod_poly_init(prod, n);
+        nmod_poly_init(qinv, n);
+        nmod_poly_init(q, n);
+
+        do nmod_poly_randtest(q, state, 6000 + n_randint(state, 10000));
+        while (q->length == 0 || q->coeffs[0] == 0);
+
+        m = 6000 + n_randint(state, 10000);
+
+        nmod_poly_inv_series_newton(qinv, q, m);
+
+        nmod_poly_mullow(prod, q, qinv, m);
+
+        result = (prod->length == 1 && prod->coeffs[0] == 1);
+        if (!result)
+        {
+            flint_printf("FAIL (large):\n");
+            flint_printf("m = %wd, n = %wu\n", m, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_poly_clear(q);
+        nmod_poly_clear(qinv);
+        nmod_poly_clear(prod);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -0,0 +1,130 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+#if FLINT_USES_PTHREAD && (FLINT_USES_TLS || FLINT_REENTRANT)
+    slong iter;
+#endif
+    FLINT_TEST_INIT(state);
+
+    flint_printf("multi_crt_threaded....");
+    fflush(stdout);
+
+#if FLINT_USES_PTHREAD && (FLINT_USES_TLS || FLINT_REENTRANT)
+    /* interpolation from many evaluation points with one program */
+    for (iter = 0; iter < 2 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_multi_crt_t P;
+        nmod_poly_struct * moduli, * values;
+        nmod_poly_t output;
+        mp_ptr xs, ys;
+        mp_limb_t p;
+        slong i, j, n;
+
+        p = n_randprime(state, 20 + n_randint(state, FLINT_BITS - 20), 1);
+        n = NMOD_POLY_MULTI_CRT_THREAD_CUTOFF + n_randint(state, 3000);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        moduli = (nmod_poly_struct *) flint_malloc(n*sizeof(nmod_poly_struct));
+        values = (nmod_poly_struct *) flint_malloc(n*sizeof(nmod_poly_struct));
+        xs = _nmod_vec_init(n);
+        ys = _nmod_vec_init(n);
+        nmod_poly_init(output, p);
+        nmod_poly_multi_crt_init(P);
+
+        /* distinct points x_i, moduli x - x_i */
+        for (i = 0; i < n; i++)
+        {
+            xs[i] = i + n_randint(state, p - n);
+            nmod_poly_init(moduli + i, p);
+            nmod_poly_init(values + i, p);
+            nmod_poly_set_coeff_ui(moduli + i, 1, 1);
+            nmod_poly_set_coeff_ui(moduli + i, 0, nmod_neg(xs[i], moduli->mod));
+        }
+
+        /* make the points strictly increasing */
+        for (i = 1; i < n; i++)
+        {
+            if (xs[i] <= xs[i - 1])
+            {
+                xs[i] = xs[i - 1] + 1;
+                nmod_poly_set_coeff_ui(moduli + i, 0,
+                                          nmod_neg(xs[i], moduli->mod));
+            }
+        }
+
+        if (xs[n - 1] >= p)
+            goto cleanup;
+
+        if (!nmod_poly_multi_crt_precompute(P, moduli, n))
+        {
+            flint_printf("FAIL:\nprecompute failed\n");
+            flint_printf("p = %wu, n = %wd\n", p, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (j = 0; j < 3; j++)
+        {
+            for (i = 0; i < n; i++)
+                nmod_poly_set_coeff_ui(values + i, 0, n_randint(state, p));
+
+            nmod_poly_multi_crt_precomp(output, P, values);
+
+            if (nmod_poly_degree(output) >= n)
+            {
+                flint_printf("FAIL:\ndegree too large\n");
+                flint_printf("p = %wu, n = %wd\n", p, n);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            nmod_poly_evaluate_nmod_vec(ys, output, xs, n);
+
+            for (i = 0; i < n; i++)
+            {
+                if (ys[i] != nmod_poly_get_coeff_ui(values + i, 0))
+                {
+                    flint_printf("FAIL:\nwrong value\n");
+                    flint_printf("p = %wu, n = %wd, i = %wd\n", p, n, i);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+cleanup:
+
+        nmod_poly_multi_crt_clear(P);
+
+        for (i = 0; i < n; i++)
+        {
+            nmod_poly_clear(moduli + i);
+            nmod_poly_clear(values + i);
+        }
+
+        flint_free(moduli);
+        flint_free(values);
+        _nmod_vec_clear(xs);
+        _nmod_vec_clear(ys);
+        nmod_poly_clear(output);
+    }
+#endif
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("power_sums_ctx....");
+    fflush(stdout);
+
+    /* Check against the naive algorithm, for several queries; the primes
+       exceed the number of power sums so that the naive algorithm applies */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c, g;
+        nmod_poly_power_sums_ctx_t ctx;
+        mp_limb_t p, t1, t2;
+        slong n;
+
+        p = n_randprime(state, 10 + n_randint(state, FLINT_BITS - 10), 1);
+        nmod_poly_init(a, p);
+        nmod_poly_init(b, p);
+        nmod_poly_init(c, p);
+        nmod_poly_init(g, p);
+
+        nmod_poly_randtest_not_zero(a, state, 1 + n_randint(state, 60));
+        if (n_randint(state, 4) == 0)
+            nmod_poly_shift_left(a, a, n_randint(state, 5));
+
+        nmod_poly_power_sums_ctx_init(ctx, a);
+
+        for (j = 0; j < 4; j++)
+        {
+            n = n_randint(state, 300);
+
+            nmod_poly_power_sums_precomp(b, n, ctx);
+            nmod_poly_power_sums_naive(c, a, n);
+
+            result = nmod_poly_equal(b, c);
+            if (!result)
+            {
+                flint_printf("FAIL: power sums\n");
+                flint_printf("n = %wd\n", n);
+                nmod_poly_print(a), flint_printf("\n\n");
+                nmod_poly_print(b), flint_printf("\n\n");
+                nmod_poly_print(c), flint_printf("\n\n");
+                fflush(stdout);
+                flint_abort();
+            }
+
+            nmod_poly_randtest(g, state, n_randint(state, 400));
+
+            t1 = nmod_poly_power_sums_trace(g, ctx);
+
+            nmod_poly_power_sums_naive(c, a, g->length);
+            t2 = 0;
+            for (n = 0; n < g->length; n++)
+                t2 = nmod_add(t2, nmod_mul(nmod_poly_get_coeff_ui(g, n),
+                          nmod_poly_get_coeff_ui(c, n), a->mod), a->mod);
+
+            result = (t1 == t2);
+            if (!result)
+            {
+                flint_printf("FAIL: trace\n");
+                nmod_poly_print(a), flint_printf("\n\n");
+                nmod_poly_print(g), flint_printf("\n\n");
+                flint_printf("%wu, %wu\n", t1, t2);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_poly_power_sums_ctx_clear(ctx);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(g);
+    }
+
+    /* Small characteristic, check against power_sums_schoenhage */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c;
+        nmod_poly_power_sums_ctx_t ctx;
+        mp_limb_t p;
+        slong n;
+
+        p = n_randtest_prime(state, 0);
+        nmod_poly_init(a, p);
+        nmod_poly_init(b, p);
+        nmod_poly_init(c, p);
+
+        nmod_poly_randtest_not_zero(a, state, 1 + n_randint(state, 60));
+
+        nmod_poly_power_sums_ctx_init(ctx, a);
+
+        for (j = 0; j < 4; j++)
+        {
+            n = n_randint(state, 300);
+
+            nmod_poly_power_sums_precomp(b, n, ctx);
+            nmod_poly_power_sums_schoenhage(c, a, n);
+
+            result = nmod_poly_equal(b, c);
+            if (!result)
+            {
+                flint_printf("FAIL: small characteristic\n");
+                flint_printf("n = %wd\n", n);
+                nmod_poly_print(a), flint_printf("\n\n");
+                nmod_poly_print(b), flint_printf("\n\n");
+                nmod_poly_print(c), flint_printf("\n\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_poly_power_sums_ctx_clear(ctx);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
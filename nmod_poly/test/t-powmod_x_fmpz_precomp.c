@@ -0,0 +1,144 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("powmod_x_fmpz_precomp....");
+    fflush(stdout);
+
+    /* Small moduli, several exponents per precomputation */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t res1, res2, f, finv;
+        nmod_poly_powmod_precomp_t P;
+        mp_limb_t n;
+        fmpz_t exp;
+        slong j;
+
+        fmpz_init(exp);
+
+        n = n_randtest_prime(state, 0);
+
+        nmod_poly_init(f, n);
+        nmod_poly_init(finv, n);
+        nmod_poly_init(res1, n);
+        nmod_poly_init(res2, n);
+
+        do {
+            nmod_poly_randtest(f, state, n_randint(state, 50));
+        } while (nmod_poly_is_zero(f));
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series(finv, finv, f->length);
+
+        nmod_poly_powmod_precomp_init(P, f, finv);
+
+        for (j = 0; j < 3; j++)
+        {
+            fmpz_randtest_unsigned(exp, state, n_randint(state, 100) + 1);
+
+            nmod_poly_powmod_x_fmpz_precomp(res1, exp, P);
+            nmod_poly_powmod_x_fmpz_preinv(res2, exp, f, finv);
+
+            result = (nmod_poly_equal(res1, res2));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("exp: "); fmpz_print(exp); flint_printf("\n\n");
+                flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+                flint_printf("res1:\n"); nmod_poly_print(res1), flint_printf("\n\n");
+                flint_printf("res2:\n"); nmod_poly_print(res2), flint_printf("\n\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_poly_powmod_precomp_clear(P);
+
+        fmpz_clear(exp);
+        nmod_poly_clear(f);
+        nmod_poly_clear(finv);
+        nmod_poly_clear(res1);
+        nmod_poly_clear(res2);
+    }
+
+    /* Moduli long enough for the transforms to be cached */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, res1, res2, f, finv;
+        nmod_poly_powmod_precomp_t P;
+        mp_limb_t n;
+        fmpz_t exp;
+        slong len;
+
+        fmpz_init(exp);
+
+        n = n_randprime(state, FLINT_BITS - n_randint(state, 4), 1);
+        len = NMOD_POLY_POWMOD_PRECOMP_CUTOFF*FLINT_BITS/(2*FLINT_BITS - 6)
+              + 2 + n_randint(state, 200);
+
+        fmpz_randtest_unsigned(exp, state, n_randint(state, 40) + 10);
+        fmpz_add_ui(exp, exp, 3);
+
+        nmod_poly_init(f, n);
+        nmod_poly_init(finv, n);
+        nmod_poly_init(res1, n);
+        nmod_poly_init(res2, n);
+        nmod_poly_init(a, n);
+
+        nmod_poly_randtest_monic(f, state, len);
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series(finv, finv, f->length);
+
+        nmod_poly_powmod_precomp_init(P, f, finv);
+        nmod_poly_powmod_x_fmpz_precomp(res1, exp, P);
+
+        nmod_poly_set_coeff_ui(a, 1, 1);
+        nmod_poly_powmod_fmpz_binexp_preinv(res2, a, exp, f, finv);
+
+        result = (nmod_poly_equal(res1, res2) && P->bits != 0
+                                              && P->transforms_saved > 0);
+        if (!result)
+        {
+            flint_printf("FAIL (cached):\n");
+            flint_printf("len = %wd, n = %wu\n", len, n);
+            flint_printf("exp: "); fmpz_print(exp); flint_printf("\n\n");
+            flint_printf("transforms saved = %wd\n", P->transforms_saved);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_poly_powmod_precomp_clear(P);
+
+        fmpz_clear(exp);
+        nmod_poly_clear(a);
+        nmod_poly_clear(f);
+        nmod_poly_clear(finv);
+        nmod_poly_clear(res1);
+        nmod_poly_clear(res2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -104,6 +104,42 @@ main(void)
         nmod_poly_clear(h);
     }
 
+    /* Check g^2 = h mod x^m at lengths where 60-bit moduli use cached
+       transforms */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        nmod_poly_t h, g, r;
+        slong m;
+
+        mp_limb_t n = n_randprime(state, FLINT_BITS - 4, 1);
+
+        nmod_poly_init(h, n);
+        nmod_poly_init(g, n);
+        nmod_poly_init(r, n);
+
+        nmod_poly_randtest(h, state, 6000 + n_randint(state, 6000));
+        nmod_poly_set_coeff_ui(h, 0, UWORD(1));
+
+        m = 6000 + n_randint(state, 6000);
+
+        nmod_poly_sqrt_series(g, h, m);
+        nmod_poly_mullow(r, g, g, m);
+        nmod_poly_truncate(h, m);
+
+        result = (nmod_poly_equal(r, h));
+        if (!result)
+        {
+            flint_printf("FAIL (large):\n");
+            flint_printf("m = %wd, n = %wu\n", m, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_poly_clear(h);
+        nmod_poly_clear(g);
+        nmod_poly_clear(r);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
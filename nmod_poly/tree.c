@@ -14,6 +14,7 @@
 #include "ulong_extras.h"
 #include "nmod_vec.h"
 #include "nmod_poly.h"
+#include "thread_support.h"
 
 mp_ptr * _nmod_poly_tree_alloc(slong len)
 {
@@ -44,11 +45,39 @@ void _nmod_poly_tree_free(mp_ptr * tree, slong len)
     }
 }
 
+typedef struct
+{
+    mp_srcptr pa;
+    mp_ptr pb;
+    slong pow;
+    slong len;
+    nmod_t mod;
+}
+tree_level_arg_t;
+
+/* multiply the pair k of nodes of one level into the next level */
+static void
+_tree_level_worker(slong k, tree_level_arg_t * arg)
+{
+    slong pow = arg->pow;
+    slong left = arg->len - 2 * pow * k;
+    mp_srcptr pa = arg->pa + k * (2 * pow + 2);
+    mp_ptr pb = arg->pb + k * (2 * pow + 1);
+
+    if (left >= 2 * pow)
+        _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, pow + 1, arg->mod);
+    else if (left > pow)
+        _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, arg->mod);
+    else
+        _nmod_vec_set(pb, pa, left + 1);
+}
+
 void
 _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots, slong len, nmod_t mod)
 {
-    slong height, pow, left, i;
-    mp_ptr pa, pb;
+    slong height, pow, i, thread_limit;
+    mp_ptr pa;
+    tree_level_arg_t arg;
 
     if (len == 0)
         return;
@@ -86,24 +115,22 @@ _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots, slong len, nmod_t mod)
         }
     }
 
+    thread_limit = FLINT_MIN(flint_get_num_threads(),
+                                     len / NMOD_POLY_TREE_THREAD_CUTOFF + 1);
+
+    arg.len = len;
+    arg.mod = mod;
+
     for (i = 1; i < height - 1; i++)
     {
-        left = len;
         pow = WORD(1) << i;
-        pa = tree[i];
-        pb = tree[i + 1];
 
-        while (left >= 2 * pow)
-        {
-            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, pow + 1, mod);
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow + 1;
-        }
+        arg.pa = tree[i];
+        arg.pb = tree[i + 1];
+        arg.pow = pow;
 
-        if (left > pow)
-            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, mod);
-        else if (left > 0)
-            _nmod_vec_set(pb, pa, left + 1);
+        flint_parallel_do((do_func_t) _tree_level_worker, &arg,
+                      (len + 2 * pow - 1) / (2 * pow), thread_limit,
+                                                     FLINT_PARALLEL_UNIFORM);
     }
 }
@@ -101,6 +101,9 @@ FLINT_DLL void nmod_poly_factor_concat(nmod_poly_factor_t res,
 
 FLINT_DLL void nmod_poly_factor_pow(nmod_poly_factor_t fac, slong exp);
 
+/* equal degree parts of at least this degree are split using threads */
+#define NMOD_POLY_FACTOR_EQUAL_DEG_THREAD_CUTOFF 64
+
 FLINT_DLL void nmod_poly_factor_equal_deg(nmod_poly_factor_t factors,
                                 const nmod_poly_t pol, slong d);
 
@@ -152,6 +152,119 @@ _nmod_poly_interval_poly_worker(void * arg_ptr)
     }
 }
 
+typedef struct
+{
+    nmod_poly_struct * res;
+    const nmod_poly_struct * a;
+    const nmod_poly_struct * b;
+    const nmod_poly_struct * v;
+    const nmod_poly_struct * vinv;
+}
+_interval_gcd_arg_t;
+
+static void
+_interval_mulmod_worker(void * arg_ptr)
+{
+    _interval_gcd_arg_t * arg = (_interval_gcd_arg_t *) arg_ptr;
+
+    nmod_poly_mulmod_preinv(arg->res, arg->a, arg->b, arg->v, arg->vinv);
+}
+
+static void
+_interval_gcd_worker(void * arg_ptr)
+{
+    _interval_gcd_arg_t * arg = (_interval_gcd_arg_t *) arg_ptr;
+
+    nmod_poly_gcd(arg->res, arg->a, arg->b);
+}
+
+/* run jobs 1, ..., num - 1 on the given threads and job 0 locally */
+static void
+_interval_run(void (* worker)(void *), _interval_gcd_arg_t * args, slong num,
+                                                 thread_pool_handle * threads)
+{
+    slong i;
+
+    for (i = 1; i < num; i++)
+        thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                                          worker, args + i);
+
+    worker(args + 0);
+
+    for (i = 1; i < num; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+}
+
+/*
+    Given c <= num_threads + 1 interval polynomials I, computes II, the gcd
+    of v with their product, removes it from v and replaces each I[i] by the
+    part of II not already accounted for by I[0], ..., I[i - 1]. The product
+    is formed as a balanced tree in T and the gcds of the I[i] with II are
+    independent, so both are done in parallel; only the cheap cascade of
+    gcds among the (small) results is sequential.
+*/
+static void
+_nmod_poly_interval_gcds(nmod_poly_struct * I, slong c, nmod_poly_t II,
+                  nmod_poly_t v, nmod_poly_t vinv, nmod_poly_struct * T,
+                       thread_pool_handle * threads, _interval_gcd_arg_t * args)
+{
+    slong i, k, s, num;
+
+    for (i = 0; i < c; i++)
+        nmod_poly_set(T + i, I + i);
+
+    for (s = 1; s < c; s *= 2)
+    {
+        for (num = 0, i = 0; i + s < c; i += 2*s, num++)
+        {
+            args[num].res  = T + i;
+            args[num].a    = T + i;
+            args[num].b    = T + i + s;
+            args[num].v    = v;
+            args[num].vinv = vinv;
+        }
+
+        _interval_run(_interval_mulmod_worker, args, num, threads);
+    }
+
+    nmod_poly_gcd(II, v, T + 0);
+
+    if (II->length > 1)
+    {
+        nmod_poly_remove(v, II);
+
+        nmod_poly_reverse(vinv, v, v->length);
+        nmod_poly_inv_series_newton(vinv, vinv, v->length);
+
+        for (i = 0; i < c; i++)
+        {
+            args[i].res = I + i;
+            args[i].a   = I + i;
+            args[i].b   = II;
+        }
+
+        _interval_run(_interval_gcd_worker, args, c, threads);
+
+        for (i = 1; i < c; i++)
+        {
+            for (k = 0; k < i && I[i].length > 1; k++)
+            {
+                if (I[k].length > 1)
+                {
+                    nmod_poly_gcd(T + 0, I + i, I + k);
+
+                    if (T[0].length > 1)
+                        nmod_poly_div(I + i, I + i, T + 0);
+                }
+            }
+        }
+    } else
+    {
+        for (i = 0; i < c; i++)
+            nmod_poly_one(I + i);
+    }
+}
+
 void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                                    const nmod_poly_t poly, slong * const * degs)
 {
@@ -165,6 +278,7 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
     nmod_poly_matrix_precompute_arg_t * args1;
     nmod_poly_compose_mod_precomp_preinv_arg_t * args2;
     nmod_poly_interval_poly_arg_t * args3;
+    _interval_gcd_arg_t * args4;
 
     n = nmod_poly_degree(poly);
     nmod_poly_init_mod(v, poly->mod);
@@ -222,6 +336,8 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
     args3   = (nmod_poly_interval_poly_arg_t *)
 	               flint_malloc((num_threads + 1)*
                            sizeof(nmod_poly_interval_poly_arg_t));
+    args4   = (_interval_gcd_arg_t *)
+	               flint_malloc((num_threads + 1)*sizeof(_interval_gcd_arg_t));
 
     nmod_poly_reverse(vinv, v, v->length);
     nmod_poly_inv_series(vinv, vinv, v->length);
@@ -424,32 +540,8 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                _nmod_vec_clear(args3[i].tmp);
             }
 
-            nmod_poly_one(II);
-
-            for (i = 0; i < c1; i++)
-                nmod_poly_mulmod_preinv(II, II, I + num_threads + i + 1, v,
-                                                                         vinv);
-
-            nmod_poly_gcd(II, v, II);
-
-            if (II->length > 1)
-            {
-                nmod_poly_remove(v, II);
-                nmod_poly_reverse(vinv, v, v->length);
-                nmod_poly_inv_series_newton(vinv, vinv, v->length);
-
-                for (i = 0; i < c1; i++)
-                {
-                    nmod_poly_gcd(I + num_threads + i + 1,
-                                                  I + num_threads + i + 1, II);
-                    if (I[num_threads + i + 1].length > 1)
-                        nmod_poly_remove(II, I + num_threads + i + 1);
-                }
-            } else
-            {
-                for (i = 0; i < c1; i++)
-                    nmod_poly_one(I + num_threads + i + 1);
-            }
+            _nmod_poly_interval_gcds(I + num_threads + 1, c1, II, v, vinv,
+                                                 scratch, threads, args4);
 
             d = d + c1*l;
 
@@ -541,34 +633,8 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                _nmod_vec_clear(args3[i].tmp);
             }
             
-            nmod_poly_one(II);
-
-            for (i = 0; i < c2; i++)
-                nmod_poly_mulmod_preinv(II, II, I + j*(num_threads + 1) + i,
-                                                                      v, vinv);
-
-            nmod_poly_gcd(II, v, II);
-
-            if (II->length > 1)
-            {
-                nmod_poly_remove(v, II);
-
-                nmod_poly_reverse(vinv, v, v->length);
-                nmod_poly_inv_series_newton(vinv, vinv, v->length);
-
-                for (i = 0; i < c2; i++)
-                {
-                    nmod_poly_gcd(I + j*(num_threads + 1) + i,
-                                              I + j*(num_threads + 1) + i, II);
-
-                    if (I[j*(num_threads + 1) + i].length > 1)
-                        nmod_poly_remove(II, I + j*(num_threads + 1) + i);
-                }
-            } else
-            {
-                for (i = 0; i < c2; i++)
-                    nmod_poly_one(I + j*(num_threads + 1) + i);
-            }
+            _nmod_poly_interval_gcds(I + j*(num_threads + 1), c2, II, v, vinv,
+                                                 scratch, threads, args4);
 
             d = d + c2*l;
 
@@ -639,4 +705,5 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
     flint_free(args1);
     flint_free(args2);
     flint_free(args3);
+    flint_free(args4);
 }
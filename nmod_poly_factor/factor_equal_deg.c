@@ -14,6 +14,23 @@
 
 #include "nmod_poly.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    nmod_poly_factor_struct * factors;
+    const nmod_poly_struct * pol;
+    slong d;
+}
+_equal_deg_arg_t;
+
+static void
+_equal_deg_worker(void * arg_ptr)
+{
+    _equal_deg_arg_t * arg = (_equal_deg_arg_t *) arg_ptr;
+
+    nmod_poly_factor_equal_deg(arg->factors, arg->pol, arg->d);
+}
 
 void
 nmod_poly_factor_equal_deg(nmod_poly_factor_t factors,
@@ -27,6 +44,8 @@ nmod_poly_factor_equal_deg(nmod_poly_factor_t factors,
     {
         nmod_poly_t f, g;
         flint_rand_t state;
+        slong nt, nw = 0, nw_save;
+        thread_pool_handle * threads = NULL;
 
         nmod_poly_init_mod(f, pol->mod);
 
@@ -40,9 +59,48 @@ nmod_poly_factor_equal_deg(nmod_poly_factor_t factors,
         nmod_poly_init_mod(g, pol->mod);
         nmod_poly_div(g, pol, f);
 
-        nmod_poly_factor_equal_deg(factors, f, d);
+        nt = flint_get_num_threads();
+
+        /* the two branches of the splitting tree are independent */
+        if (nt > 1 && f->length > d + 1 && g->length > d + 1 &&
+            pol->length > NMOD_POLY_FACTOR_EQUAL_DEG_THREAD_CUTOFF)
+        {
+            nw = flint_request_threads(&threads, FLINT_MIN(nt, 2));
+        }
+
+        if (nw > 0)
+        {
+            _equal_deg_arg_t arg;
+            nmod_poly_factor_t gfac;
+
+            nmod_poly_factor_init(gfac);
+
+            arg.factors = gfac;
+            arg.pol = g;
+            arg.d = d;
+
+            nw_save = flint_set_num_workers(nt - nt / 2 - 1);
+
+            thread_pool_wake(global_thread_pool, threads[0], nt / 2 - 1,
+                                                     _equal_deg_worker, &arg);
+
+            nmod_poly_factor_equal_deg(factors, f, d);
+
+            flint_reset_num_workers(nw_save);
+            thread_pool_wait(global_thread_pool, threads[0]);
+
+            nmod_poly_factor_concat(factors, gfac);
+            nmod_poly_factor_clear(gfac);
+        }
+        else
+        {
+            nmod_poly_factor_equal_deg(factors, f, d);
+            nmod_poly_factor_equal_deg(factors, g, d);
+        }
+
+        flint_give_back_threads(threads, nw);
+
         nmod_poly_clear(f);
-        nmod_poly_factor_equal_deg(factors, g, d);
         nmod_poly_clear(g);
     }
 }
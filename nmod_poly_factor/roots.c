@@ -23,11 +23,12 @@ static void _nmod_poly_push_roots(
     slong mult,                 /* expoenent to write on the roots */
     nmod_poly_t t,              /* temp */
     nmod_poly_t t2,             /* more temp */
-    nmod_poly_struct * stack,   /* temp of size FLINT_BITS */
+    nmod_poly_struct * stack,   /* temp of size 2 */
     flint_rand_t randstate)
 {
-    slong i, sp;
+    slong i, da, db;
     nmod_poly_struct * a, * b;
+    mp_ptr roots;
 
     FLINT_ASSERT(nmod_poly_degree(f) >= 1);
     FLINT_ASSERT(f->coeffs[nmod_poly_degree(f)] == 1);
@@ -100,48 +101,26 @@ static void _nmod_poly_push_roots(
     nmod_poly_add_ui(t, t, 2);
     nmod_poly_gcd(b, t, f);
 
-    /* ensure deg a >= deg b */
-    if (nmod_poly_degree(a) < nmod_poly_degree(b))
-        nmod_poly_swap(a, b);
+    da = FLINT_MAX(nmod_poly_degree(a), 0);
+    db = FLINT_MAX(nmod_poly_degree(b), 0);
 
-    nmod_poly_factor_fit_length(r, r->num + nmod_poly_degree(a) +
-                                            nmod_poly_degree(b));
+    roots = _nmod_vec_init(da + db);
+    _nmod_poly_split_rabin_roots(roots, a, b, randstate);
 
-    /* initial split failed if b = 1 */
-    sp = (nmod_poly_degree(b) > 0) ? 2 : 1;
-    while (sp > 0)
-    {
-        sp--;
-        FLINT_ASSERT(sp < FLINT_BITS);
-        nmod_poly_swap(f, stack + sp);
-        FLINT_ASSERT(nmod_poly_degree(f) >= 0);
-        FLINT_ASSERT(FLINT_BIT_COUNT(nmod_poly_degree(f)) <= FLINT_BITS - sp);
+    nmod_poly_factor_fit_length(r, r->num + da + db);
 
-        if (nmod_poly_degree(f) <= 1)
-        {
-            if (nmod_poly_degree(f) == 1)
-            {
-                FLINT_ASSERT(r->num < r->alloc);
-                r->p[r->num].mod = f->mod;       /* bummer */
-                nmod_poly_set(r->p + r->num, f);
-                r->exp[r->num] = mult;
-                r->num++;
-            }
-        }
-        else
-        {
-            FLINT_ASSERT(sp + 1 < FLINT_BITS);
-
-            _nmod_poly_split_rabin(stack + sp + 0, stack + sp + 1, f, t, t2,
-                                                                    randstate);
-
-            FLINT_ASSERT(FLINT_BIT_COUNT(nmod_poly_degree(stack + sp + 1))
-                                                 <= FLINT_BITS - (sp + 1));
-            FLINT_ASSERT(FLINT_BIT_COUNT(nmod_poly_degree(stack + sp + 0))
-                                                 <= FLINT_BITS - (sp + 0));
-            sp += 2;
-        }
+    for (i = 0; i < da + db; i++)
+    {
+        r->p[r->num].mod = f->mod;       /* bummer */
+        nmod_poly_fit_length(r->p + r->num, 2);
+        r->p[r->num].coeffs[0] = nmod_neg(roots[i], f->mod);
+        r->p[r->num].coeffs[1] = 1;
+        r->p[r->num].length = 2;
+        r->exp[r->num] = mult;
+        r->num++;
     }
+
+    _nmod_vec_clear(roots);
 }
 
 void nmod_poly_roots(nmod_poly_factor_t r, const nmod_poly_t f,
@@ -149,7 +128,7 @@ void nmod_poly_roots(nmod_poly_factor_t r, const nmod_poly_t f,
 {
     slong i;
     flint_rand_t randstate;
-    nmod_poly_struct t[FLINT_BITS + 3];
+    nmod_poly_struct t[5];
 
     FLINT_ASSERT(n_is_probabprime(f->mod.n));
 
@@ -175,7 +154,7 @@ void nmod_poly_roots(nmod_poly_factor_t r, const nmod_poly_t f,
 
     flint_randinit(randstate);
 
-    for (i = 0; i < FLINT_BITS + 3; i++)
+    for (i = 0; i < 5; i++)
         nmod_poly_init_mod(t + i, f->mod);
 
     if (with_multiplicity)
@@ -198,7 +177,7 @@ void nmod_poly_roots(nmod_poly_factor_t r, const nmod_poly_t f,
 
     flint_randclear(randstate);
 
-    for (i = 0; i < FLINT_BITS + 3; i++)
+    for (i = 0; i < 5; i++)
         nmod_poly_clear(t + i);
 }
 
@@ -0,0 +1,145 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+#if FLINT_USES_PTHREAD && (FLINT_USES_TLS || FLINT_REENTRANT)
+    slong iter;
+#endif
+    FLINT_TEST_INIT(state);
+
+    flint_printf("roots_threaded....");
+    fflush(stdout);
+
+#if FLINT_USES_PTHREAD && (FLINT_USES_TLS || FLINT_REENTRANT)
+    for (iter = 0; iter < 4 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_t f, g;
+        nmod_poly_factor_t r, e;
+        mp_ptr xs, ys;
+        mp_limb_t p;
+        slong i, j, n;
+
+        p = n_randprime(state, 12 + n_randint(state, FLINT_BITS - 12), 1);
+        n = NMOD_POLY_SPLIT_THREAD_CUTOFF + n_randint(state, 200);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        nmod_poly_init(f, p);
+        nmod_poly_init(g, p);
+        nmod_poly_factor_init(r);
+        nmod_poly_factor_init(e);
+        xs = _nmod_vec_init(n);
+        ys = _nmod_vec_init(n);
+
+        /* f is a product of n distinct linear factors, with nonzero roots */
+        nmod_poly_one(f);
+        for (i = 0; i < n; i++)
+        {
+            do {
+                xs[i] = 1 + n_randint(state, p - 1);
+                for (j = 0; j < i; j++)
+                    if (xs[j] == xs[i])
+                        break;
+            } while (j < i);
+
+            nmod_poly_zero(g);
+            nmod_poly_set_coeff_ui(g, 1, 1);
+            nmod_poly_set_coeff_ui(g, 0, nmod_neg(xs[i], f->mod));
+            nmod_poly_mul(f, f, g);
+        }
+
+        if (!nmod_poly_find_distinct_nonzero_roots(ys, f))
+        {
+            flint_printf("FAIL:\nfind_distinct_nonzero_roots failed\n");
+            flint_printf("p = %wu, n = %wd\n", p, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            if (nmod_poly_evaluate_nmod(f, ys[i]) != 0)
+            {
+                flint_printf("FAIL:\nbad root from find_distinct_nonzero_roots\n");
+                flint_printf("p = %wu, n = %wd, i = %wd\n", p, n, i);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            for (j = 0; j < i; j++)
+            {
+                if (ys[j] == ys[i])
+                {
+                    flint_printf("FAIL:\nrepeated root\n");
+                    flint_printf("p = %wu, n = %wd, i = %wd\n", p, n, i);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        nmod_poly_roots(r, f, 1);
+        nmod_poly_factor_equal_deg(e, f, 1);
+
+        if (r->num != n || e->num != n)
+        {
+            flint_printf("FAIL:\nwrong number of roots\n");
+            flint_printf("p = %wu, n = %wd, %wd, %wd\n", p, n, r->num, e->num);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            if (r->p[i].length != 2 || r->exp[i] != 1 ||
+                nmod_poly_evaluate_nmod(f, nmod_neg(r->p[i].coeffs[0], f->mod)) != 0)
+            {
+                flint_printf("FAIL:\nbad factor from roots\n");
+                flint_printf("p = %wu, n = %wd, i = %wd\n", p, n, i);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_poly_one(g);
+        for (i = 0; i < e->num; i++)
+            nmod_poly_mul(g, g, e->p + i);
+
+        if (!nmod_poly_equal(f, g))
+        {
+            flint_printf("FAIL:\nproduct of equal degree factors\n");
+            flint_printf("p = %wu, n = %wd\n", p, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(xs);
+        _nmod_vec_clear(ys);
+        nmod_poly_factor_clear(r);
+        nmod_poly_factor_clear(e);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+#else
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("SKIPPED\n");
+    return 0;
+#endif
+}
@@ -0,0 +1,155 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define NMOD_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "thread_support.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Compressed sparse row storage: the nonzero entries of row i are
+    entries[k] in column cols[k] for row_starts[i] <= k < row_starts[i + 1],
+    with strictly increasing columns. All entries are reduced and nonzero.
+*/
+typedef struct
+{
+    slong r;
+    slong c;
+    slong * row_starts;
+    slong * cols;
+    mp_ptr entries;
+    slong row_alloc;    /* allocated length of row_starts minus one */
+    slong alloc;        /* allocated length of cols and entries */
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+/* Memory management and basic manipulation **********************************/
+
+FLINT_DLL void nmod_sparse_mat_init(nmod_sparse_mat_t M,
+                                            slong rows, slong cols, mp_limb_t n);
+
+FLINT_DLL void nmod_sparse_mat_clear(nmod_sparse_mat_t M);
+
+FLINT_DLL void nmod_sparse_mat_fit_length(nmod_sparse_mat_t M,
+                                                       slong rows, slong nnz);
+
+NMOD_SPARSE_MAT_INLINE
+void nmod_sparse_mat_swap(nmod_sparse_mat_t M1, nmod_sparse_mat_t M2)
+{
+    nmod_sparse_mat_struct t = *M1;
+    *M1 = *M2;
+    *M2 = t;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t M)
+{
+    return M->row_starts[M->r];
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t M)
+{
+    return M->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t M)
+{
+    return M->c;
+}
+
+FLINT_DLL void nmod_sparse_mat_zero(nmod_sparse_mat_t M);
+
+FLINT_DLL void nmod_sparse_mat_set(nmod_sparse_mat_t M,
+                                                   const nmod_sparse_mat_t A);
+
+FLINT_DLL void nmod_sparse_mat_append_row(nmod_sparse_mat_t M,
+                               const slong * cols, mp_srcptr vals, slong len);
+
+FLINT_DLL int nmod_sparse_mat_equal(const nmod_sparse_mat_t A,
+                                                   const nmod_sparse_mat_t B);
+
+FLINT_DLL void nmod_sparse_mat_transpose(nmod_sparse_mat_t B,
+                                                   const nmod_sparse_mat_t A);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t M,
+                                                           const nmod_mat_t A);
+
+FLINT_DLL void nmod_sparse_mat_get_nmod_mat(nmod_mat_t A,
+                                                   const nmod_sparse_mat_t M);
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void nmod_sparse_mat_randtest(nmod_sparse_mat_t M,
+                     flint_rand_t state, slong rows, slong cols, slong weight);
+
+/* Matrix-vector products ****************************************************/
+
+FLINT_DLL void nmod_sparse_mat_mul_vec(mp_ptr y,
+                                  const nmod_sparse_mat_t M, mp_srcptr x);
+
+FLINT_DLL void nmod_sparse_mat_mul_vec_transpose(mp_ptr y,
+                                  const nmod_sparse_mat_t M, mp_srcptr x);
+
+/* Solving *******************************************************************/
+
+FLINT_DLL int nmod_sparse_mat_solve_wiedemann(mp_ptr x,
+            const nmod_sparse_mat_t M, mp_srcptr b, flint_rand_t state);
+
+FLINT_DLL int nmod_sparse_mat_solve(mp_ptr x,
+            const nmod_sparse_mat_t M, mp_srcptr b, flint_rand_t state);
+
+FLINT_DLL int nmod_sparse_mat_nullvector_wiedemann(mp_ptr x,
+                            const nmod_sparse_mat_t M, flint_rand_t state);
+
+FLINT_DLL slong nmod_sparse_mat_rank_wiedemann(const nmod_sparse_mat_t M,
+                                                         flint_rand_t state);
+
+/* Internal ******************************************************************/
+
+typedef void (*nmod_sparse_mat_op_t)(mp_ptr y, mp_srcptr x, const void * data);
+
+FLINT_DLL void _nmod_sparse_mat_krylov_minpoly(nmod_poly_t f,
+                 nmod_sparse_mat_op_t op, const void * data, mp_srcptr b,
+                                  slong n, nmod_t mod, flint_rand_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
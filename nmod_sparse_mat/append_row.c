@@ -0,0 +1,78 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong col;
+    mp_limb_t val;
+} _col_val_struct;
+
+static int
+_col_val_cmp(const void * a, const void * b)
+{
+    slong x = ((const _col_val_struct *) a)->col;
+    slong y = ((const _col_val_struct *) b)->col;
+
+    return (x > y) - (x < y);
+}
+
+void
+nmod_sparse_mat_append_row(nmod_sparse_mat_t M, const slong * cols,
+                                                    mp_srcptr vals, slong len)
+{
+    _col_val_struct * t;
+    slong i, k, start;
+    mp_limb_t v;
+
+    start = M->row_starts[M->r];
+    nmod_sparse_mat_fit_length(M, M->r + 1, start + len);
+
+    t = (_col_val_struct *) flint_malloc(len*sizeof(_col_val_struct));
+
+    for (i = k = 0; i < len; i++)
+    {
+        if (cols[i] < 0 || cols[i] >= M->c)
+        {
+            flint_printf("Exception (nmod_sparse_mat_append_row). "
+                                                  "Column out of range.\n");
+            flint_abort();
+        }
+
+        NMOD_RED(v, vals[i], M->mod);
+
+        if (v != 0)
+        {
+            t[k].col = cols[i];
+            t[k].val = v;
+            k++;
+        }
+    }
+
+    qsort(t, k, sizeof(_col_val_struct), _col_val_cmp);
+
+    for (i = 0; i < k; i++)
+    {
+        if (i > 0 && t[i].col == t[i - 1].col)
+        {
+            flint_printf("Exception (nmod_sparse_mat_append_row). "
+                                                  "Repeated column.\n");
+            flint_abort();
+        }
+
+        M->cols[start + i] = t[i].col;
+        M->entries[start + i] = t[i].val;
+    }
+
+    flint_free(t);
+
+    M->r++;
+    M->row_starts[M->r] = start + k;
+}
@@ -0,0 +1,30 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_fit_length(nmod_sparse_mat_t M, slong rows, slong nnz)
+{
+    if (rows > M->row_alloc)
+    {
+        rows = FLINT_MAX(rows, 2*M->row_alloc);
+        M->row_starts = (slong *) flint_realloc(M->row_starts,
+                                                   (rows + 1)*sizeof(slong));
+        M->row_alloc = rows;
+    }
+
+    if (nnz > M->alloc)
+    {
+        nnz = FLINT_MAX(nnz, 2*M->alloc);
+        M->cols = (slong *) flint_realloc(M->cols, nnz*sizeof(slong));
+        M->entries = (mp_ptr) flint_realloc(M->entries, nnz*sizeof(mp_limb_t));
+        M->alloc = nnz;
+    }
+}
@@ -0,0 +1,69 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+#define KRYLOV_BATCH 32
+
+/*
+    Sets f to the minimal polynomial of the sequence u^T A^i b for a
+    random vector u, where y = A x is computed by op(y, x, data) and A is
+    n x n. The sequence is fed to Berlekamp-Massey in batches and stops
+    once a batch of KRYLOV_BATCH terms beyond twice the degree has not
+    changed the recurrence, and in any case after 2n terms. With high
+    probability f is the minimal polynomial of A with respect to b.
+*/
+void
+_nmod_sparse_mat_krylov_minpoly(nmod_poly_t f, nmod_sparse_mat_op_t op,
+                const void * data, mp_srcptr b, slong n, nmod_t mod,
+                                                         flint_rand_t state)
+{
+    nmod_berlekamp_massey_t B;
+    mp_ptr u, v, w, t;
+    slong i, j;
+    int nlimbs, changed;
+
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+
+    for (i = 0; i < n; i++)
+        u[i] = n_randint(state, mod.n);
+
+    _nmod_vec_set(v, b, n);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+
+    nmod_berlekamp_massey_init(B, mod.n);
+
+    for (i = 0; i < 2*n; )
+    {
+        for (j = 0; j < KRYLOV_BATCH && i < 2*n; j++, i++)
+        {
+            nmod_berlekamp_massey_add_point(B,
+                                          _nmod_vec_dot(u, v, n, mod, nlimbs));
+            op(w, v, data);
+            t = v; v = w; w = t;
+        }
+
+        changed = nmod_berlekamp_massey_reduce(B);
+
+        if (!changed && i >= 2*nmod_poly_degree(
+                         nmod_berlekamp_massey_V_poly(B)) + KRYLOV_BATCH)
+            break;
+    }
+
+    nmod_poly_make_monic(f, nmod_berlekamp_massey_V_poly(B));
+
+    nmod_berlekamp_massey_clear(B);
+
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+}
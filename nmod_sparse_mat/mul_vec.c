@@ -0,0 +1,107 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/* below this many nonzero entries the threads are not woken */
+#define MUL_VEC_THREADED_CUTOFF 20000
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * M;
+    mp_srcptr x;
+    slong start;
+    slong stop;
+    int nlimbs;
+} _mul_vec_arg_t;
+
+static void
+_mul_vec_worker(void * varg)
+{
+    _mul_vec_arg_t * arg = (_mul_vec_arg_t *) varg;
+    const nmod_sparse_mat_struct * M = arg->M;
+    mp_srcptr x = arg->x;
+    nmod_t mod = M->mod;
+    int nlimbs = arg->nlimbs;
+    slong i, j, len;
+    const slong * cols;
+    mp_srcptr e;
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        cols = M->cols + M->row_starts[i];
+        e = M->entries + M->row_starts[i];
+        len = M->row_starts[i + 1] - M->row_starts[i];
+
+        NMOD_VEC_DOT(arg->y[i], j, len, e[j], x[cols[j]], mod, nlimbs);
+    }
+}
+
+/* first row whose entries start at or after position k */
+static slong
+_row_of_entry(const nmod_sparse_mat_t M, slong k)
+{
+    slong lo = 0, hi = M->r;
+
+    while (lo < hi)
+    {
+        slong mid = lo + (hi - lo)/2;
+
+        if (M->row_starts[mid] < k)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t M, mp_srcptr x)
+{
+    _mul_vec_arg_t * args;
+    thread_pool_handle * threads;
+    slong i, nw, nnz;
+    int nlimbs;
+
+    nnz = nmod_sparse_mat_nnz(M);
+    nlimbs = _nmod_vec_dot_bound_limbs(M->c, M->mod);
+
+    if (nnz < MUL_VEC_THREADED_CUTOFF)
+        nw = 0, threads = NULL;
+    else
+        nw = flint_request_threads(&threads, flint_get_num_threads());
+
+    args = (_mul_vec_arg_t *) flint_malloc((nw + 1)*sizeof(_mul_vec_arg_t));
+
+    /* share out the rows so that each thread gets as many entries */
+    for (i = 0; i <= nw; i++)
+    {
+        args[i].y = y;
+        args[i].M = M;
+        args[i].x = x;
+        args[i].start = (i == 0) ? 0 : args[i - 1].stop;
+        args[i].stop = (i == nw) ? M->r :
+                                   _row_of_entry(M, (i + 1)*(nnz/(nw + 1)));
+        args[i].nlimbs = nlimbs;
+    }
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wake(global_thread_pool, threads[i], 0,
+                                                   _mul_vec_worker, &args[i]);
+
+    _mul_vec_worker(&args[nw]);
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wait(global_thread_pool, threads[i]);
+
+    flint_give_back_threads(threads, nw);
+    flint_free(args);
+}
@@ -0,0 +1,95 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/* below this many nonzero entries the threads are not woken */
+#define MUL_VEC_TRANSPOSE_THREADED_CUTOFF 20000
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * M;
+    mp_srcptr x;
+    slong start;
+    slong stop;
+} _mul_vec_transpose_arg_t;
+
+/* y += (rows start..stop of M)^T x */
+static void
+_mul_vec_transpose_worker(void * varg)
+{
+    _mul_vec_transpose_arg_t * arg = (_mul_vec_transpose_arg_t *) varg;
+    const nmod_sparse_mat_struct * M = arg->M;
+    mp_ptr y = arg->y;
+    nmod_t mod = M->mod;
+    slong i, k;
+    mp_limb_t c;
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        c = arg->x[i];
+
+        if (c == 0)
+            continue;
+
+        for (k = M->row_starts[i]; k < M->row_starts[i + 1]; k++)
+            NMOD_ADDMUL(y[M->cols[k]], M->entries[k], c, mod);
+    }
+}
+
+/*
+    The rows are shared out between the threads, each of which scatters
+    its part of the product into a vector of its own; the vectors are
+    added up at the end.
+*/
+void
+nmod_sparse_mat_mul_vec_transpose(mp_ptr y, const nmod_sparse_mat_t M,
+                                                                mp_srcptr x)
+{
+    _mul_vec_transpose_arg_t * args;
+    thread_pool_handle * threads;
+    slong i, nw, nnz;
+
+    nnz = nmod_sparse_mat_nnz(M);
+
+    if (nnz < MUL_VEC_TRANSPOSE_THREADED_CUTOFF)
+        nw = 0, threads = NULL;
+    else
+        nw = flint_request_threads(&threads, flint_get_num_threads());
+
+    args = (_mul_vec_transpose_arg_t *)
+                  flint_malloc((nw + 1)*sizeof(_mul_vec_transpose_arg_t));
+
+    for (i = 0; i <= nw; i++)
+    {
+        args[i].y = (i == nw) ? y : _nmod_vec_init(M->c);
+        args[i].M = M;
+        args[i].x = x;
+        args[i].start = (i*M->r)/(nw + 1);
+        args[i].stop = ((i + 1)*M->r)/(nw + 1);
+        _nmod_vec_zero(args[i].y, M->c);
+    }
+
+    for (i = 0; i < nw; i++)
+        thread_pool_wake(global_thread_pool, threads[i], 0,
+                                         _mul_vec_transpose_worker, &args[i]);
+
+    _mul_vec_transpose_worker(&args[nw]);
+
+    for (i = 0; i < nw; i++)
+    {
+        thread_pool_wait(global_thread_pool, threads[i]);
+        _nmod_vec_add(y, y, args[i].y, M->c, M->mod);
+        _nmod_vec_clear(args[i].y);
+    }
+
+    flint_give_back_threads(threads, nw);
+    flint_free(args);
+}
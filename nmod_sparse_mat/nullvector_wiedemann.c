@@ -0,0 +1,114 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/* y = M x with M padded by zero rows to a square matrix */
+static void
+_mul_vec_padded_op(mp_ptr y, mp_srcptr x, const void * data)
+{
+    const nmod_sparse_mat_struct * M = (const nmod_sparse_mat_struct *) data;
+
+    nmod_sparse_mat_mul_vec(y, M, x);
+    _nmod_vec_zero(y + M->r, M->c - M->r);
+}
+
+/*
+    With A the padded matrix, b = A z and f the minimal polynomial of A
+    with respect to b, we have A^k h(A) z = 0 where X f = X^k h and
+    h(0) != 0. Unless h(A) z vanishes, the last nonzero vector in
+    h(A) z, A h(A) z, ..., A^k h(A) z is in the nullspace.
+*/
+int
+nmod_sparse_mat_nullvector_wiedemann(mp_ptr x, const nmod_sparse_mat_t M,
+                                                         flint_rand_t state)
+{
+    nmod_poly_t f;
+    mp_ptr z, y, t, s;
+    slong i, j, n, k, v, attempt;
+    int success = 0;
+
+    if (M->r > M->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_nullvector_wiedemann). "
+                                         "More rows than columns.\n");
+        flint_abort();
+    }
+
+    n = M->c;
+
+    if (n == 0)
+        return 0;
+
+    nmod_poly_init_mod(f, M->mod);
+    z = _nmod_vec_init(n);
+    y = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+
+    for (attempt = 0; attempt < 3 && !success; attempt++)
+    {
+        for (i = 0; i < n; i++)
+            z[i] = n_randint(state, M->mod.n);
+
+        _mul_vec_padded_op(y, z, M);
+
+        if (_nmod_vec_is_zero(y, n))
+        {
+            if (!_nmod_vec_is_zero(z, n))
+            {
+                _nmod_vec_set(x, z, n);
+                success = 1;
+            }
+            continue;
+        }
+
+        _nmod_sparse_mat_krylov_minpoly(f, _mul_vec_padded_op, M, y, n,
+                                                            M->mod, state);
+
+        for (v = 0; v < f->length && f->coeffs[v] == 0; v++)
+            ;
+
+        k = v + 1;
+
+        /* y = h(A) z where h = f/X^v */
+        _nmod_vec_scalar_mul_nmod(y, z, n, f->coeffs[f->length - 1], M->mod);
+
+        for (i = f->length - 2; i >= v; i--)
+        {
+            _mul_vec_padded_op(t, y, M);
+            _nmod_vec_scalar_addmul_nmod(t, z, n, f->coeffs[i], M->mod);
+            s = y; y = t; t = s;
+        }
+
+        /* always the case if A is nonsingular */
+        if (_nmod_vec_is_zero(y, n))
+            continue;
+
+        for (j = 0; j < k; j++)
+        {
+            _mul_vec_padded_op(t, y, M);
+
+            if (_nmod_vec_is_zero(t, n))
+            {
+                _nmod_vec_set(x, y, n);
+                success = 1;
+                break;
+            }
+
+            s = y; y = t; t = s;
+        }
+    }
+
+    nmod_poly_clear(f);
+    _nmod_vec_clear(z);
+    _nmod_vec_clear(y);
+    _nmod_vec_clear(t);
+
+    return success;
+}
@@ -0,0 +1,59 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+/*
+    Each row gets up to weight entries in random columns; a few rows are
+    left empty or made denser to exercise the corner cases.
+*/
+void
+nmod_sparse_mat_randtest(nmod_sparse_mat_t M, flint_rand_t state,
+                                          slong rows, slong cols, slong weight)
+{
+    slong i, j, len;
+    slong * c;
+    mp_ptr v;
+
+    M->r = 0;
+    M->c = cols;
+    M->row_starts[0] = 0;
+
+    c = (slong *) flint_malloc((cols + 1)*sizeof(slong));
+    v = _nmod_vec_init(cols + 1);
+
+    for (j = 0; j < cols; j++)
+        c[j] = j;
+
+    for (i = 0; i < rows; i++)
+    {
+        if (cols == 0 || n_randint(state, 20) == 0)
+            len = 0;
+        else if (n_randint(state, 20) == 0)
+            len = n_randint(state, cols + 1);
+        else
+            len = n_randint(state, FLINT_MIN(weight, cols) + 1);
+
+        /* distinct columns by a partial Fisher-Yates shuffle */
+        for (j = 0; j < len; j++)
+        {
+            slong k = j + n_randint(state, cols - j);
+            slong t = c[j];
+            c[j] = c[k];
+            c[k] = t;
+
+            v[j] = n_randtest(state);
+        }
+
+        nmod_sparse_mat_append_row(M, c, v, len);
+    }
+
+    flint_free(c);
+    _nmod_vec_clear(v);
+}
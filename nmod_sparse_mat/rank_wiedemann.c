@@ -0,0 +1,106 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    const nmod_sparse_mat_struct * M;
+    mp_srcptr d1;
+    mp_srcptr d2;
+    mp_ptr s;
+    mp_ptr t;
+} _precond_op_struct;
+
+/* y = D1 M^T D2 M D1 x */
+static void
+_precond_op(mp_ptr y, mp_srcptr x, const void * data)
+{
+    const _precond_op_struct * P = (const _precond_op_struct *) data;
+    const nmod_sparse_mat_struct * M = P->M;
+    slong i;
+
+    for (i = 0; i < M->c; i++)
+        P->t[i] = nmod_mul(P->d1[i], x[i], M->mod);
+
+    nmod_sparse_mat_mul_vec(P->s, M, P->t);
+
+    for (i = 0; i < M->r; i++)
+        P->s[i] = nmod_mul(P->d2[i], P->s[i], M->mod);
+
+    nmod_sparse_mat_mul_vec_transpose(y, M, P->s);
+
+    for (i = 0; i < M->c; i++)
+        y[i] = nmod_mul(P->d1[i], y[i], M->mod);
+}
+
+/*
+    For random nonsingular diagonal D1 and D2, the symmetric matrix
+    D1 M^T D2 M D1 has the same rank as M and a minimal polynomial of
+    degree rank + 1 (if singular) or rank, with high probability when
+    the modulus is large compared to the dimensions. The degree found
+    from a random Krylov sequence can only be too small, so the best
+    of two trials is returned.
+*/
+slong
+nmod_sparse_mat_rank_wiedemann(const nmod_sparse_mat_t M, flint_rand_t state)
+{
+    _precond_op_struct P;
+    nmod_poly_t f;
+    mp_ptr d1, d2, b;
+    slong i, n, rank, r, attempt;
+
+    n = M->c;
+
+    if (M->r == 0 || n == 0)
+        return 0;
+
+    nmod_poly_init_mod(f, M->mod);
+    d1 = _nmod_vec_init(n);
+    d2 = _nmod_vec_init(M->r);
+    b = _nmod_vec_init(n);
+
+    P.M = M;
+    P.d1 = d1;
+    P.d2 = d2;
+    P.s = _nmod_vec_init(M->r);
+    P.t = _nmod_vec_init(n);
+
+    rank = 0;
+
+    for (attempt = 0; attempt < 2; attempt++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            d1[i] = n_randint(state, M->mod.n - 1) + 1;
+            b[i] = n_randint(state, M->mod.n);
+        }
+
+        for (i = 0; i < M->r; i++)
+            d2[i] = n_randint(state, M->mod.n - 1) + 1;
+
+        _nmod_sparse_mat_krylov_minpoly(f, _precond_op, &P, b, n,
+                                                            M->mod, state);
+
+        r = nmod_poly_degree(f);
+        if (r > 0 && f->coeffs[0] == 0)
+            r--;
+
+        rank = FLINT_MAX(rank, r);
+    }
+
+    nmod_poly_clear(f);
+    _nmod_vec_clear(d1);
+    _nmod_vec_clear(d2);
+    _nmod_vec_clear(b);
+    _nmod_vec_clear(P.s);
+    _nmod_vec_clear(P.t);
+
+    return FLINT_MIN(rank, FLINT_MIN(M->r, n));
+}
@@ -0,0 +1,36 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set(nmod_sparse_mat_t M, const nmod_sparse_mat_t A)
+{
+    slong i, nnz;
+
+    if (M == A)
+        return;
+
+    nnz = nmod_sparse_mat_nnz(A);
+
+    nmod_sparse_mat_fit_length(M, A->r, nnz);
+
+    for (i = 0; i <= A->r; i++)
+        M->row_starts[i] = A->row_starts[i];
+
+    for (i = 0; i < nnz; i++)
+    {
+        M->cols[i] = A->cols[i];
+        M->entries[i] = A->entries[i];
+    }
+
+    M->r = A->r;
+    M->c = A->c;
+    M->mod = A->mod;
+}
@@ -0,0 +1,43 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t M, const nmod_mat_t A)
+{
+    slong i, j, k;
+
+    k = 0;
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            k += (nmod_mat_entry(A, i, j) != 0);
+
+    nmod_sparse_mat_fit_length(M, A->r, k);
+
+    M->r = A->r;
+    M->c = A->c;
+    M->mod = A->mod;
+
+    k = 0;
+    M->row_starts[0] = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c; j++)
+        {
+            if (nmod_mat_entry(A, i, j) != 0)
+            {
+                M->cols[k] = j;
+                M->entries[k] = nmod_mat_entry(A, i, j);
+                k++;
+            }
+        }
+        M->row_starts[i + 1] = k;
+    }
+}
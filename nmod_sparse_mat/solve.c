@@ -0,0 +1,228 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+#define ELIM_ROW 0
+#define ELIM_COL 1
+
+/* solve row i of M x = b for x_j, all other unknowns in the row being known */
+static void
+_solve_row(mp_ptr x, const nmod_sparse_mat_t M, mp_srcptr b, slong i, slong j)
+{
+    slong l, p = 0;
+    mp_limb_t s = b[i];
+
+    for (l = M->row_starts[i]; l < M->row_starts[i + 1]; l++)
+    {
+        if (M->cols[l] == j)
+            p = l;
+        else
+            s = nmod_sub(s, nmod_mul(M->entries[l], x[M->cols[l]], M->mod),
+                                                                      M->mod);
+    }
+
+    x[j] = nmod_div(s, M->entries[p], M->mod);
+}
+
+/*
+    Structured Gaussian elimination of singletons before Wiedemann. A row
+    with a single active entry a_ij fixes x_j, and a column with a single
+    active entry a_ij lets row i be dropped and solved for x_j once all
+    other unknowns are known. Either way one row and one column leave the
+    system, so it stays square. Row singleton values only depend on
+    earlier row singletons and are found first, the remaining core only
+    involves row singleton columns besides its own, and column singletons
+    are solved last in reverse order of elimination.
+*/
+int
+nmod_sparse_mat_solve(mp_ptr x, const nmod_sparse_mat_t M, mp_srcptr b,
+                                                         flint_rand_t state)
+{
+    nmod_sparse_mat_t T, C;
+    slong * row_cnt, * col_cnt, * stack, * elim_row, * elim_col, * core_col;
+    char * row_active, * col_active, * elim_type;
+    slong * ccols;
+    mp_ptr cvals, cb, cx;
+    slong i, j, k, n, m, top, num_elim, len;
+    mp_limb_t s;
+    int success = 1;
+
+    if (M->r != M->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_solve). "
+                                                 "Non-square matrix.\n");
+        flint_abort();
+    }
+
+    n = M->r;
+
+    if (n == 0)
+        return 1;
+
+    nmod_sparse_mat_init(T, 0, 0, M->mod.n);
+    nmod_sparse_mat_transpose(T, M);
+
+    row_cnt = flint_malloc(n*sizeof(slong));
+    col_cnt = flint_malloc(n*sizeof(slong));
+    stack = flint_malloc(2*n*sizeof(slong));
+    elim_row = flint_malloc(n*sizeof(slong));
+    elim_col = flint_malloc(n*sizeof(slong));
+    core_col = flint_malloc(n*sizeof(slong));
+    row_active = flint_malloc(n);
+    col_active = flint_malloc(n);
+    elim_type = flint_malloc(n);
+
+    top = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        row_cnt[i] = M->row_starts[i + 1] - M->row_starts[i];
+        col_cnt[i] = T->row_starts[i + 1] - T->row_starts[i];
+        row_active[i] = col_active[i] = 1;
+
+        if (row_cnt[i] == 1)
+            stack[top++] = i;
+        if (col_cnt[i] == 1)
+            stack[top++] = -i - 1;
+    }
+
+    num_elim = 0;
+
+    while (top > 0)
+    {
+        k = stack[--top];
+
+        if (k >= 0)
+        {
+            i = k;
+            if (!row_active[i] || row_cnt[i] != 1)
+                continue;
+            for (k = M->row_starts[i]; !col_active[M->cols[k]]; k++)
+                ;
+            j = M->cols[k];
+            elim_type[num_elim] = ELIM_ROW;
+        }
+        else
+        {
+            j = -k - 1;
+            if (!col_active[j] || col_cnt[j] != 1)
+                continue;
+            for (k = T->row_starts[j]; !row_active[T->cols[k]]; k++)
+                ;
+            i = T->cols[k];
+            elim_type[num_elim] = ELIM_COL;
+        }
+
+        elim_row[num_elim] = i;
+        elim_col[num_elim] = j;
+        num_elim++;
+
+        row_active[i] = col_active[j] = 0;
+
+        for (k = M->row_starts[i]; k < M->row_starts[i + 1]; k++)
+        {
+            if (col_active[M->cols[k]] && --col_cnt[M->cols[k]] == 1)
+                stack[top++] = -M->cols[k] - 1;
+        }
+
+        for (k = T->row_starts[j]; k < T->row_starts[j + 1]; k++)
+        {
+            if (row_active[T->cols[k]] && --row_cnt[T->cols[k]] == 1)
+                stack[top++] = T->cols[k];
+        }
+    }
+
+    /* an empty active row or column means M is singular */
+    for (i = 0; i < n && success; i++)
+        if ((row_active[i] && row_cnt[i] == 0) ||
+            (col_active[i] && col_cnt[i] == 0))
+            success = 0;
+
+    /* row singletons */
+    for (k = 0; k < num_elim && success; k++)
+        if (elim_type[k] == ELIM_ROW)
+            _solve_row(x, M, b, elim_row[k], elim_col[k]);
+
+    /* the core */
+    m = n - num_elim;
+
+    if (success && m > 0)
+    {
+        for (j = 0, k = 0; j < n; j++)
+            if (col_active[j])
+                core_col[j] = k++;
+
+        nmod_sparse_mat_init(C, 0, m, M->mod.n);
+        ccols = flint_malloc(n*sizeof(slong));
+        cvals = _nmod_vec_init(n);
+        cb = _nmod_vec_init(m);
+        cx = _nmod_vec_init(m);
+
+        for (i = 0, k = 0; i < n; i++)
+        {
+            slong l;
+
+            if (!row_active[i])
+                continue;
+
+            s = b[i];
+            len = 0;
+
+            for (l = M->row_starts[i]; l < M->row_starts[i + 1]; l++)
+            {
+                j = M->cols[l];
+
+                if (col_active[j])
+                {
+                    ccols[len] = core_col[j];
+                    cvals[len] = M->entries[l];
+                    len++;
+                }
+                else
+                    s = nmod_sub(s, nmod_mul(M->entries[l], x[j], M->mod),
+                                                                      M->mod);
+            }
+
+            nmod_sparse_mat_append_row(C, ccols, cvals, len);
+            cb[k++] = s;
+        }
+
+        success = nmod_sparse_mat_solve_wiedemann(cx, C, cb, state);
+
+        if (success)
+            for (j = 0; j < n; j++)
+                if (col_active[j])
+                    x[j] = cx[core_col[j]];
+
+        nmod_sparse_mat_clear(C);
+        flint_free(ccols);
+        _nmod_vec_clear(cvals);
+        _nmod_vec_clear(cb);
+        _nmod_vec_clear(cx);
+    }
+
+    /* column singletons */
+    for (k = num_elim - 1; k >= 0 && success; k--)
+        if (elim_type[k] == ELIM_COL)
+            _solve_row(x, M, b, elim_row[k], elim_col[k]);
+
+    nmod_sparse_mat_clear(T);
+    flint_free(row_cnt);
+    flint_free(col_cnt);
+    flint_free(stack);
+    flint_free(elim_row);
+    flint_free(elim_col);
+    flint_free(core_col);
+    flint_free(row_active);
+    flint_free(col_active);
+    flint_free(elim_type);
+
+    return success;
+}
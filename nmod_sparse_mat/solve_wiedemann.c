@@ -0,0 +1,84 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+static void
+_mul_vec_op(mp_ptr y, mp_srcptr x, const void * data)
+{
+    nmod_sparse_mat_mul_vec(y, (const nmod_sparse_mat_struct *) data, x);
+}
+
+int
+nmod_sparse_mat_solve_wiedemann(mp_ptr x, const nmod_sparse_mat_t M,
+                                         mp_srcptr b, flint_rand_t state)
+{
+    nmod_poly_t f;
+    mp_ptr w, t, s;
+    mp_limb_t c;
+    slong i, n, attempt;
+    int success = 0;
+
+    if (M->r != M->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_solve_wiedemann). "
+                                                 "Non-square matrix.\n");
+        flint_abort();
+    }
+
+    n = M->r;
+
+    if (_nmod_vec_is_zero(b, n))
+    {
+        _nmod_vec_zero(x, n);
+        return 1;
+    }
+
+    nmod_poly_init_mod(f, M->mod);
+    w = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+
+    for (attempt = 0; attempt < 3 && !success; attempt++)
+    {
+        _nmod_sparse_mat_krylov_minpoly(f, _mul_vec_op, M, b, n, M->mod,
+                                                                     state);
+
+        /* a singular M, or an unlucky projection */
+        if (f->length < 2 || f->coeffs[0] == 0)
+            continue;
+
+        /*
+            f(M) b = 0 with f = f_0 + f_1 X + ..., hence
+            x = -(f_1 b + f_2 M b + ...)/f_0 solves M x = b
+        */
+        _nmod_vec_scalar_mul_nmod(w, b, n, f->coeffs[f->length - 1], M->mod);
+
+        for (i = f->length - 2; i >= 1; i--)
+        {
+            nmod_sparse_mat_mul_vec(t, M, w);
+            _nmod_vec_scalar_addmul_nmod(t, b, n, f->coeffs[i], M->mod);
+            s = w; w = t; t = s;
+        }
+
+        c = nmod_neg(nmod_inv(f->coeffs[0], M->mod), M->mod);
+        _nmod_vec_scalar_mul_nmod(w, w, n, c, M->mod);
+
+        nmod_sparse_mat_mul_vec(t, M, w);
+        success = _nmod_vec_equal(t, b, n);
+    }
+
+    if (success)
+        _nmod_vec_set(x, w, n);
+
+    nmod_poly_clear(f);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(t);
+
+    return success;
+}
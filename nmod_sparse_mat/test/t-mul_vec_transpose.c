@@ -0,0 +1,93 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec_transpose....");
+    fflush(stdout);
+
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A, X, Y;
+        mp_ptr x, y;
+        mp_limb_t mod;
+        slong j, r, c, w;
+
+        /* occasionally large enough to be split between threads */
+        if (n_randint(state, 10) == 0)
+        {
+            r = n_randint(state, 2000);
+            c = n_randint(state, 2000);
+            w = n_randint(state, 30);
+        }
+        else
+        {
+            r = n_randint(state, 50);
+            c = n_randint(state, 50);
+            w = n_randint(state, 10);
+        }
+
+        mod = n_randtest_not_zero(state);
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        nmod_sparse_mat_init(M, 0, c, mod);
+        nmod_mat_init(A, r, c, mod);
+        nmod_mat_init(X, 1, r, mod);
+        nmod_mat_init(Y, 1, c, mod);
+        x = _nmod_vec_init(r);
+        y = _nmod_vec_init(c);
+
+        nmod_sparse_mat_randtest(M, state, r, c, w);
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        for (j = 0; j < r; j++)
+        {
+            x[j] = n_randint(state, mod);
+            nmod_mat_entry(X, 0, j) = x[j];
+        }
+
+        nmod_sparse_mat_mul_vec_transpose(y, M, x);
+        nmod_mat_mul(Y, X, A);
+
+        for (j = 0; j < c; j++)
+        {
+            if (y[j] != nmod_mat_entry(Y, 0, j))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("r = %wd, c = %wd, j = %wd\n", r, c, j);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
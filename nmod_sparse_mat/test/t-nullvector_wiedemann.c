@@ -0,0 +1,82 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullvector_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        mp_ptr x, y;
+        mp_limb_t mod;
+        slong r, c, w, rank;
+        int found;
+
+        c = n_randint(state, 60);
+        r = n_randint(state, c + 1);
+        w = n_randint(state, 6);
+
+        mod = n_randprime(state, 40 + n_randint(state, 24), 0);
+
+        nmod_sparse_mat_init(M, 0, c, mod);
+        nmod_mat_init(A, r, c, mod);
+        x = _nmod_vec_init(c);
+        y = _nmod_vec_init(r);
+
+        nmod_sparse_mat_randtest(M, state, r, c, w);
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        rank = nmod_mat_rank(A);
+
+        found = nmod_sparse_mat_nullvector_wiedemann(x, M, state);
+
+        if (found != (rank < c))
+        {
+            flint_printf("FAIL: r = %wd, c = %wd, rank = %wd, found = %d\n",
+                                                          r, c, rank, found);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (found)
+        {
+            nmod_sparse_mat_mul_vec(y, M, x);
+
+            if (_nmod_vec_is_zero(x, c) || !_nmod_vec_is_zero(y, r))
+            {
+                flint_printf("FAIL: not a nonzero nullvector\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
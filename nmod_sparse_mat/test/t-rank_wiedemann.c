@@ -0,0 +1,64 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        mp_limb_t mod;
+        slong r, c, w, rank1, rank2;
+
+        r = n_randint(state, 60);
+        c = n_randint(state, 60);
+        w = n_randint(state, 6);
+
+        mod = n_randprime(state, 40 + n_randint(state, 24), 0);
+
+        nmod_sparse_mat_init(M, 0, c, mod);
+        nmod_mat_init(A, r, c, mod);
+
+        nmod_sparse_mat_randtest(M, state, r, c, w);
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        rank1 = nmod_mat_rank(A);
+        rank2 = nmod_sparse_mat_rank_wiedemann(M, state);
+
+        if (rank1 != rank2)
+        {
+            flint_printf("FAIL: r = %wd, c = %wd, rank = %wd, found %wd\n",
+                                                        r, c, rank1, rank2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t M, N;
+        nmod_mat_t A, B;
+        mp_limb_t mod;
+        slong r, c, w;
+
+        r = n_randint(state, 30);
+        c = n_randint(state, 30);
+        w = n_randint(state, 10);
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, 0, c, mod);
+        nmod_sparse_mat_init(N, 0, 0, mod);
+        nmod_mat_init(A, r, c, mod);
+        nmod_mat_init(B, r, c, mod);
+
+        nmod_sparse_mat_randtest(M, state, r, c, w);
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        nmod_sparse_mat_set_nmod_mat(N, A);
+
+        if (!nmod_sparse_mat_equal(M, N))
+        {
+            flint_printf("FAIL: sparse -> dense -> sparse\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_randtest(A, state);
+        nmod_sparse_mat_set_nmod_mat(M, A);
+        nmod_sparse_mat_set(N, M);
+        nmod_sparse_mat_get_nmod_mat(B, N);
+
+        if (!nmod_mat_equal(A, B) || !nmod_sparse_mat_equal(M, N))
+        {
+            flint_printf("FAIL: dense -> sparse -> dense\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_zero(N);
+
+        if (nmod_sparse_mat_nnz(N) != 0 || nmod_sparse_mat_nrows(N) != r ||
+            nmod_sparse_mat_ncols(N) != c)
+        {
+            flint_printf("FAIL: zero\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_sparse_mat_clear(N);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
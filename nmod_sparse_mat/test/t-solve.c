@@ -0,0 +1,93 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+#include "perm.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        mp_ptr x, b, y;
+        slong * P;
+        mp_limb_t mod;
+        slong j, n, w;
+
+        n = n_randint(state, 60);
+        w = n_randint(state, 6);
+
+        /* the probability of failure is about n^2/mod */
+        mod = n_randprime(state, 40 + n_randint(state, 24), 0);
+
+        nmod_sparse_mat_init(M, 0, n, mod);
+        nmod_mat_init(A, n, n, mod);
+        x = _nmod_vec_init(n);
+        b = _nmod_vec_init(n);
+        y = _nmod_vec_init(n);
+        P = _perm_init(n);
+
+        /* a random nonsingular sparse matrix, containing a permutation */
+        do {
+            nmod_sparse_mat_randtest(M, state, n, n, w);
+            nmod_sparse_mat_get_nmod_mat(A, M);
+            _perm_randtest(P, n, state);
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(A, j, P[j]) = n_randint(state, mod - 1) + 1;
+        } while (nmod_mat_rank(A) != n);
+
+        nmod_sparse_mat_set_nmod_mat(M, A);
+
+        for (j = 0; j < n; j++)
+            b[j] = n_randint(state, mod);
+
+        if (!nmod_sparse_mat_solve(x, M, b, state))
+        {
+            flint_printf("FAIL: solver failed\n");
+            flint_printf("n = %wd, mod = %wu\n", n, mod);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_mul_vec(y, M, x);
+
+        if (!_nmod_vec_equal(y, b, n))
+        {
+            flint_printf("FAIL: wrong solution\n");
+            flint_printf("n = %wd, mod = %wu\n", n, mod);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+        _perm_clear(P);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,46 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_t T;
+    slong i, j, k, nnz;
+
+    nnz = nmod_sparse_mat_nnz(A);
+
+    nmod_sparse_mat_init(T, A->c, A->r, A->mod.n);
+    nmod_sparse_mat_fit_length(T, A->c, nnz);
+
+    /* count the entries of each column, then place them row by row */
+    for (k = 0; k < nnz; k++)
+        T->row_starts[A->cols[k] + 1]++;
+
+    for (j = 0; j < A->c; j++)
+        T->row_starts[j + 1] += T->row_starts[j];
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            j = T->row_starts[A->cols[k]]++;
+            T->cols[j] = i;
+            T->entries[j] = A->entries[k];
+        }
+    }
+
+    for (j = A->c; j > 0; j--)
+        T->row_starts[j] = T->row_starts[j - 1];
+    T->row_starts[0] = 0;
+
+    nmod_sparse_mat_swap(B, T);
+    nmod_sparse_mat_clear(T);
+}
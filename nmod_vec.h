@@ -121,9 +121,26 @@ FLINT_DLL void _nmod_vec_scalar_mul_nmod_shoup(mp_ptr res, mp_srcptr vec,
 FLINT_DLL void _nmod_vec_scalar_addmul_nmod(mp_ptr res, mp_srcptr vec, 
                             slong len, mp_limb_t c, nmod_t mod);
 
+FLINT_DLL void _nmod_vec_inv(mp_ptr res, mp_srcptr vec,
+                                            slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_pow_ui(mp_ptr res, mp_srcptr vec, slong len,
+                                                  ulong e, nmod_t mod);
+
 FLINT_DLL int _nmod_vec_dot_bound_limbs(slong len, nmod_t mod);
 
 
+/*
+    When mod.n <= 2^(FLINT_BITS/2) the entries fit in half a limb, so
+    products are formed from the low halves only (a single 32x32 -> 64
+    multiply on 64-bit machines, which compilers vectorise) and the
+    reduction is delayed: blocks of up to 2^(FLINT_BITS - 2*b) products,
+    b = bits(n - 1), are summed in a single limb without overflow, and
+    only the block sums are carried into the two limb accumulator.
+*/
+#define NMOD_VEC_HALF_MUL(a, b) \
+    ((mp_limb_t) (unsigned int) (a) * (unsigned int) (b))
+
 #define NMOD_VEC_DOT(res, i, len, expr1, expr2, mod, nlimbs)                \
     do                                                                      \
     {                                                                       \
@@ -132,18 +149,37 @@ FLINT_DLL int _nmod_vec_dot_bound_limbs(slong len, nmod_t mod);
         switch (nlimbs)                                                     \
         {                                                                   \
             case 1:                                                         \
-                for (i = 0; i < (len); i++)                                 \
+                if (mod.n <= (UWORD(1) << (FLINT_BITS / 2)))                \
                 {                                                           \
-                    s0 += (expr1) * (expr2);                                \
+                    for (i = 0; i < (len); i++)                             \
+                    {                                                       \
+                        s0 += NMOD_VEC_HALF_MUL(expr1, expr2);              \
+                    }                                                       \
+                }                                                           \
+                else                                                        \
+                {                                                           \
+                    for (i = 0; i < (len); i++)                             \
+                    {                                                       \
+                        s0 += (expr1) * (expr2);                            \
+                    }                                                       \
                 }                                                           \
                 NMOD_RED(s0, s0, mod);                                      \
                 break;                                                      \
             case 2:                                                         \
                 if (mod.n <= (UWORD(1) << (FLINT_BITS / 2)))                \
                 {                                                           \
-                    for (i = 0; i < (len); i++)                             \
+                    slong blk, blk_end;                                     \
+                    t1 = FLINT_BITS - 2*FLINT_BIT_COUNT(mod.n - 1);         \
+                    blk = (t1 >= FLINT_BITS - 1) ? WORD_MAX                 \
+                                                 : (WORD(1) << t1);         \
+                    for (i = 0; i < (len); )                                \
                     {                                                       \
-                        t0 = (expr1) * (expr2);                             \
+                        blk_end = ((len) - i > blk) ? i + blk : (len);      \
+                        t0 = UWORD(0);                                      \
+                        for ( ; i < blk_end; i++)                           \
+                        {                                                   \
+                            t0 += NMOD_VEC_HALF_MUL(expr1, expr2);          \
+                        }                                                   \
                         add_ssaaaa(s1, s0, s1, s0, 0, t0);                  \
                     }                                                       \
                 }                                                           \
@@ -198,6 +234,32 @@ FLINT_DLL mp_limb_t _nmod_vec_dot_ptr(mp_srcptr vec1, const mp_ptr * vec2, slong
     slong len, nmod_t mod, int nlimbs);
 
 
+/* Montgomery form  *********************************************************/
+
+FLINT_DLL void _nmod_vec_mont_from_nmod(mp_ptr res, mp_srcptr vec,
+                                            slong len, nmod_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_to_nmod(mp_ptr res, mp_srcptr vec,
+                                            slong len, nmod_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_add(mp_ptr res, mp_srcptr vec1,
+                          mp_srcptr vec2, slong len, nmod_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_sub(mp_ptr res, mp_srcptr vec1,
+                          mp_srcptr vec2, slong len, nmod_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_mul(mp_ptr res, mp_srcptr vec1,
+                          mp_srcptr vec2, slong len, nmod_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_scalar_mul(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_scalar_addmul(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_mont_t mont);
+
+FLINT_DLL mp_limb_t _nmod_vec_mont_dot(mp_srcptr vec1, mp_srcptr vec2,
+                                            slong len, nmod_mont_t mont);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,53 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+/*
+    Montgomery's simultaneous inversion: with the prefix products
+    p_i = v_0 ... v_i, one inversion of p_{len-1} followed by the
+    backward recurrence 1/v_i = p_{i-1}/p_i, 1/p_{i-1} = v_i/p_i
+    gives all inverses using 3(len - 1) multiplications.
+*/
+void _nmod_vec_inv(mp_ptr res, mp_srcptr vec, slong len, nmod_t mod)
+{
+    mp_ptr p;
+    mp_limb_t inv, t;
+    slong i;
+
+    if (len <= 1)
+    {
+        if (len == 1)
+            res[0] = nmod_inv(vec[0], mod);
+        return;
+    }
+
+    p = _nmod_vec_init(len);
+
+    p[0] = vec[0];
+    for (i = 1; i < len; i++)
+        p[i] = nmod_mul(p[i - 1], vec[i], mod);
+
+    inv = nmod_inv(p[len - 1], mod);
+
+    for (i = len - 1; i > 0; i--)
+    {
+        t = nmod_mul(inv, p[i - 1], mod);
+        inv = nmod_mul(inv, vec[i], mod);
+        res[i] = t;
+    }
+
+    res[0] = inv;
+
+    _nmod_vec_clear(p);
+}
@@ -0,0 +1,23 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+void _nmod_vec_mont_add(mp_ptr res, mp_srcptr vec1,
+                           mp_srcptr vec2, slong len, nmod_mont_t mont)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        res[i] = nmod_mont_add(vec1[i], vec2[i], mont);
+}
@@ -0,0 +1,35 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+mp_limb_t _nmod_vec_mont_dot(mp_srcptr vec1, mp_srcptr vec2,
+                                             slong len, nmod_mont_t mont)
+{
+    mp_limb_t s1, s0, t1, t0;
+    slong i;
+
+    /* The high limb of each product is < n, and the high limb of the
+       accumulator is kept < n by subtracting n*2^FLINT_BITS, so that a
+       single reduction is needed at the end. Requires n < 2^(FLINT_BITS-1). */
+    s1 = s0 = 0;
+    for (i = 0; i < len; i++)
+    {
+        umul_ppmm(t1, t0, vec1[i], vec2[i]);
+        add_ssaaaa(s1, s0, s1, s0, t1, t0);
+        if (s1 >= mont.n)
+            s1 -= mont.n;
+    }
+
+    return _nmod_mont_redc(s1, s0, mont);
+}
@@ -0,0 +1,30 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+void _nmod_vec_mont_scalar_addmul(mp_ptr res, mp_srcptr vec,
+                             slong len, mp_limb_t c, nmod_mont_t mont)
+{
+    slong i;
+    mp_limb_t hi, lo;
+
+    /* with R = 2^FLINT_BITS, (res[i]*R + vec[i]*c)/R = res[i] + vec[i]*c/R,
+       so the addition goes into the high limb before a single reduction */
+    for (i = 0; i < len; i++)
+    {
+        umul_ppmm(hi, lo, vec[i], c);
+        hi = nmod_mont_add(hi, res[i], mont);
+        res[i] = _nmod_mont_redc(hi, lo, mont);
+    }
+}
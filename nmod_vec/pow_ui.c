@@ -0,0 +1,72 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+void _nmod_vec_pow_ui(mp_ptr res, mp_srcptr vec, slong len,
+                                                  ulong e, nmod_t mod)
+{
+    mp_ptr b;
+    slong i;
+    int bit;
+
+    if (len <= 0)
+        return;
+
+    if (e <= 2)
+    {
+        if (e == 0)
+        {
+            for (i = 0; i < len; i++)
+                res[i] = (mod.n == 1) ? 0 : 1;
+        }
+        else if (e == 1)
+        {
+            _nmod_vec_set(res, vec, len);
+        }
+        else
+        {
+            for (i = 0; i < len; i++)
+                res[i] = nmod_mul(vec[i], vec[i], mod);
+        }
+        return;
+    }
+
+    /* left-to-right binary powering with the exponent bits scanned once
+       for the whole vector; the inner loops have independent iterations */
+    if (res == vec)
+    {
+        b = _nmod_vec_init(len);
+        _nmod_vec_set(b, vec, len);
+    }
+    else
+    {
+        b = (mp_ptr) vec;
+        _nmod_vec_set(res, vec, len);
+    }
+
+    for (bit = FLINT_BIT_COUNT(e) - 2; bit >= 0; bit--)
+    {
+        for (i = 0; i < len; i++)
+            res[i] = nmod_mul(res[i], res[i], mod);
+
+        if ((e >> bit) & 1)
+        {
+            for (i = 0; i < len; i++)
+                res[i] = nmod_mul(res[i], b[i], mod);
+        }
+    }
+
+    if (b != vec)
+        _nmod_vec_clear(b);
+}
@@ -79,6 +79,73 @@ main(void)
         _nmod_vec_clear(y);
     }
 
+    /* moduli close to 2^(FLINT_BITS/2), where products are summed in blocks */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong len;
+        nmod_t mod;
+        mp_limb_t m, res;
+        mp_ptr x, y;
+        int limbs1;
+        mpz_t s, t;
+        slong j;
+
+        len = n_randint(state, 2000) + 1;
+        m = n_randbits(state, FLINT_BITS/2 - n_randint(state, 5));
+        if (n_randint(state, 4) == 0)
+            m = UWORD(1) << (FLINT_BITS/2);
+
+        nmod_init(&mod, m);
+
+        x = _nmod_vec_init(len);
+        y = _nmod_vec_init(len);
+
+        if (n_randint(state, 2))
+        {
+            _nmod_vec_randtest(x, state, len, mod);
+            _nmod_vec_randtest(y, state, len, mod);
+        }
+        else
+        {
+            for (j = 0; j < len; j++)
+            {
+                x[j] = m - 1;
+                y[j] = m - 1 - n_randint(state, 2);
+            }
+        }
+
+        limbs1 = _nmod_vec_dot_bound_limbs(len, mod);
+
+        res = _nmod_vec_dot(x, y, len, mod, limbs1);
+
+        mpz_init(s);
+        mpz_init(t);
+
+        for (j = 0; j < len; j++)
+        {
+            flint_mpz_set_ui(t, x[j]);
+            flint_mpz_addmul_ui(s, t, y[j]);
+        }
+
+        flint_mpz_mod_ui(s, s, m);
+
+        if (flint_mpz_get_ui(s) != res)
+        {
+            flint_printf("FAIL (half limb):\n");
+            flint_printf("m = %wu\n", m);
+            flint_printf("len = %wd\n", len);
+            flint_printf("limbs1 = %d\n", limbs1);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        mpz_clear(s);
+        mpz_clear(t);
+
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -0,0 +1,116 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mont....");
+    fflush(stdout);
+
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        slong len, j;
+        nmod_t mod;
+        nmod_mont_t mont;
+        mp_limb_t n, c, cm;
+        mp_ptr a, b, r, am, bm, rm;
+        int result = 1;
+
+        len = n_randint(state, 50);
+        n = n_randtest_not_zero(state) | UWORD(1);
+
+        nmod_init(&mod, n);
+        nmod_mont_init(&mont, n);
+
+        a = _nmod_vec_init(len);
+        b = _nmod_vec_init(len);
+        r = _nmod_vec_init(len);
+        am = _nmod_vec_init(len);
+        bm = _nmod_vec_init(len);
+        rm = _nmod_vec_init(len);
+
+        _nmod_vec_randtest(a, state, len, mod);
+        _nmod_vec_randtest(b, state, len, mod);
+        c = n_randint(state, n);
+        cm = nmod_mont_from_nmod(c, mont);
+
+        /* conversion round trip */
+        _nmod_vec_mont_from_nmod(am, a, len, mont);
+        _nmod_vec_mont_from_nmod(bm, b, len, mont);
+        _nmod_vec_mont_to_nmod(r, am, len, mont);
+        result = result && _nmod_vec_equal(r, a, len);
+        result = result && (nmod_mont_to_nmod(mont.one, mont) == n_mod2_preinv(1, n, mod.ninv));
+
+        for (j = 0; j < len; j++)
+            result = result && (am[j] < n);
+
+        /* add */
+        _nmod_vec_mont_add(rm, am, bm, len, mont);
+        _nmod_vec_mont_to_nmod(rm, rm, len, mont);
+        _nmod_vec_add(r, a, b, len, mod);
+        result = result && _nmod_vec_equal(r, rm, len);
+
+        /* sub */
+        _nmod_vec_mont_sub(rm, am, bm, len, mont);
+        _nmod_vec_mont_to_nmod(rm, rm, len, mont);
+        _nmod_vec_sub(r, a, b, len, mod);
+        result = result && _nmod_vec_equal(r, rm, len);
+
+        /* mul */
+        _nmod_vec_mont_mul(rm, am, bm, len, mont);
+        _nmod_vec_mont_to_nmod(rm, rm, len, mont);
+        for (j = 0; j < len; j++)
+            r[j] = nmod_mul(a[j], b[j], mod);
+        result = result && _nmod_vec_equal(r, rm, len);
+
+        /* scalar_mul */
+        _nmod_vec_mont_scalar_mul(rm, am, len, cm, mont);
+        _nmod_vec_mont_to_nmod(rm, rm, len, mont);
+        _nmod_vec_scalar_mul_nmod(r, a, len, c, mod);
+        result = result && _nmod_vec_equal(r, rm, len);
+
+        /* scalar_addmul */
+        _nmod_vec_set(rm, bm, len);
+        _nmod_vec_mont_scalar_addmul(rm, am, len, cm, mont);
+        _nmod_vec_mont_to_nmod(rm, rm, len, mont);
+        _nmod_vec_set(r, b, len);
+        _nmod_vec_scalar_addmul_nmod(r, a, len, c, mod);
+        result = result && _nmod_vec_equal(r, rm, len);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, len = %wd\n", n, len);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(r);
+        _nmod_vec_clear(am);
+        _nmod_vec_clear(bm);
+        _nmod_vec_clear(rm);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mont_dot....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong len;
+        nmod_t mod;
+        nmod_mont_t mont;
+        mp_limb_t n, res1, res2;
+        mp_ptr x, y, xm, ym;
+
+        len = n_randint(state, 1000) + 1;
+        n = n_randtest_bits(state, n_randint(state, FLINT_BITS - 1) + 1);
+        n |= UWORD(1);
+
+        nmod_init(&mod, n);
+        nmod_mont_init(&mont, n);
+
+        x = _nmod_vec_init(len);
+        y = _nmod_vec_init(len);
+        xm = _nmod_vec_init(len);
+        ym = _nmod_vec_init(len);
+
+        _nmod_vec_randtest(x, state, len, mod);
+        _nmod_vec_randtest(y, state, len, mod);
+
+        _nmod_vec_mont_from_nmod(xm, x, len, mont);
+        _nmod_vec_mont_from_nmod(ym, y, len, mont);
+
+        res1 = _nmod_vec_dot(x, y, len, mod, _nmod_vec_dot_bound_limbs(len, mod));
+        res2 = nmod_mont_to_nmod(_nmod_vec_mont_dot(xm, ym, len, mont), mont);
+
+        if (res1 != res2)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu\n", n);
+            flint_printf("len = %wd\n", len);
+            flint_printf("res1 = %wu, res2 = %wu\n", res1, res2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(xm);
+        _nmod_vec_clear(ym);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("pow_ui....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong len, j;
+        nmod_t mod;
+        mp_limb_t n;
+        ulong e;
+        mp_ptr a, b, c;
+        int aliasing;
+
+        len = n_randint(state, 100);
+        n = n_randtest_not_zero(state);
+        nmod_init(&mod, n);
+        e = n_randtest(state);
+        aliasing = n_randint(state, 2);
+
+        a = _nmod_vec_init(len);
+        b = _nmod_vec_init(len);
+        c = _nmod_vec_init(len);
+
+        _nmod_vec_randtest(a, state, len, mod);
+
+        if (aliasing)
+        {
+            _nmod_vec_set(b, a, len);
+            _nmod_vec_pow_ui(b, b, len, e, mod);
+        }
+        else
+        {
+            _nmod_vec_pow_ui(b, a, len, e, mod);
+        }
+
+        for (j = 0; j < len; j++)
+            c[j] = nmod_pow_ui(a[j], e, mod);
+
+        if (!_nmod_vec_equal(b, c, len))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, e = %wu, len = %wd, aliasing = %d\n",
+                                                    n, e, len, aliasing);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}